@@ -65,6 +65,23 @@
     #define Q_SIGNAL_SIZE 2
 #endif
 
+#ifndef QF_REF_CTR_SIZE
+    //! The size (in bytes) of the reference counter of an event. Valid
+    //! values: 1, 2, or 4; default 1
+    /// @description
+    /// This macro can be defined in the QEP port file (qep_port.h) to
+    /// configure the QP::QEvtRefCtr type, which limits the number of
+    /// references (event queues, deferred queues, and Q_NEW_REF()) that
+    /// a dynamic event can have at the same time. The default is 2 bytes
+    /// when QF_MAX_ACTIVE is above 252, so that an event can be published
+    /// to all the subscribers.
+    #if defined(QF_MAX_ACTIVE) && (QF_MAX_ACTIVE > 252)
+        #define QF_REF_CTR_SIZE 2
+    #else
+        #define QF_REF_CTR_SIZE 1
+    #endif
+#endif
+
 //****************************************************************************
 // typedefs for basic numerical types; MISRA-C++ 2008 rule 3-9-2(req).
 
@@ -123,7 +140,7 @@ typedef double float64_t;
 /// to QSignal and constants for QEvt.poolID and QEvt.refCtr_.
 ///
 #define QEVT_INITIALIZER(sig_) { static_cast<QP::QSignal>(sig_), \
-    static_cast<uint8_t>(0), static_cast<uint8_t>(0) }
+    static_cast<uint8_t>(0), static_cast<QP::QEvtRefCtr>(0) }
 
 
 //****************************************************************************
@@ -152,6 +169,18 @@ extern char_t const versionStr[6];
     #error "Q_SIGNAL_SIZE defined incorrectly, expected 1, 2, or 4"
 #endif
 
+#if (QF_REF_CTR_SIZE == 1)
+    //! QEvtRefCtr is the type of the reference counter of an event
+    //! (configured by the macro #QF_REF_CTR_SIZE)
+    typedef uint8_t QEvtRefCtr;
+#elif (QF_REF_CTR_SIZE == 2)
+    typedef uint16_t QEvtRefCtr;
+#elif (QF_REF_CTR_SIZE == 4)
+    typedef uint32_t QEvtRefCtr;
+#else
+    #error "QF_REF_CTR_SIZE defined incorrectly, expected 1, 2, or 4"
+#endif
+
 #ifdef Q_EVT_CTOR // Provide the constructor for the QEvt class?
 
     //************************************************************************
@@ -167,7 +196,7 @@ extern char_t const versionStr[6];
         QEvt(QSignal const s, StaticEvt /*dummy*/)
           : sig(s),
             poolId_(static_cast<uint8_t>(0)),
-            refCtr_(static_cast<uint8_t>(0))
+            refCtr_(static_cast<QEvtRefCtr>(0))
         {}
 
 #ifdef Q_EVT_VIRTUAL
@@ -180,7 +209,7 @@ extern char_t const versionStr[6];
 
     private:
         uint8_t poolId_;          //!< pool ID (0 for static event)
-        uint8_t volatile refCtr_; //!< reference counter
+        QEvtRefCtr volatile refCtr_; //!< reference counter
 
         friend class QF;
         friend class QActive;
@@ -189,9 +218,9 @@ extern char_t const versionStr[6];
         friend class QEQueue;
         friend class QTicker;
         friend uint8_t QF_EVT_POOL_ID_ (QEvt const * const e);
-        friend uint8_t QF_EVT_REF_CTR_ (QEvt const * const e);
-        friend void QF_EVT_REF_CTR_INC_(QEvt const * const e);
-        friend void QF_EVT_REF_CTR_DEC_(QEvt const * const e);
+        friend QEvtRefCtr QF_EVT_REF_CTR_ (QEvt const * const e);
+        friend QEvtRefCtr QF_EVT_REF_CTR_INC_(QEvt const * const e);
+        friend QEvtRefCtr QF_EVT_REF_CTR_DEC_(QEvt const * const e);
     };
 
 #else // QEvt is a POD (Plain Old Datatype)
@@ -209,7 +238,7 @@ extern char_t const versionStr[6];
     struct QEvt {
         QSignal sig;              //!< signal of the event instance
         uint8_t poolId_;          //!< pool ID (0 for static event)
-        uint8_t volatile refCtr_; //!< reference counter
+        QEvtRefCtr volatile refCtr_; //!< reference counter
     };
 
 #endif // Q_EVT_CTOR
@@ -46,7 +46,8 @@
 /// QP::QMActive::recall(). Finally, this file is also needed when the "raw"
 /// thread-safe queues are used for communication between active objects
 /// and non-framework entities, such as ISRs, device drivers, or legacy
-/// code.
+/// code. The lock-free single-producer/single-consumer variant of the queue
+/// (QP::QSpscQueue) is declared here as well.
 
 #ifndef QF_EQUEUE_CTR_SIZE
 
@@ -60,6 +61,26 @@
     #define QF_EQUEUE_CTR_SIZE 1
 #endif
 
+#ifndef QF_SPSC_LOAD_ACQ
+#ifdef __GNUC__
+    //! Load with the acquire memory order used by QP::QSpscQueue
+    /// @description
+    /// This macro can be defined in the QF port file (qf_port.h) together
+    /// with #QF_SPSC_STORE_REL. The default uses the GCC atomic builtins.
+    /// Other compilers get plain volatile accesses, which are sufficient
+    /// only for a single CPU core (such as the interrupt-to-thread handoff
+    /// on a microcontroller).
+    #define QF_SPSC_LOAD_ACQ(p_)      __atomic_load_n((p_), __ATOMIC_ACQUIRE)
+
+    //! Store with the release memory order used by QP::QSpscQueue
+    #define QF_SPSC_STORE_REL(p_, v_) \
+        __atomic_store_n((p_), (v_), __ATOMIC_RELEASE)
+#else
+    #define QF_SPSC_LOAD_ACQ(p_)      (*(p_))
+    #define QF_SPSC_STORE_REL(p_, v_) (*(p_) = (v_))
+#endif // __GNUC__
+#endif // QF_SPSC_LOAD_ACQ
+
 
 namespace QP {
 
@@ -78,6 +99,13 @@ namespace QP {
     #error "QF_EQUEUE_CTR_SIZE defined incorrectly, expected 1, 2, or 4"
 #endif
 
+//! special value of margin that causes asserting failure in case
+//! event allocation or event posting fails
+/// @note
+/// Defined here rather than in qf.h, because the inline event queues
+/// (QP::QSpscQueue) compare the margin with it.
+uint_fast16_t const QF_NO_MARGIN = static_cast<uint_fast16_t>(0xFFFF);
+
 
 //****************************************************************************
 //! Native QF Event Queue class
@@ -156,6 +184,11 @@ private:
     /// @sa QP::QF::getQueueMin().
     QEQueueCtr m_nMin;
 
+#ifdef QF_CRIT_OBJ_TYPE
+    //! lock protecting this queue (used instead of the QF critical section)
+    QF_CRIT_OBJ_TYPE m_crit;
+#endif // QF_CRIT_OBJ_TYPE
+
 public:
     //! public default constructor
     QEQueue(void);
@@ -186,6 +219,19 @@ public:
     /// @sa QP::QEQueue::postLIFO(), QP::QEQueue::get()
     bool post(QEvt const * const e, uint_fast16_t const margin);
 
+    //! "raw" thread-safe QF event queue implementation for posting
+    //! @p n events (FIFO) in one critical section.
+    /// @description
+    /// With @p margin == QP::QF_NO_MARGIN all the events are posted or the
+    /// function asserts. Otherwise the function posts as many of the first
+    /// events as fit in the queue with the @p margin of free entries left.
+    ///
+    /// @returns the number of events posted
+    ///
+    /// @sa QP::QEQueue::post(), QP::QEQueue::getBatch()
+    uint_fast16_t postN(QEvt const * const evts[], uint_fast16_t const n,
+                        uint_fast16_t const margin);
+
     //! "raw" thread-safe QF event queue implementation for the
     //! First-In-First-Out (FIFO) event posting. You can call this function
     //! from any task context or ISR context. Please note that this function
@@ -210,6 +256,14 @@ public:
     /// @sa QP::QEQueue::post(), QP::QEQueue::postLIFO(), QP::QEQueue::get()
     QEvt const *get(void);
 
+    //! "raw" thread-safe QF event queue operation for removing up to
+    //! @p max events from the front of the queue in one critical section.
+    /// @returns the number of events placed in @p evts[] (zero if the
+    /// queue is empty)
+    ///
+    /// @sa QP::QEQueue::get(), QP::QEQueue::postN()
+    uint_fast16_t getBatch(QEvt const *evts[], uint_fast16_t const max);
+
     //! "raw" thread-safe QF event queue operation for obtaining the number
     //! of free entries still available in the queue.
     /// @note
@@ -266,6 +320,158 @@ private:
     friend class QTicker;
 };
 
+//! increment the reference counter of a dynamic event posted to
+//! QP::QSpscQueue (in the QF critical section)
+void QF_spscRefInc_(QEvt const * const e);
+
+//! assertion of QP::QSpscQueue::post() that cannot post the event
+//! with the margin QP::QF_NO_MARGIN
+void QF_spscPostError_(void);
+
+//****************************************************************************
+//! Lock-free single-producer/single-consumer (SPSC) event queue
+/// @description
+/// This class template is the variant of the "raw" thread-safe queue
+/// QP::QEQueue for the frequent case of exactly one producer and exactly
+/// one consumer, such as an ISR passing events to a thread, or a pipe
+/// between two threads. The queue operations do not use the QF critical
+/// section. Instead, the producer owns the index m_head and the consumer
+/// owns the index m_tail, and each side publishes its own index with the
+/// release memory order (#QF_SPSC_STORE_REL) and reads the index of the
+/// other side with the acquire memory order (#QF_SPSC_LOAD_ACQ).@n
+/// @n
+/// The template parameter @p N is the capacity of the queue, which must be
+/// a power of two, so the indices simply run freely and wrap around with
+/// the QP::QEQueueCtr arithmetic. The ring buffer is a part of the queue
+/// object, so the queue needs no initialization.@n
+/// @n
+/// Like QP::QEQueue::post(), QP::QSpscQueue::post() increments the
+/// reference counter of a dynamic event (the consumer recycles the event
+/// with QP::QF::gc()). This is the only operation that enters the critical
+/// section, and only for dynamic events.
+///
+/// @note
+/// QP::QSpscQueue::post() must be called only by the single producer and
+/// QP::QSpscQueue::get() only by the single consumer. The queue provides
+/// no LIFO posting, because both ends of the queue would be written then.
+/// The queue operations produce no QS trace records.
+///
+template<uint_fast16_t N>
+class QSpscQueue {
+private:
+    //! the capacity must be a power of two within the range of QEQueueCtr
+    typedef char NotPowerOfTwo[((N > 0U) && ((N & (N - 1U)) == 0U)
+        && (N <= (static_cast<uint_fast16_t>(
+                      static_cast<QEQueueCtr>(~0U)) / 2U + 1U)))
+        ? 1 : -1];
+
+    //! the ring buffer
+    QEvt const * volatile m_ring[N];
+
+    //! free-running index of the next event to be inserted (producer)
+    QEQueueCtr volatile m_head;
+
+    //! minimum number of free entries ever in the queue (producer)
+    QEQueueCtr m_nMin;
+
+    //! free-running index of the next event to be removed (consumer)
+#if (defined QF_CACHE_LINE_SIZE) && (defined __GNUC__)
+    QEQueueCtr volatile m_tail __attribute__((aligned(QF_CACHE_LINE_SIZE)));
+#else
+    QEQueueCtr volatile m_tail;
+#endif
+
+public:
+    //! public default constructor (empty queue)
+    QSpscQueue(void)
+      : m_head(static_cast<QEQueueCtr>(0)),
+        m_nMin(static_cast<QEQueueCtr>(N)),
+        m_tail(static_cast<QEQueueCtr>(0))
+    {}
+
+    //! lock-free event posting (FIFO) by the single producer
+    /// @description
+    /// The argument @p margin specifies the minimum number of free entries
+    /// in the queue that must be available for posting to succeed. The
+    /// function returns true (success) if the posting succeeded (with the
+    /// provided margin) and false (failure) when the posting fails.
+    ///
+    /// @note
+    /// The function raises an assertion if the @p margin is
+    /// QP::QF_NO_MARGIN and the queue is full and cannot accept the event.
+    bool post(QEvt const * const e, uint_fast16_t const margin) {
+        QEQueueCtr const head = m_head; // the producer owns the head
+        QEQueueCtr const nFree = static_cast<QEQueueCtr>(N
+            - static_cast<QEQueueCtr>(head - QF_SPSC_LOAD_ACQ(&m_tail)));
+
+        if (margin == QF_NO_MARGIN) {
+            if (nFree == static_cast<QEQueueCtr>(0)) {
+                QF_spscPostError_(); // must be able to post the event
+                return false;
+            }
+        }
+        else if (nFree <= static_cast<QEQueueCtr>(margin)) {
+            return false; // cannot post, but don't assert
+        }
+        else {
+            // can post the event
+        }
+
+        // is it a dynamic event?
+        if (e->poolId_ != static_cast<uint8_t>(0)) {
+            QF_spscRefInc_(e); // increment the reference counter
+        }
+
+        m_ring[head & static_cast<QEQueueCtr>(N - 1U)] = e;
+        QF_SPSC_STORE_REL(&m_head, static_cast<QEQueueCtr>(head + 1U));
+
+        if (m_nMin >= nFree) {
+            m_nMin = nFree - static_cast<QEQueueCtr>(1); // update minimum
+        }
+        return true;
+    }
+
+    //! lock-free event removal by the single consumer
+    /// @returns the event removed from the queue or NULL if the queue is
+    /// empty
+    QEvt const *get(void) {
+        QEQueueCtr const tail = m_tail; // the consumer owns the tail
+        if (QF_SPSC_LOAD_ACQ(&m_head) == tail) {
+            return static_cast<QEvt const *>(0); // the queue is empty
+        }
+        QEvt const *e = m_ring[tail & static_cast<QEQueueCtr>(N - 1U)];
+        QF_SPSC_STORE_REL(&m_tail, static_cast<QEQueueCtr>(tail + 1U));
+        return e;
+    }
+
+    //! obtain the number of free entries still available in the queue
+    /// @note
+    /// Only the producer can rely on the number of free entries not to
+    /// decrease unexpectedly.
+    QEQueueCtr getNFree(void) const {
+        return static_cast<QEQueueCtr>(N
+            - static_cast<QEQueueCtr>(QF_SPSC_LOAD_ACQ(&m_head)
+                                      - QF_SPSC_LOAD_ACQ(&m_tail)));
+    }
+
+    //! obtain the minimum number of free entries ever in the queue
+    QEQueueCtr getNMin(void) const {
+        return m_nMin;
+    }
+
+    //! find out if the queue is empty
+    bool isEmpty(void) const {
+        return QF_SPSC_LOAD_ACQ(&m_head) == QF_SPSC_LOAD_ACQ(&m_tail);
+    }
+
+private:
+    //! disallow copying of QSpscQueue
+    QSpscQueue(QSpscQueue const &);
+
+    //! disallow assignment of QSpscQueue
+    QSpscQueue & operator=(QSpscQueue const &);
+};
+
 } // namespace QP
 
 #endif // qequeue_h
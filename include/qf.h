@@ -48,6 +48,15 @@
 #include <new>  // for placement new
 #endif // Q_EVT_CTOR
 
+// The macro QF_URGENT_LANE (defined in qf_port.h or on the command line)
+// adds the urgent lane to the native event queues of active objects
+// (see QP::QActive::postUrgent_())
+#ifdef QF_URGENT_LANE
+#ifndef qequeue_h
+#include "qequeue.h"
+#endif
+#endif // QF_URGENT_LANE
+
 //****************************************************************************
 // apply defaults for all undefined configuration parameters
 //
@@ -58,7 +67,79 @@
 
 #ifndef QF_MAX_EPOOL
     //! Default value of the macro configurable value in qf_port.h
+    //! Valid values: [1..255]; default 3
     #define QF_MAX_EPOOL         3
+#elif (QF_MAX_EPOOL > 255)
+    #error "QF_MAX_EPOOL exceeds the maximum of 255"
+#endif
+
+#ifndef QF_EPOOL_LUT_SIZE
+    //! Default value of the macro configurable value in qf_port.h
+    /// @description
+    /// The number of entries in the lookup table from the event size to the
+    /// event pool. Every entry covers sizeof(void*) bytes of the event size,
+    /// so the table finds the pool in O(1) for the events up to
+    /// (QF_EPOOL_LUT_SIZE * sizeof(void*)) bytes. The default 0 means no
+    /// lookup table, in which case the event pools are searched linearly.
+    #define QF_EPOOL_LUT_SIZE    0
+#endif
+
+#ifndef QF_MAX_BPOOL
+    //! Default value of the macro configurable value in qf_port.h
+    /// @description
+    /// The maximum number of payload buffer pools (see QP::QBuf).
+    /// Valid values: [0..127]; default 0 (no payload buffers)
+    #define QF_MAX_BPOOL         0
+#elif (QF_MAX_BPOOL > 127)
+    #error "QF_MAX_BPOOL exceeds the maximum of 127"
+#elif (QF_MAX_EPOOL > 127)
+    #error "QF_MAX_EPOOL exceeds the maximum of 127 with payload buffers"
+#endif
+
+#ifndef QF_ALLOC_HIST_SIZE
+    //! Default value of the macro configurable value in qf_port.h
+    /// @description
+    /// The number of size classes in the allocation-size histograms of the
+    /// dynamic events (see QP::QFAllocStats). Every class covers
+    /// sizeof(void*) bytes of the event size and the last class also covers
+    /// all larger events. The default 0 disables the allocation statistics.
+    #define QF_ALLOC_HIST_SIZE   0
+#endif
+
+#ifndef QF_ALLOC_STAT_SIGS
+    //! Default value of the macro configurable value in qf_port.h
+    /// @description
+    /// The number of signals (0..QF_ALLOC_STAT_SIGS-1) with their own
+    /// allocation statistics, all other signals share one more entry.
+    /// The default 0 means only the statistics per event pool.
+    #define QF_ALLOC_STAT_SIGS   0
+#elif (QF_ALLOC_STAT_SIGS > 1024)
+    #error "QF_ALLOC_STAT_SIGS exceeds the maximum of 1024"
+#endif
+
+#ifndef QF_QUEUE_HIST_SIZE
+    //! Default value of the macro configurable value in qf_port.h
+    /// @description
+    /// The number of log2 classes in the per-AO histograms of the queue
+    /// residence time and the queue depth (see QP::QFQueueStats). The
+    /// default 0 disables the queue telemetry. Otherwise the QF port must
+    /// provide the timestamp QF_QUEUE_TIME().
+    #define QF_QUEUE_HIST_SIZE   0
+#elif (QF_QUEUE_HIST_SIZE > 33)
+    #error "QF_QUEUE_HIST_SIZE exceeds the maximum of 33"
+#elif (QF_QUEUE_HIST_SIZE > 0) && (!defined QF_QUEUE_TIME)
+    #error "QF_QUEUE_HIST_SIZE requires QF_QUEUE_TIME() in qf_port.h"
+#endif
+
+#ifndef QF_MAX_CONFLATE
+    //! Default value of the macro configurable value in qf_port.h
+    /// @description
+    /// The maximum number of conflatable signals per active object (see
+    /// QP::QActive::setConflate()). Valid values: [0..255]; default 0
+    /// (no conflation)
+    #define QF_MAX_CONFLATE      0
+#elif (QF_MAX_CONFLATE > 255)
+    #error "QF_MAX_CONFLATE exceeds the maximum of 255"
 #endif
 
 #ifndef QF_MAX_TICK_RATE
@@ -115,6 +196,33 @@ namespace QP {
 
 class QEQueue; // forward declaration
 
+#if (QF_QUEUE_HIST_SIZE > 0)
+//****************************************************************************
+//! Queue residence-time and depth telemetry of an active object
+/// @description
+/// When #QF_QUEUE_HIST_SIZE is defined, the event queue of every active
+/// object counts the depth of the queue at every enqueue (including the
+/// new event). With the timestamp storage (QP::QActive::initQueueStats()),
+/// the queue also stamps every event when it is posted (QF_QUEUE_TIME())
+/// and measures the time the event waited before it was taken out of the
+/// queue for dispatching. Both histograms use log2 classes: the class 0
+/// counts the value 0 and the class i counts the values [2^(i-1), 2^i),
+/// the last class also counts all larger values.
+///
+/// @sa QP::QF::getQueueStats()
+///
+struct QFQueueStats {
+    uint32_t nEvts;   //!< number of the events with the residence time
+    uint32_t maxTime; //!< the longest residence time [QF_QUEUE_TIME() units]
+
+    //! histogram of the queue residence time of the events
+    uint32_t timeHist[QF_QUEUE_HIST_SIZE];
+
+    //! histogram of the queue depth at enqueue
+    uint32_t depthHist[QF_QUEUE_HIST_SIZE];
+};
+#endif // (QF_QUEUE_HIST_SIZE > 0)
+
 //****************************************************************************
 //! QActive active object (based on QP::QHsm implementation)
 /// @description
@@ -155,6 +263,43 @@ public: // for access from extern "C" functions
     /// The native QF event queue is configured by defining the macro
     /// #QF_EQUEUE_TYPE as QP::QEQueue.
     QF_EQUEUE_TYPE m_eQueue;
+
+#ifdef QF_URGENT_LANE
+    //! the urgent lane of the event queue (see QActive::postUrgent_())
+    /// @description
+    /// The urgent events are dispatched before all the events in m_eQueue,
+    /// but in the FIFO order among themselves. The oldest urgent event
+    /// might be held in m_eQueue.m_frontEvt (m_uFront != 0), which borrows
+    /// one free entry of m_eQueue, but still holds its entry in m_uQueue.
+    QEQueue m_uQueue;
+
+    //! the front of m_eQueue holds the oldest urgent event
+    uint8_t m_uFront;
+#endif // QF_URGENT_LANE
+
+#if (QF_MAX_CONFLATE > 0)
+    //! the conflatable signals of this active object (setConflate())
+    QSignal m_cflSig[QF_MAX_CONFLATE];
+
+    //! the position in m_eQueue of the waiting event of each conflatable
+    //! signal (ring-buffer index, front, or none)
+    QEQueueCtr m_cflPos[QF_MAX_CONFLATE];
+
+    //! the number of conflatable signals
+    uint8_t m_nCfl;
+#endif // (QF_MAX_CONFLATE > 0)
+
+#if (QF_QUEUE_HIST_SIZE > 0)
+    //! the enqueue timestamps of the events in m_eQueue: the ring-buffer
+    //! entries followed by the entry of the front event
+    uint32_t *m_qTime;
+
+    //! the length of the m_qTime[] storage
+    uint_fast16_t m_qTimeLen;
+
+    //! the queue residence-time and depth telemetry
+    QFQueueStats m_qStats;
+#endif // (QF_QUEUE_HIST_SIZE > 0)
 #endif
 
 #ifdef QF_OS_OBJECT_TYPE
@@ -177,11 +322,11 @@ public: // for access from extern "C" functions
 #endif
 
     //! QF priority (1..#QF_MAX_ACTIVE) of this active object.
-    uint8_t m_prio;
+    QPrio m_prio;
 
 #ifdef qxk_h // QXK kernel used?
     //! QF start priority (1..#QF_MAX_ACTIVE) of this active object.
-    uint8_t m_startPrio;
+    QPrio m_startPrio;
 #endif
 
 protected:
@@ -191,13 +336,13 @@ protected:
 public:
     //! Starts execution of an active object and registers the object
     //! with the framework.
-    virtual void start(uint_fast8_t const prio,
+    virtual void start(QPrio const prio,
                        QEvt const *qSto[], uint_fast16_t const qLen,
                        void * const stkSto, uint_fast16_t const stkSize,
                        QEvt const * const ie);
 
     //! Overloaded start function (no initialization event)
-    virtual void start(uint_fast8_t const prio,
+    virtual void start(QPrio const prio,
                        QEvt const *qSto[], uint_fast16_t const qLen,
                        void * const stkSto, uint_fast16_t const stkSize)
     {
@@ -214,10 +359,48 @@ public:
                        void const * const sender);
 #endif
 
+#ifndef Q_SPY
+    //! Posts @p n events from the array @p evts directly to the event queue
+    //! of the active object (FIFO) in one critical section.
+    uint_fast16_t postN_(QEvt const * const evts[], uint_fast16_t const n,
+                         uint_fast16_t const margin);
+#else
+    uint_fast16_t postN_(QEvt const * const evts[], uint_fast16_t const n,
+                         uint_fast16_t const margin,
+                         void const * const sender);
+#endif
+
     //! Posts an event directly to the event queue of the active object
     //! using the Last-In-First-Out (LIFO) policy.
     virtual void postLIFO(QEvt const * const e);
 
+#if (QF_MAX_CONFLATE > 0)
+    //! Marks the signal @p sig as conflatable in the event queue of this
+    //! active object (before starting the active object).
+    void setConflate(enum_t const sig);
+#endif // (QF_MAX_CONFLATE > 0)
+
+#if (QF_QUEUE_HIST_SIZE > 0)
+    //! Provides the storage for the enqueue timestamps of the events
+    //! (before starting the active object).
+    void initQueueStats(uint32_t tSto[], uint_fast16_t const tLen);
+#endif // (QF_QUEUE_HIST_SIZE > 0)
+
+#ifdef QF_URGENT_LANE
+    //! Provides the storage for the urgent lane of the event queue
+    //! (before starting the active object).
+    void initUrgent(QEvt const *qSto[], uint_fast16_t const qLen);
+
+#ifndef Q_SPY
+    //! Posts an event to the urgent lane of the event queue, ahead of all
+    //! the regular events.
+    bool postUrgent_(QEvt const * const e, uint_fast16_t const margin);
+#else
+    bool postUrgent_(QEvt const * const e, uint_fast16_t const margin,
+                     void const * const sender);
+#endif
+#endif // QF_URGENT_LANE
+
     //! Un-subscribes from the delivery of all signals to the active object.
     void unsubscribeAll(void) const;
 
@@ -241,13 +424,13 @@ public:
     uint_fast16_t flushDeferred(QEQueue * const eq) const;
 
     //! Get the priority of the active object.
-    uint_fast8_t getPrio(void) const {
-        return static_cast<uint_fast8_t>(m_prio);
+    QPrio getPrio(void) const {
+        return m_prio;
     }
 
     //! Set the priority of the active object.
-    void setPrio(uint_fast8_t const prio) {
-        m_prio = static_cast<uint8_t>(prio);
+    void setPrio(QPrio const prio) {
+        m_prio = prio;
     }
 
     //! Generic setting of additional attributes (useful in QP ports)
@@ -268,6 +451,16 @@ public:
     //! Get an event from the event queue of an active object.
     QEvt const *get_(void);
 
+    //! Get a batch of up to @p max events from the event queue of an
+    //! active object.
+    uint_fast16_t getBatch_(QEvt const *evts[], uint_fast16_t const max);
+
+#ifdef QF_URGENT_LANE
+    //! Get the urgent event from the front of the event queue, if any,
+    //! without blocking.
+    QEvt const *getUrgent_(void);
+#endif
+
 // duplicated API to be used exclusively inside ISRs (useful in some QP ports)
 #ifdef QF_ISR_API
 #ifdef Q_SPY
@@ -280,8 +473,33 @@ public:
 #endif // Q_SPY
 #endif // QF_ISR_API
 
-// friendships...
 private:
+    //! remove the event from the front of the queue (in critical section)
+    QEvt const *getInCrit_(void);
+
+#if (QF_MAX_CONFLATE > 0)
+    //! find the conflatable signal @p sig (m_nCfl if not conflatable)
+    uint_fast8_t cflFind_(QSignal const sig) const;
+
+    //! the waiting event of a conflatable signal moved in the queue
+    void cflMove_(QEQueueCtr const from, QEQueueCtr const to);
+#endif // (QF_MAX_CONFLATE > 0)
+
+#if (QF_QUEUE_HIST_SIZE > 0)
+    //! stamp the queue entry @p i with the enqueue time @p t
+    void qstatStamp_(QEQueueCtr const i, uint32_t const t);
+
+    //! the event at the queue entry @p from moved to the entry @p to
+    void qstatMove_(QEQueueCtr const from, QEQueueCtr const to);
+
+    //! count the queue depth at enqueue (@p nFree after the enqueue)
+    void qstatDepth_(QEQueueCtr const nFree);
+
+    //! count the residence time of the front event taken out
+    void qstatTime_(void);
+#endif // (QF_QUEUE_HIST_SIZE > 0)
+
+// friendships...
     friend class QF;
     friend class QTimeEvt;
     friend class QTicker;
@@ -503,6 +721,112 @@ private:
 /// bit corresponds to the unique priority of an active object.
 typedef QPSet QSubscrList;
 
+#if (QF_MAX_BPOOL > 0)
+//****************************************************************************
+//! Reference-counted payload buffer of zero-copy events
+/// @description
+/// Large payloads (such as multi-KB frames) do not need to be copied into
+/// the events. Instead, the payload is placed in a buffer allocated with
+/// QP::QF::newBuf() from a separate payload buffer pool and the events
+/// (QP::QBufEvt) carry only a pointer to the buffer. The same buffer can be
+/// attached to any number of events, and every event attached to the buffer
+/// holds one reference to it, which is released automatically when the
+/// event is recycled by QP::QF::gc().@n
+/// @n
+/// Like a new dynamic event, a new buffer has no references and is recycled
+/// when the last reference is released. To keep a buffer beyond the events
+/// it is attached to, call QP::QF::bufRef() and later QP::QF::bufRelease().
+///
+/// @note
+/// The payload starts right after the buffer header (QP::QBuf::data()),
+/// so the buffer can be handed to writev()/sendmsg() as one element of
+/// a scatter-gather vector without copying.
+///
+struct QBuf {
+    uint32_t len;                //!< number of payload bytes in use
+    uint8_t poolId_;             //!< buffer pool ID (1-based)
+    QEvtRefCtr volatile refCtr_; //!< reference counter
+
+    //! the payload of the buffer
+    uint8_t *data(void) {
+        return reinterpret_cast<uint8_t *>(this + 1);
+    }
+
+    //! the payload of the buffer (read-only)
+    uint8_t const *data(void) const {
+        return reinterpret_cast<uint8_t const *>(this + 1);
+    }
+};
+
+//****************************************************************************
+//! Event carrying a payload buffer (see QP::QBuf)
+/// @description
+/// The application events with large payloads derive from QP::QBufEvt and
+/// attach the payload buffer with QP::QF::bufAttach() before posting or
+/// publishing the event.
+///
+struct QBufEvt : public QEvt {
+#ifdef Q_EVT_CTOR
+    //! public constructor (dynamic event)
+    QBufEvt(QSignal const s)
+      : QEvt(s),
+        buf(static_cast<QBuf *>(0))
+    {}
+#endif // Q_EVT_CTOR
+
+    QBuf *buf; //!< the attached payload buffer (see QP::QF::bufAttach())
+};
+#endif // (QF_MAX_BPOOL > 0)
+
+#if (QF_ALLOC_HIST_SIZE > 0)
+//****************************************************************************
+//! Allocation statistics of an event pool or of a signal
+/// @description
+/// When #QF_ALLOC_HIST_SIZE is defined, QF records the statistics of the
+/// dynamic events for every event pool and (with #QF_ALLOC_STAT_SIGS) for
+/// every signal, see QP::QF::getAllocStats() and QP::QF::getSigAllocStats().
+/// The counters are updated without the critical section if the QF port
+/// provides the atomic operations (#QF_STAT_ATOMIC), so the statistics
+/// can stay enabled in production.
+///
+struct QFAllocStats {
+    uint32_t nAlloc;  //!< number of the events allocated
+    uint32_t nFail;   //!< number of the failed allocations
+    uint32_t nUsed;   //!< number of the events allocated right now
+    uint32_t nPeak;   //!< peak number of the events allocated at once
+    uint32_t maxSize; //!< the largest event size requested [bytes]
+
+    //! number of the events allocated in every size class, the class i
+    //! covers the events of (i*sizeof(void*), (i+1)*sizeof(void*)] bytes
+    uint32_t hist[QF_ALLOC_HIST_SIZE];
+};
+
+//! Recommended event pool (see QP::QF::advisePools())
+struct QFPoolAdvice {
+    uint_fast16_t blockSize; //!< the block size of the pool [bytes]
+    uint_fast32_t nBlocks;   //!< the number of blocks in the pool
+};
+
+//! Work area of QP::QF::advisePools() provided by the caller
+/// @description
+/// The work area takes QF_MAX_EPOOL * MAX_ITEMS * 2 bytes and more, so it
+/// is typically a static object of the thread producing the report. The
+/// calls of QP::QF::advisePools() that use different work areas can run
+/// concurrently.
+struct QFPoolAdviceWork {
+#if (QF_ALLOC_STAT_SIGS > 0)
+    enum { MAX_ITEMS = QF_ALLOC_STAT_SIGS + 1 };
+#else
+    enum { MAX_ITEMS = QF_ALLOC_HIST_SIZE + QF_MAX_EPOOL };
+#endif
+    uint_fast32_t sizeArr[MAX_ITEMS]; //!< the block sizes (ascending)
+    uint_fast32_t demand[MAX_ITEMS];  //!< the numbers of blocks of sizes
+    uint64_t best[MAX_ITEMS];  //!< the least memory for the items so far
+    uint64_t prev[MAX_ITEMS];  //!< best[] of the previous number of pools
+    uint16_t first[QF_MAX_EPOOL][MAX_ITEMS]; //!< the first item of a pool
+};
+#endif // (QF_ALLOC_HIST_SIZE > 0)
+
 
 //****************************************************************************
 //! QF services.
@@ -561,21 +885,101 @@ public:
     //! any time event is active.
     static bool noTimeEvtsActiveX(uint_fast8_t const tickRate);
 
+#ifdef QF_TICKLESS
+    //! Returns the number of clock ticks until the nearest expiration
+    //! of a time event at the given tick rate (0 if none is armed).
+    static QTimeEvtCtr tickNearest_(uint_fast8_t const tickRate);
+
+    //! Advances all time events at the given tick rate by @p nTicks
+    //! clock ticks without expiring them (tickless ports).
+    static void tickAdvance_(uint_fast8_t const tickRate,
+                             QTimeEvtCtr const nTicks);
+#endif // QF_TICKLESS
+
     //! This function returns the minimum of free entries of the given
     //! event pool.
     static uint_fast16_t getPoolMin(uint_fast8_t const poolId);
 
     //! This function returns the minimum of free entries of the given
     //! event queue.
-    static uint_fast16_t getQueueMin(uint_fast8_t const prio);
+    static uint_fast16_t getQueueMin(QPrio const prio);
+
+#ifdef QF_URGENT_LANE
+    //! This function returns the minimum of free entries of the urgent
+    //! lane of the given event queue.
+    static uint_fast16_t getUrgentQueueMin(QPrio const prio);
+#endif // QF_URGENT_LANE
+
+#if (QF_QUEUE_HIST_SIZE > 0)
+    //! Obtain (and optionally reset) the queue residence-time and depth
+    //! telemetry of the given active object.
+    static void getQueueStats(QPrio const prio,
+                              QFQueueStats * const stats, bool const reset);
+#endif // (QF_QUEUE_HIST_SIZE > 0)
 
     //! Internal QF implementation of creating new dynamic event.
     static QEvt *newX_(uint_fast16_t const evtSize,
                        uint_fast16_t const margin, enum_t const sig);
 
+    //! Internal QF implementation of creating new dynamic event from
+    //! the given event pool (see Q_EVT_POOL()).
+    static QEvt *newFromPool_(uint_fast8_t const poolId,
+                              uint_fast16_t const evtSize,
+                              uint_fast16_t const margin, enum_t const sig);
+
     //! Recycle a dynamic event.
     static void gc(QEvt const *e);
 
+    //! Internal QF implementation of creating a batch of new dynamic
+    //! events from one event pool (all or none).
+    static bool newBatch_(QEvt *evts[], uint_fast16_t const n,
+                          uint_fast8_t poolId, uint_fast16_t const evtSize,
+                          uint_fast16_t const margin, enum_t const sig);
+
+    //! Recycle a batch of dynamic events.
+    static void gcBatch(QEvt const * const evts[], uint_fast16_t const n);
+
+#if (QF_MAX_BPOOL > 0)
+    //! Payload buffer pool initialization (see QP::QBuf).
+    static void bufPoolInit(void * const poolSto,
+                            uint_fast32_t const poolSize,
+                            uint_fast16_t const bufSize);
+
+    //! Allocate a payload buffer for at least @p size bytes.
+    static QBuf *newBuf(uint_fast32_t const size,
+                        uint_fast16_t const margin);
+
+    //! Attach the payload buffer @p buf to a new dynamic event @p e.
+    static void bufAttach(QBufEvt * const e, QBuf * const buf);
+
+    //! Add a reference to the payload buffer @p buf.
+    static void bufRef(QBuf * const buf);
+
+    //! Release a reference to the payload buffer @p buf.
+    static void bufRelease(QBuf * const buf);
+#endif // (QF_MAX_BPOOL > 0)
+
+#if (QF_ALLOC_HIST_SIZE > 0)
+    //! Obtain (and optionally reset) the allocation statistics of the given
+    //! event pool.
+    static void getAllocStats(uint_fast8_t const poolId,
+                              QFAllocStats * const stats, bool const reset);
+
+#if (QF_ALLOC_STAT_SIGS > 0)
+    //! Obtain (and optionally reset) the allocation statistics of the given
+    //! signal.
+    static void getSigAllocStats(enum_t const sig,
+                                 QFAllocStats * const stats,
+                                 bool const reset);
+#endif // (QF_ALLOC_STAT_SIGS > 0)
+
+    //! Recommend the block sizes and the numbers of blocks of up to
+    //! @p maxPools event pools from the allocation statistics.
+    static uint_fast8_t advisePools(QFPoolAdvice advice[],
+                                    uint_fast8_t const maxPools,
+                                    QFPoolAdviceWork * const work);
+#endif // (QF_ALLOC_HIST_SIZE > 0)
+
     //! Internal QF implementation of creating new event reference.
     static QEvt const *newRef_(QEvt const * const e,
                                QEvt const * const evtRef);
@@ -628,10 +1032,6 @@ private:
 #endif // qxk_h
 };
 
-//! special value of margin that causes asserting failure in case
-//! event allocation or event posting fails
-uint_fast16_t const QF_NO_MARGIN = static_cast<uint_fast16_t>(0xFFFF);
-
 
 //****************************************************************************
 //! Ticker Active Object class
@@ -659,8 +1059,58 @@ public:
     virtual void postLIFO(QEvt const * const e);
 };
 
+//****************************************************************************
+//! Event pool of the event type @p evtT bound at compile time
+/// @description
+/// By default (id == 0), the macros Q_NEW() and Q_NEW_X() select the event
+/// pool by the size of the event at run time. The macro Q_EVT_POOL()
+/// specializes this template for the given event type, so that Q_NEW() and
+/// Q_NEW_X() allocate the events of this type directly from the given pool.
+///
+template<typename evtT>
+struct QEvtPool {
+    enum { id = 0 }; //!< the pool ID (1-based order of QF::poolInit())
+};
+
 } // namespace QP
 
+//! Bind the event type @p evtT_ to the event pool @p poolId_
+/// @description
+/// The pool ID is the 1-based order of the QP::QF::poolInit() calls and
+/// the event pool must be large enough for the events of the type
+/// @p evtT_, which is checked by an assertion at the allocation.
+///
+/// @note
+/// The macro must be used at the global scope, after the declaration of
+/// the event type and before any Q_NEW() or Q_NEW_X() of this type.
+///
+/// @usage
+/// @code
+/// Q_EVT_POOL(TableEvt, 2U) // TableEvt always from the 2nd event pool
+/// @endcode
+#define Q_EVT_POOL(evtT_, poolId_) \
+    namespace QP { \
+        template<> struct QEvtPool< evtT_ > { enum { id = (poolId_) }; }; \
+    }
+
+//! Internal macro to allocate an event of the type @p evtT_ from the pool
+//! bound to this type at compile time, or from the pool found by its size
+#define QF_NEW_X_(evtT_, margin_, sig_) \
+    ((QP::QEvtPool< evtT_ >::id == 0) \
+        ? QP::QF::newX_(static_cast<uint_fast16_t>(sizeof(evtT_)), \
+                        (margin_), (sig_)) \
+        : QP::QF::newFromPool_( \
+                static_cast<uint_fast8_t>(QP::QEvtPool< evtT_ >::id), \
+                static_cast<uint_fast16_t>(sizeof(evtT_)), \
+                (margin_), (sig_)))
+
+//! Internal macro to allocate a batch of @p n_ events of the type @p evtT_
+//! from the pool bound to this type or from the pool found by its size
+#define QF_NEW_BATCH_(evtT_, evts_, n_, margin_, sig_) \
+    (QP::QF::newBatch_((evts_), static_cast<uint_fast16_t>(n_), \
+        static_cast<uint_fast8_t>(QP::QEvtPool< evtT_ >::id), \
+        static_cast<uint_fast16_t>(sizeof(evtT_)), (margin_), (sig_)))
+
 //****************************************************************************
 #ifndef QF_CRIT_EXIT_NOP
     //! No-operation for exiting a critical section
@@ -679,26 +1129,47 @@ public:
 // Provide the constructor for the QEvt class?
 #ifdef Q_EVT_CTOR
 
+    // NOTE: the signal is passed to QF::newX_() and QF::newBatch_() too,
+    // so that the QS trace and the per-signal allocation statistics see
+    // the same signal as the recycling of the event. The constructor of
+    // the event class must not change the signal it receives.
     #define Q_NEW(evtT_, sig_, ...) \
-        (new(QP::QF::newX_(static_cast<uint_fast16_t>(sizeof(evtT_)), \
-                     QP::QF_NO_MARGIN, static_cast<enum_t>(0))) \
+        (new(QF_NEW_X_(evtT_, QP::QF_NO_MARGIN, static_cast<enum_t>(sig_))) \
             evtT_((sig_),  ##__VA_ARGS__))
 
     #define Q_NEW_X(e_, evtT_, margin_, sig_, ...) do { \
-        (e_) = static_cast<evtT_ *>(QP::QF::newX_(static_cast<uint_fast16_t>(\
-                  sizeof(evtT_)), (margin_), static_cast<enum_t>(0))); \
+        (e_) = static_cast<evtT_ *>( \
+                  QF_NEW_X_(evtT_, (margin_), static_cast<enum_t>(sig_))); \
         if ((e_) != static_cast<evtT_ *>(0)) { \
             new((e_)) evtT_((sig_),  ##__VA_ARGS__); \
         } \
      } while (0)
 
+    #define Q_NEW_BATCH(evts_, n_, evtT_, sig_, ...) do { \
+        (void)QF_NEW_BATCH_(evtT_, (evts_), (n_), QP::QF_NO_MARGIN, \
+                            static_cast<enum_t>(sig_)); \
+        for (uint_fast16_t i_ = 0U; i_ < (n_); ++i_) { \
+            new((evts_)[i_]) evtT_((sig_),  ##__VA_ARGS__); \
+        } \
+    } while (0)
+
+    #define Q_NEW_BATCH_X(ok_, evts_, n_, evtT_, margin_, sig_, ...) do { \
+        (ok_) = QF_NEW_BATCH_(evtT_, (evts_), (n_), (margin_), \
+                              static_cast<enum_t>(sig_)); \
+        for (uint_fast16_t i_ = 0U; (ok_) && (i_ < (n_)); ++i_) { \
+            new((evts_)[i_]) evtT_((sig_),  ##__VA_ARGS__); \
+        } \
+    } while (0)
+
 #else // QEvt is a POD (Plain Old Datatype)
 
     //! Allocate a dynamic event.
     /// @description
     /// The macro calls the internal QF function QP::QF::newX_() with
     /// margin == QP::QF_NO_MARGIN, which causes an assertion when the event
-    /// cannot be successfully allocated.
+    /// cannot be successfully allocated. The event pool is selected by the
+    /// size of @p evtT_, unless the type is bound to an event pool with the
+    /// macro Q_EVT_POOL().
     ///
     /// @param[in] evtT_ event type (class name) of the event to allocate
     /// @param[in] sig_  signal to assign to the newly allocated event
@@ -715,9 +1186,7 @@ public:
     /// The following example illustrates dynamic allocation of an event:
     /// @include qf_post.cpp
     #define Q_NEW(evtT_, sig_) \
-        (static_cast<evtT_ *>(QP::QF::newX_( \
-                static_cast<uint_fast16_t>(sizeof(evtT_)), \
-                QP::QF_NO_MARGIN, (sig_))))
+        (static_cast<evtT_ *>(QF_NEW_X_(evtT_, QP::QF_NO_MARGIN, (sig_))))
 
     //! Allocate a dynamic event (non-asserting version).
     /// @description
@@ -744,8 +1213,48 @@ public:
     /// The following example illustrates dynamic allocation of an event:
     /// @include qf_postx.cpp
     #define Q_NEW_X(e_, evtT_, margin_, sig_)  ((e_) = static_cast<evtT_ *>(\
-        QP::QF::newX_(static_cast<uint_fast16_t>(sizeof(evtT_)),\
-                      (margin_), (sig_))))
+        QF_NEW_X_(evtT_, (margin_), (sig_))))
+
+    //! Allocate a batch of dynamic events.
+    /// @description
+    /// The macro allocates @p n_ events of the type @p evtT_ from one event
+    /// pool by calling QP::QF::newBatch_() with margin == QP::QF_NO_MARGIN,
+    /// which causes an assertion when the batch cannot be allocated. With
+    /// the batch operations in the QF port, the whole batch takes a single
+    /// critical section of the event pool, instead of one for every event.
+    ///
+    /// @param[out] evts_ array of at least @p n_ QP::QEvt pointers, which
+    ///                   receives the allocated events
+    /// @param[in]  n_    the number of events to allocate
+    /// @param[in]  evtT_ event type (class name) of the events to allocate
+    /// @param[in]  sig_  signal to assign to the newly allocated events
+    ///
+    /// @note
+    /// If #Q_EVT_CTOR is defined, the Q_NEW_BATCH() macro becomes variadic
+    /// and calls the constructor of every event in the batch.
+    ///
+    /// @usage
+    /// @code
+    /// QEvt *evts[50];
+    /// Q_NEW_BATCH(evts, 50U, TokenEvt, TOKEN_SIG);
+    /// for (uint_fast16_t i = 0U; i < 50U; ++i) {
+    ///     static_cast<TokenEvt *>(evts[i])->pos = i;
+    ///     QF::PUBLISH(evts[i], me);
+    /// }
+    /// @endcode
+    ///
+    /// @sa QP::QF::gcBatch()
+    #define Q_NEW_BATCH(evts_, n_, evtT_, sig_) \
+        ((void)QF_NEW_BATCH_(evtT_, (evts_), (n_), QP::QF_NO_MARGIN, (sig_)))
+
+    //! Allocate a batch of dynamic events (non-asserting version).
+    /// @description
+    /// This macro allocates @p n_ events of the type @p evtT_ from one event
+    /// pool, all or none, while leaving at least @p margin_ events still
+    /// available in the pool, and sets the bool @p ok_ to true when the
+    /// batch has been allocated.
+    #define Q_NEW_BATCH_X(ok_, evts_, n_, evtT_, margin_, sig_) \
+        ((ok_) = QF_NEW_BATCH_(evtT_, (evts_), (n_), (margin_), (sig_)))
 #endif
 
 //! Create a new reference of the current event `e` */
@@ -900,11 +1409,86 @@ public:
     #define POST_X(e_, margin_, sender_) \
         post_((e_), (margin_), (sender_))
 
+    //! Invoke the urgent event posting facility QP::QActive::postUrgent_().
+    /// @description
+    /// The event overtakes all the regular events waiting in the queue,
+    /// but not the urgent events posted before. This macro asserts if the
+    /// urgent lane overflows and cannot accept the event.
+    ///
+    /// @param[in] e_      pointer to the event to post
+    /// @param[in] sender_ pointer to the sender object.
+    ///
+    /// @sa POST(), QP::QActive::postUrgent_()
+    #define POST_URGENT(e_, sender_) \
+        postUrgent_((e_), QP::QF_NO_MARGIN, (sender_))
+
+    //! Invoke the urgent event posting facility QP::QActive::postUrgent_()
+    //! without delivery guarantee.
+    /// @description
+    /// This macro does not assert if the urgent lane cannot accept the
+    /// event with the specified margin of free slots remaining.
+    ///
+    /// @param[in] e_      pointer to the event to post
+    /// @param[in] margin_ the minimum free slots in the urgent lane, which
+    ///                    must still be available after posting the event.
+    /// @param[in] sender_ pointer to the sender object.
+    ///
+    /// @returns
+    /// 'true' if the posting succeeded, and 'false' otherwise.
+    ///
+    /// @sa POST_X(), QP::QActive::postUrgent_()
+    #define POST_URGENT_X(e_, margin_, sender_) \
+        postUrgent_((e_), (margin_), (sender_))
+
+    //! Invoke the bulk event posting facility QP::QActive::postN_().
+    /// @description
+    /// This macro posts all @p n_ events from the array @p evts_ in one
+    /// critical section and asserts if the queue cannot accept all of them.
+    ///
+    /// @param[in] evts_   array of pointers to the events to post
+    /// @param[in] n_      number of events in the array
+    /// @param[in] sender_ pointer to the sender object.
+    ///
+    /// @sa POST(), QP::QActive::postN_()
+    #define POST_N(evts_, n_, sender_) \
+        postN_((evts_), static_cast<uint_fast16_t>(n_), QP::QF_NO_MARGIN, \
+               (sender_))
+
+    //! Invoke the bulk event posting facility QP::QActive::postN_()
+    //! without delivery guarantee.
+    /// @description
+    /// This macro posts as many events from the array @p evts_ as fit in
+    /// the queue with the specified margin of free slots remaining.
+    ///
+    /// @param[in] evts_   array of pointers to the events to post
+    /// @param[in] n_      number of events in the array
+    /// @param[in] margin_ the minimum free slots in the queue, which
+    ///                    must still be available after posting the events.
+    ///                    The special value QP::QF_NO_MARGIN makes the
+    ///                    posting all-or-nothing (see POST_N()).
+    /// @param[in] sender_ pointer to the sender object.
+    ///
+    /// @returns
+    /// the number of events posted (the first events of the array). The
+    /// events that were not posted are recycled.
+    ///
+    /// @sa POST_X(), QP::QActive::postN_()
+    #define POST_N_X(evts_, n_, margin_, sender_) \
+        postN_((evts_), static_cast<uint_fast16_t>(n_), (margin_), \
+               (sender_))
+
 #else
 
     #define PUBLISH(e_, dummy_)  publish_((e_))
     #define POST(e_, dummy_)     post_((e_), QP::QF_NO_MARGIN)
     #define POST_X(e_, margin_, dummy_) post_((e_), (margin_))
+    #define POST_URGENT(e_, dummy_) \
+        postUrgent_((e_), QP::QF_NO_MARGIN)
+    #define POST_URGENT_X(e_, margin_, dummy_) postUrgent_((e_), (margin_))
+    #define POST_N(evts_, n_, dummy_) \
+        postN_((evts_), static_cast<uint_fast16_t>(n_), QP::QF_NO_MARGIN)
+    #define POST_N_X(evts_, n_, margin_, dummy_) \
+        postN_((evts_), static_cast<uint_fast16_t>(n_), (margin_))
     #define TICK_X(tickRate_, dummy_)   tickX_((tickRate_))
 
 #endif // Q_SPY
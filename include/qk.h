@@ -70,11 +70,11 @@ namespace QP {
 extern "C" {
 
 struct QK_Attr {
-    uint8_t volatile actPrio;    //!< prio of the active AO
-    uint8_t volatile nextPrio;   //!< prio of the next AO to execute
-    uint8_t volatile lockPrio;   //!< lock prio (0 == no-lock)
-    uint8_t volatile lockHolder; //!< prio of the lock holder
-    uint8_t volatile intNest;    //!< ISR nesting level
+    QP::QPrio volatile actPrio;    //!< prio of the active AO
+    QP::QPrio volatile nextPrio;   //!< prio of the next AO to execute
+    QP::QPrio volatile lockPrio;   //!< lock prio (0 == no-lock)
+    QP::QPrio volatile lockHolder; //!< prio of the lock holder
+    uint8_t volatile intNest;      //!< ISR nesting level
     QP::QPSet readySet;          //!< QK ready-set of AOs and "naked" threads
 };
 
@@ -82,7 +82,7 @@ struct QK_Attr {
 extern QK_Attr QK_attr_;
 
 //! QK scheduler finds the highest-priority thread ready to run
-uint_fast8_t QK_sched_(void);
+QP::QPrio QK_sched_(void);
 
 //! QK activator activates the next active object. The activated AO preempts
 // the currently executing AOs.
@@ -121,7 +121,14 @@ void QK_activate_(void);
 namespace QP {
 
 //! The scheduler lock status
+/// @description
+/// The previous lock priority in the upper bits and the previous lock
+/// holder in the lower 8*#QF_PRIO_SIZE bits.
+#if (QF_PRIO_SIZE == 1)
 typedef uint_fast16_t QSchedStatus;
+#else
+typedef uint_fast32_t QSchedStatus;
+#endif
 
 //****************************************************************************
 //! QK services.
@@ -138,7 +145,7 @@ class QK {
 public:
     // QK scheduler locking...
     //! QK selective scheduler lock
-    static QSchedStatus schedLock(uint_fast8_t const ceiling);
+    static QSchedStatus schedLock(QPrio const ceiling);
 
     //! QK selective scheduler unlock
     static void schedUnlock(QSchedStatus const stat);
@@ -185,10 +192,20 @@ public:
     //
     #define QF_SCHED_STAT_ QSchedStatus lockStat_;
 
+    //! Internal macro with the position of the previous lock priority
+    // in QP::QSchedStatus
+    #define QK_SCHED_SHIFT_  (8 * QF_PRIO_SIZE)
+
+    //! Internal macro with the QP::QSchedStatus of a lock request that
+    // did not lock the scheduler (also the mask of the lock holder)
+    #define QK_SCHED_NOLOCK_ \
+        static_cast<QSchedStatus>( \
+            (static_cast<QSchedStatus>(1) << QK_SCHED_SHIFT_) - 1U)
+
     //! Internal macro for selective scheduler locking.
     #define QF_SCHED_LOCK_(prio_) do { \
         if (QK_ISR_CONTEXT_()) { \
-            lockStat_ = static_cast<QSchedStatus>(0xFF); \
+            lockStat_ = QK_SCHED_NOLOCK_; \
         } else { \
             lockStat_ = QK::schedLock((prio_)); \
         } \
@@ -196,7 +213,7 @@ public:
 
     //! Internal macro for selective scheduler unlocking.
     #define QF_SCHED_UNLOCK_() do { \
-        if (lockStat_ != static_cast<QSchedStatus>(0xFF)) { \
+        if (lockStat_ != QK_SCHED_NOLOCK_) { \
             QK::schedUnlock(lockStat_); \
         } \
     } while (false)
@@ -206,9 +223,9 @@ public:
         Q_ASSERT_ID(110, (me_)->m_eQueue.m_frontEvt != static_cast<QEvt *>(0))
 
     #define QACTIVE_EQUEUE_SIGNAL_(me_) do { \
-        QK_attr_.readySet.insert(static_cast<uint_fast8_t>((me_)->m_prio)); \
+        QK_attr_.readySet.insert((me_)->m_prio); \
         if (!QK_ISR_CONTEXT_()) { \
-            if (QK_sched_() != static_cast<uint_fast8_t>(0)) { \
+            if (QK_sched_() != static_cast<QP::QPrio>(0)) { \
                 QK_activate_(); \
             } \
         } \
@@ -223,6 +240,9 @@ public:
     #define QF_EPOOL_GET_(p_, e_, m_) \
         ((e_) = static_cast<QEvt *>((p_).get((m_))))
     #define QF_EPOOL_PUT_(p_, e_) ((p_).put(e_))
+    #define QF_EPOOL_GET_N_(p_, chain_, n_, m_) \
+        ((chain_) = (p_).getN((n_), (m_)))
+    #define QF_EPOOL_PUT_N_(p_, chain_, n_) ((p_).putN((chain_), (n_)))
 
 #endif // QP_IMPL
 
@@ -51,6 +51,36 @@
     #define QF_MPOOL_CTR_SIZE 2
 #endif
 
+#ifndef QF_MPOOL_ALIGN
+    //! macro to override the alignment and the stride of the memory blocks
+    /// @description
+    /// By default (0) the memory blocks are aligned to a pointer and the
+    /// block size is rounded up to a multiple of the pointer size, so small
+    /// blocks share the cache lines with their neighbors. Defining this
+    /// macro as a power of 2, such as the CPU cache line size (e.g., 64),
+    /// aligns the start of the pool storage and rounds up the block size
+    /// (the stride) to a multiple of QF_MPOOL_ALIGN. The blocks (e.g., the
+    /// events used by different CPU cores) then never share a cache line.
+    ///
+    /// @note
+    /// The storage declared with #QF_MPOOL_EL is aligned to QF_MPOOL_ALIGN
+    /// (see #QF_MPOOL_ALIGN_ATTR). Any other pool storage not aligned to
+    /// QF_MPOOL_ALIGN makes the pool skip the unaligned head of the storage,
+    /// which might cost one block. Also, the event pools must still differ
+    /// in the rounded-up block size (see QP::QF::poolInit()).
+    #define QF_MPOOL_ALIGN 0
+#elif ((QF_MPOOL_ALIGN & (QF_MPOOL_ALIGN - 1)) != 0)
+    #error "QF_MPOOL_ALIGN defined incorrectly, expected a power of 2"
+#elif !(defined QF_MPOOL_ALIGN_ATTR)
+    #ifdef __GNUC__
+        //! the attribute aligning the elements of #QF_MPOOL_EL to
+        //! #QF_MPOOL_ALIGN (the QF port can override it for its compiler)
+        #define QF_MPOOL_ALIGN_ATTR __attribute__((aligned(QF_MPOOL_ALIGN)))
+    #else
+        #error "QF_MPOOL_ALIGN requires QF_MPOOL_ALIGN_ATTR in the QF port"
+    #endif
+#endif
+
 namespace QP {
 #if (QF_MPOOL_SIZ_SIZE == 1)
     typedef uint8_t QMPoolSize;
@@ -132,6 +162,11 @@ private:
     /// @sa QP::QF::getPoolMin().
     QMPoolCtr m_nMin;
 
+#ifdef QF_CRIT_OBJ_TYPE
+    //! lock protecting this pool (used instead of the QF critical section)
+    QF_CRIT_OBJ_TYPE m_crit;
+#endif // QF_CRIT_OBJ_TYPE
+
 public:
     QMPool(void); //!< public default constructor
 
@@ -145,6 +180,12 @@ public:
     //! Returns a memory block back to a memory pool.
     void put(void * const b);
 
+    //! Obtains a chain of @p n memory blocks in one critical section.
+    void *getN(uint_fast16_t const n, uint_fast16_t const margin);
+
+    //! Returns a chain of @p n memory blocks in one critical section.
+    void putN(void * const chain, uint_fast16_t const n);
+
     //! return the fixed block-size of the blocks managed by this pool
     QMPoolSize getBlockSize(void) const {
         return m_blockSize;
@@ -166,8 +207,16 @@ private:
 } // namespace QP
 
 //! Memory pool element to allocate correctly aligned storage for QP::QMPool
+#if (QF_MPOOL_ALIGN == 0)
 #define QF_MPOOL_EL(type_) \
     struct { void *sto_[((sizeof(type_) - 1U)/sizeof(void*)) + 1U]; }
+#else
+#define QF_MPOOL_EL(type_) \
+    struct QF_MPOOL_ALIGN_ATTR { \
+        void *sto_[((((sizeof(type_) - 1U)/(QF_MPOOL_ALIGN)) + 1U) \
+                    * (QF_MPOOL_ALIGN) + sizeof(void*) - 1U) \
+                   / sizeof(void*)]; }
+#endif
 
 #endif  // qmpool_h
 
@@ -39,12 +39,69 @@
 #ifndef qpset_h
 #define qpset_h
 
-#if (QF_MAX_ACTIVE < 1) || (64 < QF_MAX_ACTIVE)
-    #error "QF_MAX_ACTIVE not defined or out of range. Valid range is 1..64"
+// NOTE: QF_MAX_ACTIVE up to 252 keeps the priorities in 8 bits (QP::QPrio),
+// so the default configurations and the QS trace records are unchanged.
+// More active objects (up to 1024, the capacity of the two-level bitmap in
+// QP::QPSet) make the priorities 16-bit in the whole API, the QF objects
+// and the QS records (#QF_PRIO_SIZE).
+#if (QF_MAX_ACTIVE < 1) || (1024 < QF_MAX_ACTIVE)
+    #error "QF_MAX_ACTIVE not defined or out of range. Valid range is 1..1024"
+#endif
+
+#if (QF_MAX_ACTIVE <= 252)
+    //! The size (in bytes) of the QF priority, which follows from
+    //! #QF_MAX_ACTIVE: 1 for up to 252 priorities, 2 for more.
+    /// @description
+    /// The priorities 253..255 are not used with the 1-byte priorities,
+    /// because QS-RX reserves the three largest values of the priority
+    /// for special purposes.
+    #define QF_PRIO_SIZE 1
+#else
+    #define QF_PRIO_SIZE 2
+#endif
+
+// a published event is referenced by every subscriber at the same time
+#if (QF_PRIO_SIZE == 2) && defined(QF_REF_CTR_SIZE) && (QF_REF_CTR_SIZE < 2)
+    #error "QF_MAX_ACTIVE above 252 requires QF_REF_CTR_SIZE of 2 or 4"
 #endif
 
 namespace QP {
 
+#if (QF_PRIO_SIZE == 1)
+    //! QF priority (0..#QF_MAX_ACTIVE) of active objects and threads
+    typedef uint8_t QPrio;
+#else
+    typedef uint16_t QPrio;
+#endif
+
+//! number of 1-bits in the 32-bit bitmask @p x (word-parallel, branch-free)
+inline uint_fast8_t QF_bitCount_(uint32_t x) {
+    x = x - ((x >> 1) & 0x55555555U);
+    x = (x & 0x33333333U) + ((x >> 2) & 0x33333333U);
+    x = (x + (x >> 4)) & 0x0F0F0F0FU;
+    return static_cast<uint_fast8_t>((x * 0x01010101U) >> 24);
+}
+
+#ifdef QF_LOG2
+    #define QF_PSET_LOG2_(x_) QF_LOG2(x_)
+#else
+    //! function that returns (log2(x) + 1), where @p x is a 32-bit bitmask
+    uint_fast8_t QF_log2_(uint32_t x);
+    #define QF_PSET_LOG2_(x_) QF_log2_(x_)
+#endif
+
+//! call @p f(n) for every 1-bit of the 32-bit bitmask @p bits, where n is
+//! the 1-based number of the bit plus @p base, from the highest to the lowest
+template<typename F>
+inline void QF_bitsForEach_(uint32_t bits, QPrio const base, F &f) {
+    while (bits != static_cast<uint32_t>(0)) {
+        uint_fast8_t const n = QF_PSET_LOG2_(bits);
+        bits &= ~(static_cast<uint32_t>(1)
+                  << (n - static_cast<uint_fast8_t>(1)));
+        f(static_cast<QPrio>(n + base));
+    }
+}
+
 //****************************************************************************
 #if (QF_MAX_ACTIVE <= 32)
 //! Priority Set of up to 32 elements */
@@ -75,37 +132,54 @@ public:
     }
 
     //! the function evaluates to TRUE if the priority set has the element n.
-    bool hasElement(uint_fast8_t const n) const {
+    bool hasElement(QPrio const n) const {
         return (m_bits & (static_cast<uint32_t>(1)
                           << (n - static_cast<uint_fast8_t>(1))))
                != static_cast<uint32_t>(0);
     }
 
     //! insert element @p n into the set, n = 1..8
-    void insert(uint_fast8_t const n) {
+    void insert(QPrio const n) {
         m_bits |= static_cast<uint32_t>(
             static_cast<uint32_t>(1) << (n - static_cast<uint_fast8_t>(1)));
     }
 
     //! remove element @p n from the set, n = 1..8
-    void remove(uint_fast8_t const n) {
+    void remove(QPrio const n) {
         m_bits &= static_cast<uint32_t>(
            ~(static_cast<uint32_t>(1) << (n - static_cast<uint_fast8_t>(1))));
     }
 
+    //! the number of elements in the set
+    QPrio count(void) const {
+        return QF_bitCount_(m_bits);
+    }
+
+    //! remove all elements that are not in the set @p other
+    void intersect(QPSet const &other) {
+        m_bits &= other.m_bits;
+    }
+
+    //! call @p f(n) for every element n of the set, in descending order
+    /// @note @p f must not modify this set
+    template<typename F>
+    void forEach(F &f) const {
+        QF_bitsForEach_(m_bits, static_cast<QPrio>(0), f);
+    }
+
 #ifdef QF_LOG2
     //! find the maximum element in the set, returns zero if the set is empty
     //! inline definition
-    uint_fast8_t findMax(void) const {
+    QPrio findMax(void) const {
         return QF_LOG2(m_bits);
     }
 #else
     //! find the maximum element in the set, returns zero if the set is empty
-    uint_fast8_t findMax(void) const;
+    QPrio findMax(void) const;
 #endif
 };
 
-#else // QF_MAX_ACTIVE > 32
+#elif (QF_MAX_ACTIVE <= 64)
 
 //! Priority Set of up to 64 elements
 ///
@@ -142,7 +216,7 @@ public:
     }
 
     //! the function evaluates to TRUE if the priority set has the element n.
-    bool hasElement(uint_fast8_t const n) const {
+    bool hasElement(QPrio const n) const {
         return (n <= static_cast<uint_fast8_t>(32))
             ? ((m_bits[0] & (static_cast<uint32_t>(1)
                              << (n - static_cast<uint_fast8_t>(1))))
@@ -153,7 +227,7 @@ public:
     }
 
     //! insert element @p n into the set, n = 1..64
-    void insert(uint_fast8_t const n) {
+    void insert(QPrio const n) {
         if (n <= static_cast<uint_fast8_t>(32)) {
             m_bits[0] |= (static_cast<uint32_t>(1)
                           << (n - static_cast<uint_fast8_t>(1)));
@@ -165,7 +239,7 @@ public:
     }
 
     //! remove element @p n from the set, n = 1..64
-    void remove(uint_fast8_t const n) {
+    void remove(QPrio const n) {
         if (n <= static_cast<uint_fast8_t>(32)) {
             (m_bits[0] &= ~(static_cast<uint32_t>(1)
                             << (n - static_cast<uint_fast8_t>(1))));
@@ -176,16 +250,164 @@ public:
         }
     }
 
+    //! the number of elements in the set
+    QPrio count(void) const {
+        return static_cast<QPrio>(QF_bitCount_(m_bits[0])
+                                  + QF_bitCount_(m_bits[1]));
+    }
+
+    //! remove all elements that are not in the set @p other
+    void intersect(QPSet const &other) {
+        m_bits[0] &= other.m_bits[0];
+        m_bits[1] &= other.m_bits[1];
+    }
+
+    //! call @p f(n) for every element n of the set, in descending order
+    /// @note @p f must not modify this set
+    template<typename F>
+    void forEach(F &f) const {
+        QF_bitsForEach_(m_bits[1], static_cast<QPrio>(32), f);
+        QF_bitsForEach_(m_bits[0], static_cast<QPrio>(0), f);
+    }
+
 #ifdef QF_LOG2
     //! find the maximum element in the set, returns zero if the set is empty
-    uint_fast8_t findMax(void) const {
+    QPrio findMax(void) const {
         return (m_bits[1] != static_cast<uint32_t>(0))
             ? (QF_LOG2(m_bits[1]) + static_cast<uint_fast8_t>(32)) \
             : (QF_LOG2(m_bits[0]));
     }
 #else
     //! find the maximum element in the set, returns zero if the set is empty
-    uint_fast8_t findMax(void) const;
+    QPrio findMax(void) const;
+#endif
+};
+
+#else // QF_MAX_ACTIVE > 64
+
+//! number of 32-bit words in the priority set of more than 64 elements
+#define QF_PSET_WORDS_  ((QF_MAX_ACTIVE + 31) / 32)
+
+//! Priority Set of up to 1024 elements
+///
+/// The priority set represents the set of active objects that are ready to
+/// run and need to be considered by the scheduling algorithm. The set is
+/// capable of storing up to 1024 priority levels in QF_PSET_WORDS_ 32-bit
+/// bitmasks.@n
+/// @n
+/// The additional summary bitmask has a bit for each non-empty bitmask
+/// (a two-level bitmap), so findMax() needs only two log-base-2
+/// calculations regardless of the number of the elements.
+///
+class QPSet {
+
+    uint32_t volatile m_summary; //!< bitmask with a bit for each word
+    uint32_t volatile m_bits[QF_PSET_WORDS_]; //!< bitmasks of the elements
+
+public:
+
+    //! Makes the priority set @p me_ empty.
+    void setEmpty(void) {
+        m_summary = static_cast<uint32_t>(0);
+        for (uint_fast8_t i = static_cast<uint_fast8_t>(0);
+             i < static_cast<uint_fast8_t>(QF_PSET_WORDS_);
+             ++i)
+        {
+            m_bits[i] = static_cast<uint32_t>(0);
+        }
+    }
+
+    //! Evaluates to true if the priority set is empty
+    bool isEmpty(void) const {
+        return (m_summary == static_cast<uint32_t>(0));
+    }
+
+    //! Evaluates to true if the priority set is not empty
+    bool notEmpty(void) const {
+        return (m_summary != static_cast<uint32_t>(0));
+    }
+
+    //! the function evaluates to TRUE if the priority set has the element n.
+    bool hasElement(QPrio const n) const {
+        QPrio const i = static_cast<QPrio>(n - static_cast<QPrio>(1));
+        return (m_bits[i >> 5] & (static_cast<uint32_t>(1)
+                                  << (i & static_cast<uint_fast8_t>(0x1F))))
+               != static_cast<uint32_t>(0);
+    }
+
+    //! insert element @p n into the set, n = 1..QF_MAX_ACTIVE
+    void insert(QPrio const n) {
+        QPrio const i = static_cast<QPrio>(n - static_cast<QPrio>(1));
+        m_bits[i >> 5] |= (static_cast<uint32_t>(1)
+                           << (i & static_cast<uint_fast8_t>(0x1F)));
+        m_summary |= (static_cast<uint32_t>(1) << (i >> 5));
+    }
+
+    //! remove element @p n from the set, n = 1..QF_MAX_ACTIVE
+    void remove(QPrio const n) {
+        QPrio const i = static_cast<QPrio>(n - static_cast<QPrio>(1));
+        m_bits[i >> 5] &= ~(static_cast<uint32_t>(1)
+                            << (i & static_cast<uint_fast8_t>(0x1F)));
+        if (m_bits[i >> 5] == static_cast<uint32_t>(0)) {
+            m_summary &= ~(static_cast<uint32_t>(1) << (i >> 5));
+        }
+    }
+
+    //! the number of elements in the set
+    QPrio count(void) const {
+        QPrio n = static_cast<QPrio>(0);
+        for (uint_fast8_t i = static_cast<uint_fast8_t>(0);
+             i < static_cast<uint_fast8_t>(QF_PSET_WORDS_);
+             ++i)
+        {
+            n = static_cast<QPrio>(n + QF_bitCount_(m_bits[i]));
+        }
+        return n;
+    }
+
+    //! remove all elements that are not in the set @p other
+    void intersect(QPSet const &other) {
+        m_summary &= other.m_summary;
+        for (uint_fast8_t i = static_cast<uint_fast8_t>(0);
+             i < static_cast<uint_fast8_t>(QF_PSET_WORDS_);
+             ++i)
+        {
+            m_bits[i] &= other.m_bits[i];
+            if (m_bits[i] == static_cast<uint32_t>(0)) {
+                m_summary &= ~(static_cast<uint32_t>(1) << i);
+            }
+        }
+    }
+
+    //! call @p f(n) for every element n of the set, in descending order
+    /// @note @p f must not modify this set
+    template<typename F>
+    void forEach(F &f) const {
+        uint32_t s = m_summary;
+        while (s != static_cast<uint32_t>(0)) {
+            // index of the highest non-empty bitmask
+            uint_fast8_t const i = static_cast<uint_fast8_t>(
+                QF_PSET_LOG2_(s) - static_cast<uint_fast8_t>(1));
+            s &= ~(static_cast<uint32_t>(1) << i);
+            QF_bitsForEach_(m_bits[i], static_cast<QPrio>(i << 5), f);
+        }
+    }
+
+#ifdef QF_LOG2
+    //! find the maximum element in the set, returns zero if the set is empty
+    QPrio findMax(void) const {
+        QPrio n = static_cast<QPrio>(0);
+        if (m_summary != static_cast<uint32_t>(0)) { // QF_LOG2(0) not used
+            // index of the highest non-empty bitmask
+            n = static_cast<QPrio>(QF_LOG2(m_summary)
+                                   - static_cast<uint_fast8_t>(1));
+            n = static_cast<QPrio>(QF_LOG2(m_bits[n]) + (n << 5));
+        }
+        return n;
+    }
+#else
+    //! find the maximum element in the set, returns zero if the set is empty
+    QPrio findMax(void) const;
 #endif
 };
 
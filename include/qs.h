@@ -103,7 +103,8 @@ enum QSpyRecords {
     QS_QF_EQUEUE_GET,     //!< get an event and queue still not empty
     QS_QF_EQUEUE_GET_LAST,//!< get the last event from the queue
 
-    QS_QF_RESERVED2,
+    // [23] AO records
+    QS_QF_ACTIVE_POST_URGENT, //!< an event was posted to the urgent lane
 
     // [24] MP records
     QS_QF_MPOOL_GET,      //!< a memory block was removed from memory pool
@@ -169,7 +170,7 @@ enum QSpyRecords {
     QS_TARGET_INFO,       //!< reports the Target information
     QS_TARGET_DONE,       //!< reports completion of a user callback
     QS_RX_STATUS,         //!< reports QS data receive status
-    QS_MSC_RESERVED1,
+    QS_QUEUE_STATS,       //!< queue residence-time and depth telemetry
     QS_PEEK_DATA,         //!< reports the data from the PEEK query
     QS_ASSERT_FAIL,       //!< assertion failed in the code
 
@@ -580,8 +581,8 @@ enum QSpyRxRecords {
 /// The active object filter affects the following QS records:
 /// ::QS_QF_ACTIVE_DEFER, ::QS_QF_ACTIVE_RECALL, ::QS_QF_ACTIVE_SUBSCRIBE,
 /// ::QS_QF_ACTIVE_UNSUBSCRIBE, ::QS_QF_ACTIVE_POST, ::QS_QF_ACTIVE_POST_LIFO,
-/// ::QS_QF_ACTIVE_GET, ::QS_QF_ACTIVE_GET_LAST, and
-/// ::QS_QF_ACTIVE_RECALL_ATTEMPT.
+/// ::QS_QF_ACTIVE_GET, ::QS_QF_ACTIVE_GET_LAST,
+/// ::QS_QF_ACTIVE_RECALL_ATTEMPT, and ::QS_QF_ACTIVE_POST_URGENT.
 ///
 /// @sa Example of using QS filters in #QS_FILTER_ON documentation
 #define QS_FILTER_AO_OBJ(obj_) \
@@ -839,6 +840,22 @@ enum QSpyRxRecords {
 //! Internal QS macro to output an unformatted uint32_t data element
 #define QS_U32_(data_)       (QP::QS::u32_(static_cast<uint32_t>(data_)))
 
+#if (QF_PRIO_SIZE == 1)
+    //! Internal QS macro to output an unformatted QF priority data element
+    /// @note
+    /// The size of the priority depends on the macro #QF_PRIO_SIZE.
+    #define QS_PRIO_(prio_)  (QP::QS::u8_(static_cast<uint8_t>(prio_)))
+
+    //! Internal QS macro to output 2 unformatted QF priority data elements
+    #define QS_2PRIO_(prio1_, prio2_) \
+        (QP::QS::u8u8_(static_cast<uint8_t>(prio1_), \
+                       static_cast<uint8_t>(prio2_)))
+#elif (QF_PRIO_SIZE == 2)
+    #define QS_PRIO_(prio_)  (QP::QS::u16_(static_cast<uint16_t>(prio_)))
+    #define QS_2PRIO_(prio1_, prio2_) \
+        (QS_PRIO_(prio1_), QS_PRIO_(prio2_))
+#endif
+
 
 #if (QS_OBJ_PTR_SIZE == 1)
     #define QS_OBJ_(obj_)    (QP::QS::u8_(reinterpret_cast<uint8_t>(obj_)))
@@ -1180,7 +1197,7 @@ enum QSpyRxRecords {
         Q_ASSERT_ID(110, (me_)->m_eQueue.m_frontEvt != static_cast<QEvt *>(0))
 
     #define QACTIVE_EQUEUE_SIGNAL_(me_) \
-        (QS::rxPriv_.readySet.insert(static_cast<uint_fast8_t>((me_)->m_prio)))
+        (QS::rxPriv_.readySet.insert((me_)->m_prio))
 #endif // QP_IMPL
 
 #else
@@ -101,6 +101,8 @@
 #define QS_END_NOCRIT_()                }
 #define QS_U8_(data_)                   ((void)0)
 #define QS_2U8_(data1_, data2_)         ((void)0)
+#define QS_PRIO_(prio_)                 ((void)0)
+#define QS_2PRIO_(prio1_, prio2_)       ((void)0)
 #define QS_U16_(data_)                  ((void)0)
 #define QS_U32_(data_)                  ((void)0)
 #define QS_U64_(data_)                  ((void)0)
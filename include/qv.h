@@ -109,7 +109,7 @@ extern "C" {
     #define QACTIVE_EQUEUE_WAIT_(me_) \
         Q_ASSERT_ID(110, (me_)->m_eQueue.m_frontEvt != static_cast<QEvt *>(0))
     #define QACTIVE_EQUEUE_SIGNAL_(me_) \
-        (QV_readySet_.insert(static_cast<uint_fast8_t>((me_)->m_prio)))
+        (QV_readySet_.insert((me_)->m_prio))
 
     // QV-specific native QF event pool operations...
     #define QF_EPOOL_TYPE_  QMPool
@@ -120,6 +120,9 @@ extern "C" {
     #define QF_EPOOL_GET_(p_, e_, m_) \
         ((e_) = static_cast<QEvt *>((p_).get((m_))))
     #define QF_EPOOL_PUT_(p_, e_) ((p_).put(e_))
+    #define QF_EPOOL_GET_N_(p_, chain_, n_, m_) \
+        ((chain_) = (p_).getN((n_), (m_)))
+    #define QF_EPOOL_PUT_N_(p_, chain_, n_) ((p_).putN((chain_), (n_)))
 
 #endif // QP_IMPL
 
@@ -83,13 +83,13 @@ extern "C" {
 
 //! attributes of the QXK kernel
 struct QXK_Attr {
-    QP::QActive * volatile curr; //!< currently executing thread
-    QP::QActive * volatile next; //!< next thread to execute
-    uint8_t volatile actPrio;    //!< prio of the active basic thread
-    uint8_t volatile lockPrio;   //!< lock prio (0 == no-lock)
-    uint8_t volatile lockHolder; //!< prio of the lock holder
-    uint8_t volatile intNest;    //!< ISR nesting level
-    QP::QActive * idleThread;    //!< pointer to the idle thread
+    QP::QActive * volatile curr;   //!< currently executing thread
+    QP::QActive * volatile next;   //!< next thread to execute
+    QP::QPrio volatile actPrio;    //!< prio of the active basic thread
+    QP::QPrio volatile lockPrio;   //!< lock prio (0 == no-lock)
+    QP::QPrio volatile lockHolder; //!< prio of the lock holder
+    uint8_t volatile intNest;      //!< ISR nesting level
+    QP::QActive * idleThread;      //!< pointer to the idle thread
     QP::QPSet readySet; //!< ready-set of basic- and extended-threads
 };
 
@@ -97,7 +97,7 @@ struct QXK_Attr {
 extern QXK_Attr QXK_attr_;
 
 //! QXK scheduler finds the highest-priority thread ready to run
-uint_fast8_t QXK_sched_(void);
+QP::QPrio QXK_sched_(void);
 
 //! QXK activator activates the next active object. The activated AO preempts
 // the currently executing AOs.
@@ -139,7 +139,14 @@ QP::QActive *QXK_current(void);
 namespace QP {
 
 //! The scheduler lock status
+/// @description
+/// The previous lock priority in the upper bits and the previous lock
+/// holder in the lower 8*#QF_PRIO_SIZE bits.
+#if (QF_PRIO_SIZE == 1)
 typedef uint_fast16_t QSchedStatus;
+#else
+typedef uint_fast32_t QSchedStatus;
+#endif
 
 //****************************************************************************
 //! QXK services.
@@ -155,7 +162,7 @@ typedef uint_fast16_t QSchedStatus;
 class QXK {
 public:
     //! QXK selective scheduler lock
-    static QSchedStatus schedLock(uint_fast8_t const ceiling);
+    static QSchedStatus schedLock(QPrio const ceiling);
 
     //! QXK selective scheduler unlock
     static void schedUnlock(QSchedStatus const stat);
@@ -201,10 +208,20 @@ public:
     //
     #define QF_SCHED_STAT_ QSchedStatus lockStat_;
 
+    //! Internal macro with the position of the previous lock priority
+    // in QP::QSchedStatus
+    #define QXK_SCHED_SHIFT_  (8 * QF_PRIO_SIZE)
+
+    //! Internal macro with the QP::QSchedStatus of a lock request that
+    // did not lock the scheduler (also the mask of the lock holder)
+    #define QXK_SCHED_NOLOCK_ \
+        static_cast<QSchedStatus>( \
+            (static_cast<QSchedStatus>(1) << QXK_SCHED_SHIFT_) - 1U)
+
     //! Internal macro for selective scheduler locking.
     #define QF_SCHED_LOCK_(prio_) do { \
         if (QXK_ISR_CONTEXT_()) { \
-            lockStat_ = static_cast<QSchedStatus>(0xFF); \
+            lockStat_ = QXK_SCHED_NOLOCK_; \
         } else { \
             lockStat_ = QXK::schedLock((prio_)); \
         } \
@@ -212,7 +229,7 @@ public:
 
     //! Internal macro for selective scheduler unlocking.
     #define QF_SCHED_UNLOCK_() do { \
-        if (lockStat_ != static_cast<QSchedStatus>(0xFF)) { \
+        if (lockStat_ != QXK_SCHED_NOLOCK_) { \
             QXK::schedUnlock(lockStat_); \
         } \
     } while (false)
@@ -222,9 +239,9 @@ public:
         Q_ASSERT_ID(110, (me_)->m_eQueue.m_frontEvt != static_cast<QEvt *>(0))
 
     #define QACTIVE_EQUEUE_SIGNAL_(me_) do { \
-        QXK_attr_.readySet.insert(static_cast<uint_fast8_t>((me_)->m_prio)); \
+        QXK_attr_.readySet.insert((me_)->m_prio); \
         if (!QXK_ISR_CONTEXT_()) { \
-            if (QXK_sched_() != static_cast<uint_fast8_t>(0)) { \
+            if (QXK_sched_() != static_cast<QP::QPrio>(0)) { \
                 QXK_activate_(); \
             } \
         } \
@@ -239,6 +256,9 @@ public:
     #define QF_EPOOL_GET_(p_, e_, m_) \
         ((e_) = static_cast<QEvt *>((p_).get((m_))))
     #define QF_EPOOL_PUT_(p_, e_) ((p_).put(e_))
+    #define QF_EPOOL_GET_N_(p_, chain_, n_, m_) \
+        ((chain_) = (p_).getN((n_), (m_)))
+    #define QF_EPOOL_PUT_N_(p_, chain_, n_) ((p_).putN((chain_), (n_)))
 
 #endif // QP_IMPL
 
@@ -95,13 +95,13 @@ public:
 
     //! Starts execution of an extended thread and registers the thread
     //! with the framework.
-    virtual void start(uint_fast8_t const prio,
+    virtual void start(QPrio const prio,
                        QEvt const *qSto[], uint_fast16_t const qLen,
                        void * const stkSto, uint_fast16_t const stkSize,
                        QEvt const * const ie);
 
     //! Overloaded start function (no initialization event)
-    virtual void start(uint_fast8_t const prio,
+    virtual void start(QPrio const prio,
                        QEvt const *qSto[], uint_fast16_t const qLen,
                        void * const stkSto, uint_fast16_t const stkSize)
     {
@@ -216,7 +216,7 @@ private:
 class QXMutex {
 public:
     //! initialize the QXK priority-ceiling mutex QP::QXMutex
-    void init(uint_fast8_t const ceiling);
+    void init(QPrio const ceiling);
 
     //! lock the QXK priority-ceiling mutex QP::QXMutex
     bool lock(uint_fast16_t const nTicks = QXTHREAD_NO_TIMEOUT);
@@ -230,8 +230,8 @@ public:
 private:
     QPSet m_waitSet; //!< set of extended-threads waiting on this mutex
     uint8_t volatile m_lockNest;
-    uint8_t volatile m_holderPrio;
-    uint8_t m_ceiling;
+    QPrio volatile m_holderPrio;
+    QPrio m_ceiling;
 };
 
 } // namespace QP
@@ -93,6 +93,9 @@
     #define QF_EPOOL_GET_(p_, e_, m_) \
         ((e_) = static_cast<QEvt *>((p_).get((m_))))
     #define QF_EPOOL_PUT_(p_, e_) ((p_).put(e_))
+    #define QF_EPOOL_GET_N_(p_, chain_, n_, m_) \
+        ((chain_) = (p_).getN((n_), (m_)))
+    #define QF_EPOOL_PUT_N_(p_, chain_, n_) ((p_).putN((chain_), (n_)))
 
 #endif // ifdef QP_IMPL
 
@@ -74,7 +74,7 @@ void QF::stop(void) {
 }
 
 //............................................................................
-void QActive::start(uint_fast8_t prio,
+void QActive::start(QPrio const prio,
                     QEvt const *qSto[], uint_fast16_t qLen,
                     void *stkSto, uint_fast16_t stkSize,
                     QEvt const *ie)
@@ -111,7 +111,7 @@ void QActive::start(uint_fast8_t prio,
 }
 //............................................................................
 void QActive::stop(void) {
-    m_prio = static_cast<uint8_t>(0); // stop the thread loop
+    m_prio = static_cast<QPrio>(0); // stop the thread loop
 }
 //............................................................................
 void QActive::setAttr(uint32_t attr1, void const *attr2) {
@@ -132,7 +132,7 @@ static void task_function(void *pvParameters) { // FreeRTOS task signature
 }
 // thread for active objects -------------------------------------------------
 void QF::thread_(QActive *act) {
-    while (act->m_prio != static_cast<uint8_t>(0)) {
+    while (act->m_prio != static_cast<QPrio>(0)) {
         QEvt const *e = act->get_(); // wait for event
         act->dispatch(e); // dispatch to the active object's state machine
         gc(e); // check if the event is garbage, and collect it if so
@@ -277,7 +277,7 @@ void QF::publishFromISR_(QEvt const *e, void *par)
     taskEXIT_CRITICAL_FROM_ISR(uxSavedInterruptState);
 
     if (subscrList.notEmpty()) {
-        uint_fast8_t p = subscrList.findMax(); // the highest-prio subscriber
+        QPrio p = subscrList.findMax(); // the highest-prio subscriber
 
         // no need to lock the scheduler in the ISR context
         do { // loop over all subscribers */
@@ -292,9 +292,9 @@ void QF::publishFromISR_(QEvt const *e, void *par)
                 p = subscrList.findMax(); // the highest-prio subscriber
             }
             else {
-                p = static_cast<uint_fast8_t>(0); // no more subscribers
+                p = static_cast<QPrio>(0); // no more subscribers
             }
-        } while (p != static_cast<uint_fast8_t>(0));
+        } while (p != static_cast<QPrio>(0));
         // no need to unlock the scheduler in the IRS context
     }
 
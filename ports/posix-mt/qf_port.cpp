@@ -0,0 +1,590 @@
+/// @file
+/// @brief QF/C++ port to POSIX API with a pool of worker threads (posix-mt)
+/// @cond
+///***************************************************************************
+/// Last updated for version 6.3.4
+/// Last updated on  2018-09-04
+///
+///                    Q u a n t u m     L e a P s
+///                    ---------------------------
+///                    innovating embedded systems
+///
+/// Copyright (C) 2005-2018 Quantum Leaps, LLC. All rights reserved.
+///
+/// This program is open source software: you can redistribute it and/or
+/// modify it under the terms of the GNU General Public License as published
+/// by the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Alternatively, this program may be distributed and modified under the
+/// terms of Quantum Leaps commercial licenses, which expressly supersede
+/// the GNU General Public License and are specifically designed for
+/// licensees interested in retaining the proprietary status of their code.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program. If not, see <http://www.gnu.org/licenses/>.
+///
+/// Contact information:
+/// https://www.state-machine.com
+/// mailto:info@state-machine.com
+///***************************************************************************
+/// @endcond
+
+#define QP_IMPL           // this is QP implementation
+#include "qf_port.h"      // QF port
+#include "qf_pkg.h"       // QF package-scope interface
+#include "qassert.h"      // QP embedded systems-friendly assertions
+#ifdef Q_SPY              // QS software tracing enabled?
+    #include "qs_port.h"  // include QS port
+#else
+    #include "qs_dummy.h" // disable the QS software tracing
+#endif // Q_SPY
+
+#include <errno.h>        // for EINTR
+#include <time.h>         // for clock_nanosleep()
+#include <unistd.h>       // for sysconf()
+
+namespace QP {
+
+Q_DEFINE_THIS_MODULE("qf_port")
+
+/* Global objects ==========================================================*/
+pthread_mutex_t QF_pThreadMutex_;
+
+// Local objects *************************************************************
+static bool l_isRunning;    // flag indicating when QF is running
+static bool l_isStarted;    // flag indicating that any AO has been started
+static struct timespec l_tick; // tick period
+static QFTickStats l_tickStats; // tick statistics
+static int_t l_tickPrio;
+enum { NANOSLEEP_NSEC_PER_SEC = 1000000000 }; // see NOTE02
+
+// maximum number of missed clock ticks to catch up, see NOTE03
+#ifndef QF_TICK_MAX_CATCHUP
+#define QF_TICK_MAX_CATCHUP 10
+#endif
+
+// worker thread with its run queue, see NOTE2 in qf_port.h
+struct QFWorker {
+    pthread_mutex_t lock; // mutex protecting the run queue
+    QPSet ready;          // the priority levels with any ready AOs
+    QActive *head[QF_MAX_ACTIVE + 1]; // the ready AOs of each level (FIFO)
+    QActive *tail[QF_MAX_ACTIVE + 1]; // the last ready AO of each level
+    uint32_t volatile top; // the highest ready priority (0: none), atomic
+    pthread_t thread;     // the p-thread of this worker
+} __attribute__((aligned(QF_CACHE_LINE_SIZE)));
+
+static QFWorker l_worker[QF_MAX_WORKERS];
+static uint_fast8_t l_nWorkers;      // number of workers in use
+static uint_fast16_t l_nStarted;     // number of AOs started so far
+static int32_t volatile l_nReady;    // number of AOs in all run queues
+static int32_t volatile l_nIdle;     // number of idle (blocked) workers
+static pthread_mutex_t l_idleMutex;  // mutex for blocking idle workers
+static pthread_cond_t  l_idleCond;   // cond. var. for blocking idle workers
+
+static void *worker_thread(void *arg); // thread routine for all workers
+static void workerUnlink(QFWorker * const wk, QActive * const act);
+static void tickWait(struct timespec *deadline); // see NOTE03
+
+//****************************************************************************
+void QF::init(void) {
+    // lock memory so we're never swapped out to disk
+    //mlockall(MCL_CURRENT | MCL_FUTURE); // uncomment when supported
+
+    // init the global mutex with the default non-recursive initializer
+    pthread_mutex_init(&QF_pThreadMutex_, NULL);
+
+    // clear the internal QF variables, so that the framework can (re)start
+    // correctly even if the startup code is not called to clear the
+    // uninitialized data (as is required by the C++ Standard).
+    extern uint_fast8_t QF_maxPool_;
+    QF_maxPool_ = static_cast<uint_fast8_t>(0);
+#if (QF_EPOOL_LUT_SIZE > 0)
+    bzero(&QF_poolLut_[0], static_cast<uint_fast16_t>(sizeof(QF_poolLut_)));
+#endif
+    bzero(&QF::timeEvtHead_[0],
+          static_cast<uint_fast16_t>(sizeof(QF::timeEvtHead_)));
+    bzero(&active_[0], static_cast<uint_fast16_t>(sizeof(active_)));
+
+    l_tick.tv_sec = 0;
+    l_tick.tv_nsec = NANOSLEEP_NSEC_PER_SEC/100L; // default clock tick
+    l_tickPrio = sched_get_priority_min(SCHED_FIFO); // default tick prio
+    bzero(&l_tickStats, static_cast<uint_fast16_t>(sizeof(l_tickStats)));
+    l_tickStats.latencyMin = static_cast<uint32_t>(0xFFFFFFFF);
+
+    // the default number of workers: one per online CPU
+    long nCpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (nCpus < 1L) {
+        nCpus = 1L;
+    }
+    else if (nCpus > static_cast<long>(QF_MAX_WORKERS)) {
+        nCpus = static_cast<long>(QF_MAX_WORKERS);
+    }
+    l_nWorkers = static_cast<uint_fast8_t>(nCpus);
+
+    for (uint_fast8_t w = static_cast<uint_fast8_t>(0);
+         w < static_cast<uint_fast8_t>(QF_MAX_WORKERS);
+         ++w)
+    {
+        pthread_mutex_init(&l_worker[w].lock, NULL);
+        l_worker[w].ready.setEmpty();
+        bzero(&l_worker[w].head[0],
+              static_cast<uint_fast16_t>(sizeof(l_worker[w].head)));
+        bzero(&l_worker[w].tail[0],
+              static_cast<uint_fast16_t>(sizeof(l_worker[w].tail)));
+        l_worker[w].top = static_cast<uint32_t>(0);
+    }
+    pthread_mutex_init(&l_idleMutex, NULL);
+    pthread_cond_init(&l_idleCond, 0);
+    l_nReady = static_cast<int32_t>(0);
+    l_nIdle  = static_cast<int32_t>(0);
+    l_nStarted = static_cast<uint_fast16_t>(0);
+    l_isStarted = false;
+}
+
+//****************************************************************************
+int_t QF::run(void) {
+    onStartup(); // invoke startup callback
+
+    l_isRunning = true; // QF is running
+
+    // start the worker threads...
+    for (uint_fast8_t w = static_cast<uint_fast8_t>(0); w < l_nWorkers; ++w)
+    {
+        Q_ALLEGE_ID(310, pthread_create(&l_worker[w].thread, 0,
+                             &worker_thread, &l_worker[w]) == 0);
+    }
+
+    // try to set the priority of the ticker thread
+    struct sched_param sparam;
+    sparam.sched_priority = l_tickPrio;
+    if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &sparam) == 0) {
+        // success, this application has sufficient privileges
+    }
+    else {
+        // setting priority failed, probably due to insufficient privieges
+    }
+
+    struct timespec deadline; // absolute deadline of the tick, NOTE03
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+
+    while (l_isRunning) { // the clock tick loop...
+        QF_onClockTick(); // clock tick callback (must call QF_TICK_X())
+
+        tickWait(&deadline); // sleep until the next tick, NOTE02, NOTE03
+    }
+
+    // wait for the workers to finish their current RTC steps
+    for (uint_fast8_t w = static_cast<uint_fast8_t>(0); w < l_nWorkers; ++w)
+    {
+        pthread_join(l_worker[w].thread, static_cast<void **>(0));
+    }
+
+    onCleanup(); // invoke cleanup callback
+    pthread_cond_destroy(&l_idleCond);
+    pthread_mutex_destroy(&l_idleMutex);
+    pthread_mutex_destroy(&QF_pThreadMutex_);
+    return static_cast<int_t>(0); // return success
+}
+//****************************************************************************
+void QF_setWorkers(uint_fast8_t const nWorkers) {
+    /// @pre the number of workers must be in range and it can be set only
+    /// before any active object is started
+    Q_REQUIRE_ID(200, (static_cast<uint_fast8_t>(0) < nWorkers)
+        && (nWorkers <= static_cast<uint_fast8_t>(QF_MAX_WORKERS))
+        && (!l_isStarted));
+    l_nWorkers = nWorkers;
+}
+//****************************************************************************
+void QF_setTickRate(uint32_t ticksPerSec, int_t tickPrio) {
+    Q_REQUIRE_ID(300, ticksPerSec != static_cast<uint32_t>(0));
+    {
+        // the tick period, see NOTE03
+        uint32_t const nsec = NANOSLEEP_NSEC_PER_SEC / ticksPerSec;
+        l_tick.tv_sec  = static_cast<time_t>(nsec / NANOSLEEP_NSEC_PER_SEC);
+        l_tick.tv_nsec = static_cast<long>(nsec % NANOSLEEP_NSEC_PER_SEC);
+    }
+    l_tickPrio = tickPrio;
+}
+//****************************************************************************
+// absolute-deadline tick engine, see NOTE03
+
+// the tick period in nanoseconds
+static int64_t tickPeriod(void) {
+    return static_cast<int64_t>(l_tick.tv_sec) * NANOSLEEP_NSEC_PER_SEC
+           + static_cast<int64_t>(l_tick.tv_nsec);
+}
+//............................................................................
+// add the given number of nanoseconds to the timespec @p t
+static void tickAdd(struct timespec *t, int64_t nsec) {
+    nsec += static_cast<int64_t>(t->tv_nsec);
+    t->tv_sec += static_cast<time_t>(nsec / NANOSLEEP_NSEC_PER_SEC);
+    t->tv_nsec = static_cast<long>(nsec % NANOSLEEP_NSEC_PER_SEC);
+}
+//............................................................................
+// wait for the next tick deadline and update the tick statistics
+static void tickWait(struct timespec *deadline) {
+    int64_t const period = tickPeriod();
+    tickAdd(deadline, period);
+
+    // sleep until the deadline (restart when interrupted by a signal)
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, deadline,
+                           static_cast<struct timespec *>(0)) == EINTR)
+    {}
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    int64_t late =
+        static_cast<int64_t>(now.tv_sec - deadline->tv_sec)
+            * NANOSLEEP_NSEC_PER_SEC
+        + static_cast<int64_t>(now.tv_nsec - deadline->tv_nsec);
+    if (late < static_cast<int64_t>(0)) { // woken up early?
+        late = static_cast<int64_t>(0);
+    }
+
+    // too many ticks missed? drop the excess beyond the catch-up limit
+    int64_t skipped = (late / period)
+                      - static_cast<int64_t>(QF_TICK_MAX_CATCHUP);
+    if (skipped > static_cast<int64_t>(0)) {
+        tickAdd(deadline, skipped * period);
+    }
+    else {
+        skipped = static_cast<int64_t>(0);
+    }
+
+    uint32_t const lat = (late < static_cast<int64_t>(0xFFFFFFFF))
+                         ? static_cast<uint32_t>(late)
+                         : static_cast<uint32_t>(0xFFFFFFFF);
+    QF_INT_DISABLE();
+    ++l_tickStats.nTicks;
+    if (late >= period) {
+        ++l_tickStats.nOverruns;
+    }
+    l_tickStats.nSkipped += static_cast<uint32_t>(skipped);
+    if (lat < l_tickStats.latencyMin) {
+        l_tickStats.latencyMin = lat;
+    }
+    if (lat > l_tickStats.latencyMax) {
+        l_tickStats.latencyMax = lat;
+    }
+    l_tickStats.latencySum += static_cast<uint64_t>(lat);
+    QF_INT_ENABLE();
+}
+//............................................................................
+uint32_t QF_queueTime_(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<uint32_t>(
+        (static_cast<uint64_t>(now.tv_sec) * static_cast<uint64_t>(1000000))
+        + static_cast<uint64_t>(now.tv_nsec / 1000)); // [us]
+}
+//............................................................................
+void QF_getTickStats(QFTickStats * const stats, bool const reset) {
+    QF_INT_DISABLE();
+    *stats = l_tickStats;
+    if (reset) {
+        QF::bzero(&l_tickStats,
+                  static_cast<uint_fast16_t>(sizeof(l_tickStats)));
+        l_tickStats.latencyMin = static_cast<uint32_t>(0xFFFFFFFF);
+    }
+    QF_INT_ENABLE();
+}
+//****************************************************************************
+void QF::stop(void) {
+    l_isRunning = false; // stop the tick loop and the workers
+
+    // unblock the idle workers so they can terminate
+    pthread_mutex_lock(&l_idleMutex);
+    pthread_cond_broadcast(&l_idleCond);
+    pthread_mutex_unlock(&l_idleMutex);
+}
+//****************************************************************************
+void QActive::start(QPrio const prio,
+                    QEvt const *qSto[], uint_fast16_t qLen,
+                    void *stkSto, uint_fast16_t /*stkSize*/,
+                    QEvt const *ie)
+{
+    Q_REQUIRE_ID(600, (static_cast<QPrio>(0) < prio) /* priority...*/
+        && (prio <= static_cast<QPrio>(QF_MAX_ACTIVE)) /*... in range */
+        && (stkSto == static_cast<void *>(0)));    /* statck storage must NOT...
+                                                    * ... be provided */
+    // spread the AOs over the run queues of the workers
+    m_osObject.m_next = static_cast<QActive *>(0);
+    m_osObject.m_prev = static_cast<QActive *>(0);
+    m_osObject.m_scheduled = static_cast<uint8_t>(0);
+    m_osObject.m_ready = static_cast<uint8_t>(0);
+    m_osObject.m_worker = static_cast<uint8_t>(l_nStarted % l_nWorkers);
+    m_osObject.m_stopped = static_cast<uint8_t>(0);
+    ++l_nStarted;
+    l_isStarted = true;
+
+    m_eQueue.init(qSto, qLen);
+    m_prio = prio; // set the QF priority of this AO
+
+    // the first AO at this priority owns the QF priority, see NOTE2
+    if (QF::active_[prio] == static_cast<QActive *>(0)) {
+        m_osObject.m_owner = static_cast<uint8_t>(1);
+        QF::add_(this); // make QF aware of this AO
+    }
+    else {
+        m_osObject.m_owner = static_cast<uint8_t>(0);
+    }
+    this->init(ie); // execute initial transition (virtual call)
+}
+//****************************************************************************
+// see NOTE2 in qf_port.h
+void QActive::stop(void) {
+    if (m_osObject.m_owner != static_cast<uint8_t>(0)) {
+        unsubscribeAll();
+    }
+
+    bool running = false;
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
+    m_osObject.m_stopped = static_cast<uint8_t>(1); // never schedule again
+    if (m_osObject.m_scheduled != static_cast<uint8_t>(0)) {
+        QFWorker * const wk = &l_worker[m_osObject.m_worker];
+
+        // still waiting in the run queue? take it out
+        pthread_mutex_lock(&wk->lock);
+        if (m_osObject.m_ready != static_cast<uint8_t>(0)) {
+            workerUnlink(wk, this);
+            (void)__atomic_sub_fetch(&l_nReady, 1, __ATOMIC_SEQ_CST);
+            m_osObject.m_scheduled = static_cast<uint8_t>(0);
+        }
+        else { // running on a worker, which will remove it from QF
+            running = true;
+        }
+        pthread_mutex_unlock(&wk->lock);
+    }
+    QF_CRIT_EXIT_();
+
+    if ((!running) && (m_osObject.m_owner != static_cast<uint8_t>(0))) {
+        QF::remove_(this);
+    }
+}
+
+//****************************************************************************
+// the pool of worker threads, see NOTE2 in qf_port.h
+
+// publish the highest ready priority of the run queue @p wk (under lock)
+static void workerTop(QFWorker * const wk) {
+    uint32_t const top = wk->ready.notEmpty()
+                         ? static_cast<uint32_t>(wk->ready.findMax())
+                         : static_cast<uint32_t>(0);
+    __atomic_store_n(&wk->top, top, __ATOMIC_RELAXED);
+}
+//............................................................................
+// take the AO @p act out of the run queue @p wk (under lock)
+static void workerUnlink(QFWorker * const wk, QActive * const act) {
+    QPrio const p = act->getPrio();
+    QActive * const next = act->m_osObject.m_next;
+    QActive * const prev = act->m_osObject.m_prev;
+
+    if (prev == static_cast<QActive *>(0)) {
+        wk->head[p] = next;
+    }
+    else {
+        prev->m_osObject.m_next = next;
+    }
+    if (next == static_cast<QActive *>(0)) {
+        wk->tail[p] = prev;
+    }
+    else {
+        next->m_osObject.m_prev = prev;
+    }
+    if (wk->head[p] == static_cast<QActive *>(0)) { // level empty?
+        wk->ready.remove(p);
+        workerTop(wk);
+    }
+    act->m_osObject.m_ready = static_cast<uint8_t>(0);
+}
+//............................................................................
+// place the AO @p act at the end of its priority level in the run queue of
+// the worker @p w (inside the QF critical section)
+static void workerPush(uint_fast8_t const w, QActive * const act) {
+    QFWorker * const wk = &l_worker[w];
+    QPrio const p = act->getPrio();
+
+    act->m_osObject.m_worker = static_cast<uint8_t>(w);
+    pthread_mutex_lock(&wk->lock);
+    act->m_osObject.m_next = static_cast<QActive *>(0);
+    act->m_osObject.m_prev = wk->tail[p];
+    if (wk->tail[p] == static_cast<QActive *>(0)) { // level empty?
+        wk->head[p] = act;
+        wk->ready.insert(p);
+        workerTop(wk);
+    }
+    else {
+        wk->tail[p]->m_osObject.m_next = act;
+    }
+    wk->tail[p] = act;
+    act->m_osObject.m_ready = static_cast<uint8_t>(1);
+    pthread_mutex_unlock(&wk->lock);
+
+    // wake up an idle worker, if any, see NOTE01
+    (void)__atomic_add_fetch(&l_nReady, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&l_nIdle, __ATOMIC_SEQ_CST) != 0) {
+        pthread_mutex_lock(&l_idleMutex);
+        pthread_cond_signal(&l_idleCond);
+        pthread_mutex_unlock(&l_idleMutex);
+    }
+}
+//............................................................................
+// take the first ready AO with the highest priority from the run queue of
+// the worker @p w, if any
+static QActive *workerPop(uint_fast8_t const w) {
+    QFWorker * const wk = &l_worker[w];
+    QActive *act = static_cast<QActive *>(0);
+
+    pthread_mutex_lock(&wk->lock);
+    if (wk->ready.notEmpty()) {
+        act = wk->head[wk->ready.findMax()];
+        workerUnlink(wk, act);
+    }
+    pthread_mutex_unlock(&wk->lock);
+
+    if (act != static_cast<QActive *>(0)) {
+        (void)__atomic_sub_fetch(&l_nReady, 1, __ATOMIC_SEQ_CST);
+    }
+    return act;
+}
+//............................................................................
+// take the ready AO with the highest priority from all run queues,
+// preferring the run queue of the worker @p self at equal priority, or
+// steal any ready AO from the other workers, see NOTE2 in qf_port.h
+static QActive *workerPick(uint_fast8_t const self) {
+    uint_fast8_t best = self;
+    uint32_t bestTop = __atomic_load_n(&l_worker[self].top, __ATOMIC_RELAXED);
+    for (uint_fast8_t w = static_cast<uint_fast8_t>(0); w < l_nWorkers; ++w)
+    {
+        uint32_t const top = __atomic_load_n(&l_worker[w].top,
+                                             __ATOMIC_RELAXED);
+        if (top > bestTop) {
+            best = w;
+            bestTop = top;
+        }
+    }
+
+    QActive *act = workerPop(best);
+
+    // the chosen run queue has been emptied meanwhile? take any ready AO
+    uint_fast8_t w = self;
+    for (uint_fast8_t n = static_cast<uint_fast8_t>(0);
+         (act == static_cast<QActive *>(0)) && (n < l_nWorkers);
+         ++n)
+    {
+        act = workerPop(w);
+
+        ++w; // try the next worker
+        if (w == l_nWorkers) {
+            w = static_cast<uint_fast8_t>(0);
+        }
+    }
+    return act; // NULL if nothing to run
+}
+//............................................................................
+// block the idle worker until any AO becomes ready or QF is stopped
+static void workerIdle(void) {
+    pthread_mutex_lock(&l_idleMutex);
+    (void)__atomic_add_fetch(&l_nIdle, 1, __ATOMIC_SEQ_CST);
+    while (l_isRunning
+           && (__atomic_load_n(&l_nReady, __ATOMIC_SEQ_CST) <= 0))
+    {
+        pthread_cond_wait(&l_idleCond, &l_idleMutex);
+    }
+    (void)__atomic_sub_fetch(&l_nIdle, 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&l_idleMutex);
+}
+//............................................................................
+static void *worker_thread(void *arg) { // the expected POSIX signature
+    uint_fast8_t const self = static_cast<uint_fast8_t>(
+        static_cast<QFWorker *>(arg) - &l_worker[0]);
+
+    while (l_isRunning) {
+        QActive *a = workerPick(self);
+        if (a == static_cast<QActive *>(0)) { // nothing to run?
+            workerIdle();
+        }
+        else {
+            // perform the run-to-completion (RTC) step...
+            // 1. retrieve the event from the AO's event queue, which by this
+            //    time must be non-empty (asserted in QACTIVE_EQUEUE_WAIT_()).
+            // 2. dispatch the event to the AO's state machine.
+            // 3. determine if event is garbage and collect it if so
+            //
+            QEvt const *e = a->get_();
+            a->dispatch(e);
+            QF::gc(e);
+
+            QF_CRIT_STAT_
+            QF_CRIT_ENTRY_();
+            bool const stopped =
+                (a->m_osObject.m_stopped != static_cast<uint8_t>(0));
+            // more events for this AO (that is not stopped)?
+            if ((!stopped) && (!a->m_eQueue.isEmpty())) {
+                // keep it in the run queue of this worker (cache affinity)
+                workerPush(self, a);
+            }
+            else {
+                a->m_osObject.m_scheduled = static_cast<uint8_t>(0);
+            }
+            QF_CRIT_EXIT_();
+
+            // stopped during this RTC step? finish QActive::stop()
+            if (stopped && (a->m_osObject.m_owner != static_cast<uint8_t>(0)))
+            {
+                QF::remove_(a);
+            }
+        }
+    }
+    return static_cast<void *>(0); // return success
+}
+//............................................................................
+// called by QACTIVE_EQUEUE_SIGNAL_() inside the critical section
+void QF_schedule_(QActive * const act) {
+    if ((act->m_osObject.m_scheduled == static_cast<uint8_t>(0))
+        && (act->m_osObject.m_stopped == static_cast<uint8_t>(0)))
+    {
+        act->m_osObject.m_scheduled = static_cast<uint8_t>(1);
+        workerPush(static_cast<uint_fast8_t>(act->m_osObject.m_worker)
+                       % l_nWorkers,
+                   act);
+    }
+}
+
+} // namespace QP
+
+//****************************************************************************
+// NOTE01:
+// The workers that find all run queues empty block on the condition
+// variable l_idleCond. The counter of the ready AOs (l_nReady) and the
+// counter of the idle workers (l_nIdle) are sequentially-consistent
+// atomics: a producer increments l_nReady before it checks l_nIdle, and
+// an idle worker increments l_nIdle (holding l_idleMutex) before it checks
+// l_nReady. Therefore either the producer sees the idle worker and signals
+// it (under l_idleMutex) or the worker sees the ready AO and does not
+// block, so a wake-up is never lost.
+//
+// NOTE02:
+// In some (older) Linux kernels, the POSIX nanosleep() system call might
+// deliver only 2*actual-system-tick granularity. To compensate for this,
+// you would need to reduce (by 2) the constant NANOSLEEP_NSEC_PER_SEC.
+//
+// NOTE03:
+// The clock tick uses absolute deadlines on CLOCK_MONOTONIC: the deadline
+// of every tick is the deadline of the previous tick plus the tick period,
+// and the ticker sleeps with clock_nanosleep(TIMER_ABSTIME). The time spent
+// in QF_onClockTick() and any scheduling delays therefore don't accumulate
+// into drift. When the ticker wakes up after the deadline of the next tick
+// already passed (an overrun), the missed ticks are generated immediately
+// one after another (catch-up), but at most QF_TICK_MAX_CATCHUP of them;
+// the rest are dropped and counted in QFTickStats::nSkipped. The lateness
+// of every tick relative to its deadline is collected in QFTickStats,
+// see QF_getTickStats().
+//
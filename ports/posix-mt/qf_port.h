@@ -0,0 +1,268 @@
+/// @file
+/// @brief QF/C++ port to POSIX API with a pool of worker threads (posix-mt)
+/// @cond
+///***************************************************************************
+/// Last updated for version 6.3.4
+/// Last updated on  2018-09-04
+///
+///                    Q u a n t u m     L e a P s
+///                    ---------------------------
+///                    innovating embedded systems
+///
+/// Copyright (C) Quantum Leaps, LLC. All rights reserved.
+///
+/// This program is open source software: you can redistribute it and/or
+/// modify it under the terms of the GNU General Public License as published
+/// by the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Alternatively, this program may be distributed and modified under the
+/// terms of Quantum Leaps commercial licenses, which expressly supersede
+/// the GNU General Public License and are specifically designed for
+/// licensees interested in retaining the proprietary status of their code.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program. If not, see <http://www.gnu.org/licenses/>.
+///
+/// Contact information:
+/// https://www.state-machine.com
+/// mailto:info@state-machine.com
+///***************************************************************************
+/// @endcond
+
+#ifndef qf_port_h
+#define qf_port_h
+
+// event queue and thread types
+#define QF_EQUEUE_TYPE       QEQueue
+#define QF_OS_OBJECT_TYPE    QFTask
+//#define QF_THREAD_TYPE     // not provided
+
+// the size of the CPU cache line (to avoid false sharing)
+#define QF_CACHE_LINE_SIZE   64
+
+#ifndef QF_MAX_ACTIVE
+// The number of priority levels (any number of AOs per level, see NOTE2)
+#define QF_MAX_ACTIVE        252
+#endif
+
+// The number of system clock tick rates
+#define QF_MAX_TICK_RATE     2
+
+// The maximum number of event pools and the size of the lookup table from
+// the event size to the event pool (events up to 64*sizeof(void*) bytes)
+#define QF_MAX_EPOOL         32
+#define QF_EPOOL_LUT_SIZE    64
+
+// The maximum number of payload buffer pools (zero-copy events)
+#define QF_MAX_BPOOL         8
+
+// The maximum number of worker threads
+#define QF_MAX_WORKERS       16
+
+// various QF object sizes configuration for this port
+#define QF_EVENT_SIZ_SIZE    4
+#define QF_EQUEUE_CTR_SIZE   4
+#define QF_MPOOL_SIZ_SIZE    4
+#define QF_MPOOL_CTR_SIZE    4
+#define QF_TIMEEVT_CTR_SIZE  4
+
+/* QF interrupt disable/enable, see NOTE1 */
+#define QF_INT_DISABLE()     pthread_mutex_lock(&QP::QF_pThreadMutex_)
+#define QF_INT_ENABLE()      pthread_mutex_unlock(&QP::QF_pThreadMutex_)
+
+// QF critical section entry/exit for POSIX, see NOTE1
+// QF_CRIT_STAT_TYPE not defined
+#define QF_CRIT_ENTRY(dummy) QF_INT_DISABLE()
+#define QF_CRIT_EXIT(dummy)  QF_INT_ENABLE()
+
+// QF_LOG2 with the GCC/Clang bit-scan builtin. The argument of
+// __builtin_clzll() is never zero, so QF_LOG2(0) is zero, as required
+#ifdef __GNUC__
+#define QF_LOG2(n_) (static_cast<uint_fast8_t>(63U \
+    - static_cast<uint_fast8_t>(__builtin_clzll( \
+        (static_cast<uint64_t>(n_) << 1) | static_cast<uint64_t>(1)))))
+#endif
+
+// the timestamp of the queue telemetry (QF_QUEUE_HIST_SIZE) in [us]
+#define QF_QUEUE_TIME()      (QP::QF_queueTime_())
+
+#include <pthread.h>   // POSIX-thread API
+#include "qep_port.h"  // QEP port
+#include "qequeue.h"   // POSIX-MT needs event-queue
+#include "qmpool.h"    // POSIX-MT needs memory-pool
+#include "qpset.h"     // POSIX-MT needs priority-set
+
+namespace QP {
+
+class QActive; // forward declaration
+
+//! Scheduling state of an active object in the pool of worker threads
+/// @description
+/// The links and m_ready are accessed only under the mutex of the run
+/// queue of the worker m_worker, all other members only inside the QF
+/// critical section, see NOTE2.
+struct QFTask {
+    //! the next AO of the same priority in the run queue
+    QActive *m_next;
+
+    //! the previous AO of the same priority in the run queue
+    QActive *m_prev;
+
+    //! non-zero when the AO is in a run queue or runs on a worker
+    uint8_t m_scheduled;
+
+    //! non-zero when the AO waits in a run queue (does not run)
+    uint8_t m_ready;
+
+    //! the worker whose run queue the AO is placed in (last worker)
+    uint8_t m_worker;
+
+    //! non-zero when the AO has been stopped, see NOTE2
+    uint8_t m_stopped;
+
+    //! non-zero when the AO owns its QF priority (QF::add_()), see NOTE2
+    uint8_t m_owner;
+};
+
+} // namespace QP
+
+#include "qf.h"        // QF platform-independent public interface
+
+namespace QP {
+
+// set the number of worker threads (before starting any active objects)
+void QF_setWorkers(uint_fast8_t const nWorkers);
+
+// set clock tick rate and p-thread priority
+void QF_setTickRate(uint32_t ticksPerSec, int_t tickPrio);
+
+// clock tick callback (provided in the app)
+void QF_onClockTick(void);
+
+// clock tick statistics (see QF_getTickStats()), all times in [ns]
+struct QFTickStats {
+    uint32_t nTicks;     // number of clock ticks generated
+    uint32_t nOverruns;  // ticks late by one tick period or more
+    uint32_t nSkipped;   // ticks dropped beyond QF_TICK_MAX_CATCHUP
+    uint32_t latencyMin; // minimum lateness of a tick vs. its deadline
+    uint32_t latencyMax; // maximum lateness of a tick vs. its deadline
+    uint64_t latencySum; // sum of the lateness (for the average)
+};
+
+// obtain (and optionally reset) the clock tick statistics
+void QF_getTickStats(QFTickStats * const stats, bool const reset);
+
+// monotonic time in [us] modulo 2^32 (QF_QUEUE_TIME())
+uint32_t QF_queueTime_(void);
+
+extern pthread_mutex_t QF_pThreadMutex_; // mutex for QF critical section
+
+} // namespace QP
+
+//****************************************************************************
+// interface used only inside QF implementation, but not in applications
+//
+#ifdef QP_IMPL
+
+    // scheduler locking (not used at this point)
+    #define QF_SCHED_STAT_
+    #define QF_SCHED_LOCK_(dummy) ((void)0)
+    #define QF_SCHED_UNLOCK_()    ((void)0)
+
+    // event queue operations...
+    #define QACTIVE_EQUEUE_WAIT_(me_) \
+        Q_ASSERT((me_)->m_eQueue.m_frontEvt != static_cast<QEvt const *>(0))
+
+    // place the AO in a run queue, see NOTE2
+    #define QACTIVE_EQUEUE_SIGNAL_(me_) QF_schedule_((me_))
+
+    // event pool operations...
+    #define QF_EPOOL_TYPE_  QMPool
+
+    #define QF_EPOOL_INIT_(p_, poolSto_, poolSize_, evtSize_) \
+        (p_).init((poolSto_), (poolSize_), (evtSize_))
+
+    #define QF_EPOOL_EVENT_SIZE_(p_)  ((p_).getBlockSize())
+    #define QF_EPOOL_GET_(p_, e_, m_) \
+        ((e_) = static_cast<QEvt *>((p_).get((m_))))
+    #define QF_EPOOL_PUT_(p_, e_)     ((p_).put(e_))
+    #define QF_EPOOL_GET_N_(p_, chain_, n_, m_) \
+        ((chain_) = (p_).getN((n_), (m_)))
+    #define QF_EPOOL_PUT_N_(p_, chain_, n_) ((p_).putN((chain_), (n_)))
+
+    namespace QP {
+        // make the AO ready to run on a worker (in critical section)
+        void QF_schedule_(QActive * const act);
+    } // namespace QP
+
+#endif // QP_IMPL
+
+// NOTES: ====================================================================
+//
+// NOTE1:
+// QF, like all real-time frameworks, needs to execute certain sections of
+// code indivisibly to avoid data corruption. The most straightforward way of
+// protecting such critical sections of code is disabling and enabling
+// interrupts, which the POSIX API does not allow.
+//
+// This QF port uses therefore a single package-scope p-thread mutex
+// QF_pThreadMutex_ to protect all critical sections. The mutex is locked upon
+// the entry to each critical section and unlocked upon exit.
+//
+// Using the single mutex for all crtical section guarantees that only one
+// thread at a time can execute inside a critical section. This prevents race
+// conditions and data corruption. The state machines of the active objects
+// are executed outside of the critical section, so the worker threads run
+// them in parallel.
+//
+// NOTE2:
+// The active objects do not have their own threads. Instead, a fixed pool
+// of worker threads (QF_setWorkers()) executes the run-to-completion steps
+// of the active objects. Every worker has its own run queue, protected by
+// its own mutex: a FIFO list of the ready active objects per priority level
+// (linked through QFTask::m_next/m_prev) and a priority set of the levels
+// with any ready active objects. The run queues hold any number of active
+// objects, so the port scales to thousands of (mostly idle) active objects.
+//
+// Many active objects can share a priority level. The first active object
+// started at a given priority owns that QF priority (QFTask::m_owner): it
+// is registered with QF::add_(), so it can subscribe to the published
+// events and it can be queried with QF::getQueueMin(). The other active
+// objects at the same priority are scheduled the same way, but they are
+// not registered in QF, so they receive only the events posted to them
+// directly (e.g., POST() or the time events) and must not subscribe.
+//
+// When an event is posted to an empty event queue, QACTIVE_EQUEUE_SIGNAL_()
+// places the active object at the end of its priority list in the run
+// queue of the worker that ran it last (QFTask::m_worker), unless the
+// active object is already in a run queue or is running
+// (QFTask::m_scheduled). Every worker publishes the highest priority in
+// its run queue in an atomic word (QFWorker::top). Before a worker runs the
+// next active object, it compares the top priority of its own run queue
+// with the top priorities of the other run queues and takes the active
+// object with the highest priority, preferring its own run queue at equal
+// priority (cache affinity). An idle worker thus steals work from the
+// others, and a busy worker runs a higher-priority active object waiting
+// in another run queue before its own lower-priority ones. The top
+// priorities are read without locking, so this global priority order is
+// best-effort: a posting that races with the choice is seen only at the
+// next choice. After each run-to-completion step, the worker places the
+// active object back to its own run queue if more events are waiting,
+// otherwise it clears the m_scheduled flag. Because an active object is
+// never in more than one run queue and never runs on more than one worker,
+// its events are processed one at a time and in the FIFO order.
+//
+// QActive::stop() sets the m_stopped flag, so that the active object is
+// never placed in a run queue again. If the active object waits in a run
+// queue, it is unlinked and removed from QF right away. If it runs on a
+// worker (including the case when it stops itself), the worker removes it
+// from QF only after finishing the current run-to-completion step.
+//
+
+#endif // qf_port_h
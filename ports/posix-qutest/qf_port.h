@@ -49,6 +49,14 @@
 // The number of system clock tick rates
 #define QF_MAX_TICK_RATE     2
 
+// The maximum number of event pools and the size of the lookup table from
+// the event size to the event pool (events up to 64*sizeof(void*) bytes)
+#define QF_MAX_EPOOL         32
+#define QF_EPOOL_LUT_SIZE    64
+
+// The maximum number of payload buffer pools (zero-copy events)
+#define QF_MAX_BPOOL         8
+
 // QF interrupt disable/enable
 #define QF_INT_DISABLE()     (++QP::QF_intNest)
 #define QF_INT_ENABLE()      (--QP::QF_intNest)
@@ -58,7 +66,13 @@
 #define QF_CRIT_ENTRY(dummy) QF_INT_DISABLE()
 #define QF_CRIT_EXIT(dummy)  QF_INT_ENABLE()
 
-// QF_LOG2 not defined -- use the internal LOG2() implementation
+// QF_LOG2 with the GCC/Clang bit-scan builtin. The argument of
+// __builtin_clzll() is never zero, so QF_LOG2(0) is zero, as required
+#ifdef __GNUC__
+#define QF_LOG2(n_) (static_cast<uint_fast8_t>(63U \
+    - static_cast<uint_fast8_t>(__builtin_clzll( \
+        (static_cast<uint64_t>(n_) << 1) | static_cast<uint64_t>(1)))))
+#endif
 
 #include "qep_port.h"  // QEP port
 #include "qequeue.h"   // QUTEST port uses QEQueue event-queue
@@ -91,6 +105,9 @@ extern uint8_t volatile QF_intNest;
     #define QF_EPOOL_GET_(p_, e_, m_) \
         ((e_) = static_cast<QEvt *>((p_).get((m_))))
     #define QF_EPOOL_PUT_(p_, e_)     ((p_).put(e_))
+    #define QF_EPOOL_GET_N_(p_, chain_, n_, m_) \
+        ((chain_) = (p_).getN((n_), (m_)))
+    #define QF_EPOOL_PUT_N_(p_, chain_, n_) ((p_).putN((chain_), (n_)))
 
 #endif // QP_IMPL
 
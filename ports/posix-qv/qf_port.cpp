@@ -45,6 +45,9 @@
     #include "qs_dummy.h" // disable the QS software tracing
 #endif // Q_SPY
 
+#include <errno.h>        // for EINTR
+#include <time.h>         // for clock_nanosleep()
+
 namespace QP {
 
 Q_DEFINE_THIS_MODULE("qf_port")
@@ -56,11 +59,32 @@ pthread_cond_t QV_condVar_; // Cond.var. to signal events
 
 // Local objects *************************************************************
 static bool l_isRunning;    // flag indicating when QF is running
-static struct timespec l_tick;
+static struct timespec l_tick; // tick period
+static QFTickStats l_tickStats; // tick statistics
 static int_t l_tickPrio;
 enum { NANOSLEEP_NSEC_PER_SEC = 1000000000 }; // see NOTE05
 
+// maximum number of missed clock ticks to catch up, see NOTE06
+#ifndef QF_TICK_MAX_CATCHUP
+#define QF_TICK_MAX_CATCHUP 10
+#endif
+
 static void *ticker_thread(void *arg);
+#ifndef QF_POSIX_TICKLESS
+static void tickWait(struct timespec *deadline); // see NOTE06
+#endif
+#ifdef QF_POSIX_TICKLESS
+static struct timespec l_ticklessOrigin; // the time of the tick #0, NOTE07
+static uint64_t l_tickApplied[QF_MAX_TICK_RATE]; // last tick applied
+static uint64_t l_ticklessNext;       // the next tick planned by the ticker
+static bool l_ticklessPlanning;       // the ticker is planning the next tick
+static bool l_ticklessReplan;         // the next tick must be re-planned
+static bool l_ticklessPending; // l_ticklessNext not delivered to QF yet
+static pthread_mutex_t l_ticklessMutex;
+static pthread_cond_t  l_ticklessCond;
+static uint64_t const TICKLESS_NONE = ~static_cast<uint64_t>(0);
+static void ticklessLoop(void);
+#endif // QF_POSIX_TICKLESS
 
 //****************************************************************************
 void QF::init(void) {
@@ -75,6 +99,9 @@ void QF::init(void) {
     // uninitialized data (as is required by the C++ Standard).
     extern uint_fast8_t QF_maxPool_;
     QF_maxPool_ = static_cast<uint_fast8_t>(0);
+#if (QF_EPOOL_LUT_SIZE > 0)
+    bzero(&QF_poolLut_[0], static_cast<uint_fast16_t>(sizeof(QF_poolLut_)));
+#endif
     bzero(&QF::timeEvtHead_[0],
           static_cast<uint_fast16_t>(sizeof(QF::timeEvtHead_)));
     bzero(&active_[0], static_cast<uint_fast16_t>(sizeof(active_)));
@@ -82,6 +109,23 @@ void QF::init(void) {
     l_tick.tv_sec = 0;
     l_tick.tv_nsec = NANOSLEEP_NSEC_PER_SEC/100L; // default clock tick
     l_tickPrio = sched_get_priority_min(SCHED_FIFO); // default tick prio
+    bzero(&l_tickStats, static_cast<uint_fast16_t>(sizeof(l_tickStats)));
+    l_tickStats.latencyMin = static_cast<uint32_t>(0xFFFFFFFF);
+
+#ifdef QF_POSIX_TICKLESS
+    pthread_mutex_init(&l_ticklessMutex, NULL);
+    pthread_condattr_t cattr;
+    pthread_condattr_init(&cattr);
+    pthread_condattr_setclock(&cattr, CLOCK_MONOTONIC); // see NOTE07
+    pthread_cond_init(&l_ticklessCond, &cattr);
+    pthread_condattr_destroy(&cattr);
+    bzero(&l_tickApplied[0],
+          static_cast<uint_fast16_t>(sizeof(l_tickApplied)));
+    l_ticklessNext = static_cast<uint64_t>(0);
+    l_ticklessPlanning = false;
+    l_ticklessReplan = false;
+    l_ticklessPending = false;
+#endif // QF_POSIX_TICKLESS
 }
 
 //****************************************************************************
@@ -138,7 +182,7 @@ int_t QF::run(void) {
     while (l_isRunning) {
 
         if (QV_readySet_.notEmpty()) {
-            uint_fast8_t p = QV_readySet_.findMax();
+            QPrio p = QV_readySet_.findMax();
             QActive *a = active_[p];
             QF_INT_ENABLE();
 
@@ -185,34 +229,292 @@ int_t QF::run(void) {
 //****************************************************************************
 void QF_setTickRate(uint32_t ticksPerSec, int_t tickPrio) {
     if (ticksPerSec != static_cast<uint32_t>(0)) {
-        l_tick.tv_nsec = NANOSLEEP_NSEC_PER_SEC / ticksPerSec;
+        // the tick period, see NOTE06
+        uint32_t const nsec = NANOSLEEP_NSEC_PER_SEC / ticksPerSec;
+        l_tick.tv_sec  = static_cast<time_t>(nsec / NANOSLEEP_NSEC_PER_SEC);
+        l_tick.tv_nsec = static_cast<long>(nsec % NANOSLEEP_NSEC_PER_SEC);
     }
     else {
+        l_tick.tv_sec  = 0;
         l_tick.tv_nsec = 0; /* means NO system clock tick */
     }
     l_tickPrio = tickPrio;
 }
 //****************************************************************************
+// absolute-deadline tick engine, see NOTE06
+
+// the tick period in nanoseconds
+static int64_t tickPeriod(void) {
+    return static_cast<int64_t>(l_tick.tv_sec) * NANOSLEEP_NSEC_PER_SEC
+           + static_cast<int64_t>(l_tick.tv_nsec);
+}
+//............................................................................
+// add the given number of nanoseconds to the timespec @p t
+static void tickAdd(struct timespec *t, int64_t nsec) {
+    nsec += static_cast<int64_t>(t->tv_nsec);
+    t->tv_sec += static_cast<time_t>(nsec / NANOSLEEP_NSEC_PER_SEC);
+    t->tv_nsec = static_cast<long>(nsec % NANOSLEEP_NSEC_PER_SEC);
+}
+//............................................................................
+// the lateness [ns] of the current time relative to the @p deadline
+static int64_t tickLate(struct timespec const *deadline) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    int64_t late =
+        static_cast<int64_t>(now.tv_sec - deadline->tv_sec)
+            * NANOSLEEP_NSEC_PER_SEC
+        + static_cast<int64_t>(now.tv_nsec - deadline->tv_nsec);
+    if (late < static_cast<int64_t>(0)) { // woken up early?
+        late = static_cast<int64_t>(0);
+    }
+    return late;
+}
+//............................................................................
+// update the tick statistics with one tick
+static void tickStatsUpdate(int64_t const late, int64_t const skipped) {
+    uint32_t const lat = (late < static_cast<int64_t>(0xFFFFFFFF))
+                         ? static_cast<uint32_t>(late)
+                         : static_cast<uint32_t>(0xFFFFFFFF);
+    QF_INT_DISABLE();
+    ++l_tickStats.nTicks;
+    if (late >= tickPeriod()) {
+        ++l_tickStats.nOverruns;
+    }
+    l_tickStats.nSkipped += static_cast<uint32_t>(skipped);
+    if (lat < l_tickStats.latencyMin) {
+        l_tickStats.latencyMin = lat;
+    }
+    if (lat > l_tickStats.latencyMax) {
+        l_tickStats.latencyMax = lat;
+    }
+    l_tickStats.latencySum += static_cast<uint64_t>(lat);
+    QF_INT_ENABLE();
+}
+#ifndef QF_POSIX_TICKLESS
+//............................................................................
+// wait for the next tick deadline and update the tick statistics
+static void tickWait(struct timespec *deadline) {
+    int64_t const period = tickPeriod();
+    tickAdd(deadline, period);
+
+    // sleep until the deadline (restart when interrupted by a signal)
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, deadline,
+                           static_cast<struct timespec *>(0)) == EINTR)
+    {}
+
+    int64_t const late = tickLate(deadline);
+
+    // too many ticks missed? drop the excess beyond the catch-up limit
+    int64_t skipped = (late / period)
+                      - static_cast<int64_t>(QF_TICK_MAX_CATCHUP);
+    if (skipped > static_cast<int64_t>(0)) {
+        tickAdd(deadline, skipped * period);
+    }
+    else {
+        skipped = static_cast<int64_t>(0);
+    }
+    tickStatsUpdate(late, skipped);
+}
+#endif // QF_POSIX_TICKLESS
+//............................................................................
+uint32_t QF_queueTime_(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<uint32_t>(
+        (static_cast<uint64_t>(now.tv_sec) * static_cast<uint64_t>(1000000))
+        + static_cast<uint64_t>(now.tv_nsec / 1000)); // [us]
+}
+//............................................................................
+void QF_getTickStats(QFTickStats * const stats, bool const reset) {
+    QF_INT_DISABLE();
+    *stats = l_tickStats;
+    if (reset) {
+        QF::bzero(&l_tickStats,
+                  static_cast<uint_fast16_t>(sizeof(l_tickStats)));
+        l_tickStats.latencyMin = static_cast<uint32_t>(0xFFFFFFFF);
+    }
+    QF_INT_ENABLE();
+}
+
+#ifdef QF_POSIX_TICKLESS
+//****************************************************************************
+// tickless clock tick engine, see NOTE07
+
+// the deadline of the clock tick with the given index
+static void ticklessDeadline(struct timespec *deadline, uint64_t const tick) {
+    *deadline = l_ticklessOrigin;
+    tickAdd(deadline, static_cast<int64_t>(tick) * tickPeriod());
+}
+//............................................................................
+// the index of the last clock tick whose deadline has already passed
+static uint64_t ticklessNow(void) {
+    int64_t const late = tickLate(&l_ticklessOrigin);
+    return static_cast<uint64_t>(late / tickPeriod());
+}
+//............................................................................
+// called from QTimeEvt::armX()/rearm() inside the critical section of the
+// time events at the given tick rate, see NOTE07
+void QF_ticklessArm_(uint_fast8_t const tickRate, QTimeEvtCtr const nTicks) {
+    pthread_mutex_lock(&l_ticklessMutex);
+    if (l_ticklessPlanning
+        || (l_ticklessNext != static_cast<uint64_t>(0))) // ticker running?
+    {
+        // bring the time events up to date with the ticks skipped so far,
+        // but leave the tick planned by the ticker to the ticker until it
+        // has been delivered through QF_onClockTick() (even if the ticker
+        // has already woken up for it)
+        uint64_t now = ticklessNow();
+        if (l_ticklessPending && (now >= l_ticklessNext)) {
+            now = (l_ticklessNext != static_cast<uint64_t>(0))
+                  ? (l_ticklessNext - static_cast<uint64_t>(1))
+                  : static_cast<uint64_t>(0);
+        }
+        if (now > l_tickApplied[tickRate]) {
+            QF::tickAdvance_(tickRate,
+                static_cast<QTimeEvtCtr>(now - l_tickApplied[tickRate]));
+            l_tickApplied[tickRate] = now;
+        }
+
+        // expires before the planned tick? make the ticker re-plan
+        if (l_ticklessPlanning
+            || ((l_tickApplied[tickRate] + static_cast<uint64_t>(nTicks))
+                < l_ticklessNext))
+        {
+            l_ticklessReplan = true;
+            pthread_cond_signal(&l_ticklessCond);
+        }
+    }
+    pthread_mutex_unlock(&l_ticklessMutex);
+}
+//............................................................................
+// the tickless clock tick loop, see NOTE07
+static void ticklessLoop(void) {
+    pthread_mutex_lock(&l_ticklessMutex);
+    clock_gettime(CLOCK_MONOTONIC, &l_ticklessOrigin);
+    l_ticklessPlanning = true;
+    l_ticklessPending = true; // tick 0 is delivered first
+    pthread_mutex_unlock(&l_ticklessMutex);
+
+    uint64_t tick = static_cast<uint64_t>(0);
+    while (l_isRunning) {
+        QF_CRIT_STAT_
+        uint_fast8_t tickRate;
+
+        // apply the skipped ticks and leave this tick to QF_onClockTick()
+        for (tickRate = static_cast<uint_fast8_t>(0);
+             tickRate < static_cast<uint_fast8_t>(QF_MAX_TICK_RATE);
+             ++tickRate)
+        {
+            QF_CRIT_OBJ_ENTRY_(&QF_timeEvtCrit_[tickRate]);
+            if (tick > l_tickApplied[tickRate] + static_cast<uint64_t>(1)) {
+                QF::tickAdvance_(tickRate, static_cast<QTimeEvtCtr>(
+                    tick - l_tickApplied[tickRate] - static_cast<uint64_t>(1)));
+            }
+            if (tick > l_tickApplied[tickRate]) {
+                l_tickApplied[tickRate] = tick;
+            }
+            QF_CRIT_EXIT_();
+        }
+
+        QF_onClockTick(); // clock tick callback (must call QF_TICK_X())
+
+        pthread_mutex_lock(&l_ticklessMutex);
+        l_ticklessPending = false; // the tick has been delivered
+        pthread_mutex_unlock(&l_ticklessMutex);
+
+        // plan the next tick: the nearest expiration of a time event
+        uint64_t next;
+        bool replan;
+        do {
+            next = TICKLESS_NONE;
+            for (tickRate = static_cast<uint_fast8_t>(0);
+                 tickRate < static_cast<uint_fast8_t>(QF_MAX_TICK_RATE);
+                 ++tickRate)
+            {
+                QF_CRIT_OBJ_ENTRY_(&QF_timeEvtCrit_[tickRate]);
+                QTimeEvtCtr const n = QF::tickNearest_(tickRate);
+                if ((n != static_cast<QTimeEvtCtr>(0))
+                    && ((l_tickApplied[tickRate] + static_cast<uint64_t>(n))
+                        < next))
+                {
+                    next = l_tickApplied[tickRate] + static_cast<uint64_t>(n);
+                }
+                QF_CRIT_EXIT_();
+            }
+
+            pthread_mutex_lock(&l_ticklessMutex);
+            if (!l_ticklessReplan) { // nothing armed while planning?
+                l_ticklessPlanning = false;
+                l_ticklessNext = next;
+                l_ticklessPending = true;
+
+                // sleep until the next tick, re-plan or stop
+                struct timespec deadline;
+                ticklessDeadline(&deadline, next);
+                int err = 0;
+                while ((!l_ticklessReplan) && l_isRunning
+                       && (err != ETIMEDOUT))
+                {
+                    if (next == TICKLESS_NONE) { // no time events armed?
+                        err = pthread_cond_wait(&l_ticklessCond,
+                                                &l_ticklessMutex);
+                    }
+                    else {
+                        err = pthread_cond_timedwait(&l_ticklessCond,
+                                                     &l_ticklessMutex,
+                                                     &deadline);
+                    }
+                }
+            }
+            replan = l_ticklessReplan;
+            if (replan) {
+                l_ticklessReplan = false;
+                l_ticklessPlanning = true;
+            }
+            pthread_mutex_unlock(&l_ticklessMutex);
+        } while (replan && l_isRunning);
+
+        if (l_isRunning) {
+            struct timespec deadline;
+            ticklessDeadline(&deadline, next);
+            tickStatsUpdate(tickLate(&deadline), static_cast<int64_t>(0));
+
+            pthread_mutex_lock(&l_ticklessMutex);
+            l_ticklessPlanning = true; // until the next tick is planned
+            pthread_mutex_unlock(&l_ticklessMutex);
+            tick = next;
+        }
+    }
+}
+#endif // QF_POSIX_TICKLESS
+//****************************************************************************
 void QF::stop(void) {
     l_isRunning = false; // terminate the main event-loop thread
 
     // unblock the event-loop so it can terminate
     QV_readySet_.insert(1);
     pthread_cond_signal(&QV_condVar_);
+
+#ifdef QF_POSIX_TICKLESS
+    // unblock the tickless ticker so it can terminate
+    pthread_mutex_lock(&l_ticklessMutex);
+    pthread_cond_signal(&l_ticklessCond);
+    pthread_mutex_unlock(&l_ticklessMutex);
+#endif
 }
 //****************************************************************************
-void QActive::start(uint_fast8_t prio,
+void QActive::start(QPrio const prio,
                     QEvt const *qSto[], uint_fast16_t qLen,
                     void *stkSto, uint_fast16_t /*stkSize*/,
                     QEvt const *ie)
 {
-    Q_REQUIRE_ID(600, (static_cast<uint_fast8_t>(0) < prio) /* priority...*/
-        && (prio <= static_cast<uint_fast8_t>(QF_MAX_ACTIVE)) /*... in range */
+    Q_REQUIRE_ID(600, (static_cast<QPrio>(0) < prio) /* priority...*/
+        && (prio <= static_cast<QPrio>(QF_MAX_ACTIVE)) /*... in range */
         && (stkSto == static_cast<void *>(0)));    /* statck storage must NOT...
                                                     * ... be provided */
 
     m_eQueue.init(qSto, qLen);
-    m_prio = static_cast<uint8_t>(prio); // set the QF priority of this AO
+    m_prio = prio; // set the QF priority of this AO
     QF::add_(this); // make QF aware of this AO
     this->init(ie); // execute initial transition (virtual call)
 }
@@ -224,11 +526,18 @@ void QActive::stop(void) {
 
 //****************************************************************************
 static void *ticker_thread(void * /*arg*/) { // for pthread_create()
+#ifdef QF_POSIX_TICKLESS
+    ticklessLoop(); // the tickless clock tick loop, NOTE07
+#else
+    struct timespec deadline; // absolute deadline of the tick, NOTE06
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+
     while (l_isRunning) { // the clock tick loop...
         QF_onClockTick(); // clock tick callback (must call QF_TICK_X())
 
-        nanosleep(&l_tick, NULL); // sleep for the number of ticks, NOTE05
+        tickWait(&deadline); // sleep until the next tick, NOTE05, NOTE06
     }
+#endif // QF_POSIX_TICKLESS
     return static_cast<void *>(0); // return success
 }
 
@@ -276,4 +585,36 @@ static void *ticker_thread(void * /*arg*/) { // for pthread_create()
 // deliver only 2*actual-system-tick granularity. To compensate for this,
 // you would need to reduce (by 2) the constant NANOSLEEP_NSEC_PER_SEC.
 //
+// NOTE06:
+// The clock tick uses absolute deadlines on CLOCK_MONOTONIC: the deadline
+// of every tick is the deadline of the previous tick plus the tick period,
+// and the ticker sleeps with clock_nanosleep(TIMER_ABSTIME). The time spent
+// in QF_onClockTick() and any scheduling delays therefore don't accumulate
+// into drift. When the ticker wakes up after the deadline of the next tick
+// already passed (an overrun), the missed ticks are generated immediately
+// one after another (catch-up), but at most QF_TICK_MAX_CATCHUP of them;
+// the rest are dropped and counted in QFTickStats::nSkipped. The lateness
+// of every tick relative to its deadline is collected in QFTickStats,
+// see QF_getTickStats().
+//
+// NOTE07:
+// When the macro QF_POSIX_TICKLESS is defined, the ticker does not wake up
+// at every clock tick. Instead, after every tick it finds the nearest
+// expiration of an armed time event across all tick rates
+// (QF::tickNearest_()) and sleeps until the deadline of that tick, or
+// indefinitely when no time events are armed. The clock ticks in between
+// are still counted on the same drift-free grid of deadlines (NOTE06), and
+// they are applied to the time events at once (QF::tickAdvance_()), so the
+// time events keep their clock-tick semantics. QF_onClockTick() is called
+// only for the ticks at which a time event might expire, so it must call
+// QF_TICK_X() for every tick rate in use and do no other periodic work.
+//
+// QTimeEvt::armX() and QTimeEvt::rearm() call QF_ticklessArm_() (through
+// the QF_TIMEEVT_ARM_() hook) inside their critical section. It first
+// applies the ticks skipped so far to the time events at this tick rate,
+// so that the time event being armed does not count the ticks from before
+// it was armed. When the time event expires earlier than the planned tick,
+// it wakes up the ticker to re-plan. The ticker sleeps on a condition
+// variable that uses CLOCK_MONOTONIC.
+//
 
@@ -43,12 +43,26 @@
 //#define QF_OS_OBJECT_TYPE  // not provided
 //#define QF_THREAD_TYPE     // not provided
 
-// The maximum number of active objects in the application
+#ifdef QF_POSIX_TICKLESS // tickless clock tick, see NOTE07 in qf_port.cpp
+#define QF_TICKLESS
+#endif
+
+#ifndef QF_MAX_ACTIVE
+// The maximum number of active objects in the application (up to 1024)
 #define QF_MAX_ACTIVE        64
+#endif
 
 // The number of system clock tick rates
 #define QF_MAX_TICK_RATE     2
 
+// The maximum number of event pools and the size of the lookup table from
+// the event size to the event pool (events up to 64*sizeof(void*) bytes)
+#define QF_MAX_EPOOL         32
+#define QF_EPOOL_LUT_SIZE    64
+
+// The maximum number of payload buffer pools (zero-copy events)
+#define QF_MAX_BPOOL         8
+
 // various QF object sizes configuration for this port
 #define QF_EVENT_SIZ_SIZE    4
 #define QF_EQUEUE_CTR_SIZE   4
@@ -65,7 +79,16 @@
 #define QF_CRIT_ENTRY(dummy) QF_INT_DISABLE()
 #define QF_CRIT_EXIT(dummy)  QF_INT_ENABLE()
 
-// QF_LOG2 not defined -- use the internal LOG2() implementation
+// QF_LOG2 with the GCC/Clang bit-scan builtin. The argument of
+// __builtin_clzll() is never zero, so QF_LOG2(0) is zero, as required
+#ifdef __GNUC__
+#define QF_LOG2(n_) (static_cast<uint_fast8_t>(63U \
+    - static_cast<uint_fast8_t>(__builtin_clzll( \
+        (static_cast<uint64_t>(n_) << 1) | static_cast<uint64_t>(1)))))
+#endif
+
+// the timestamp of the queue telemetry (QF_QUEUE_HIST_SIZE) in [us]
+#define QF_QUEUE_TIME()      (QP::QF_queueTime_())
 
 #include <pthread.h>   // POSIX-thread API
 #include "qep_port.h"  // QEP port
@@ -83,6 +106,27 @@ void QF_setTickRate(uint32_t ticksPerSec, int_t tickPrio);
 // clock tick callback (NOTE not called when "ticker thread" is not running)
 void QF_onClockTick(void);
 
+// clock tick statistics (see QF_getTickStats()), all times in [ns]
+struct QFTickStats {
+    uint32_t nTicks;     // number of clock ticks generated
+    uint32_t nOverruns;  // ticks late by one tick period or more
+    uint32_t nSkipped;   // ticks dropped beyond QF_TICK_MAX_CATCHUP
+    uint32_t latencyMin; // minimum lateness of a tick vs. its deadline
+    uint32_t latencyMax; // maximum lateness of a tick vs. its deadline
+    uint64_t latencySum; // sum of the lateness (for the average)
+};
+
+// obtain (and optionally reset) the clock tick statistics
+void QF_getTickStats(QFTickStats * const stats, bool const reset);
+
+// monotonic time in [us] modulo 2^32 (QF_QUEUE_TIME())
+uint32_t QF_queueTime_(void);
+
+#ifdef QF_POSIX_TICKLESS
+// re-plan the tickless clock tick when a time event is armed (internal)
+void QF_ticklessArm_(uint_fast8_t const tickRate, QTimeEvtCtr const nTicks);
+#endif
+
 extern pthread_mutex_t QF_pThreadMutex_; // mutex for QF critical section
 
 } // namespace QP
@@ -97,6 +141,12 @@ extern pthread_mutex_t QF_pThreadMutex_; // mutex for QF critical section
     #define QF_SCHED_LOCK_(dummy) ((void)0)
     #define QF_SCHED_UNLOCK_()    ((void)0)
 
+#ifdef QF_POSIX_TICKLESS
+    // bring the time events up to date before (re)arming, see NOTE07
+    #define QF_TIMEEVT_ARM_(tickRate_, nTicks_) \
+        QF_ticklessArm_((tickRate_), (nTicks_))
+#endif
+
     // event queue operations...
     #define QACTIVE_EQUEUE_WAIT_(me_) \
         Q_ASSERT((me_)->m_eQueue.m_frontEvt != static_cast<QEvt const *>(0))
@@ -116,6 +166,9 @@ extern pthread_mutex_t QF_pThreadMutex_; // mutex for QF critical section
     #define QF_EPOOL_GET_(p_, e_, m_) \
         ((e_) = static_cast<QEvt *>((p_).get((m_))))
     #define QF_EPOOL_PUT_(p_, e_)     ((p_).put(e_))
+    #define QF_EPOOL_GET_N_(p_, chain_, n_, m_) \
+        ((chain_) = (p_).getN((n_), (m_)))
+    #define QF_EPOOL_PUT_N_(p_, chain_, n_) ((p_).putN((chain_), (n_)))
 
     namespace QP {
         extern QPSet QV_readySet_; // QV-ready set of active objects
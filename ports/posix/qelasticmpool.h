@@ -0,0 +1,187 @@
+/// @file
+/// @brief Elastic, mmap-backed memory pool for the QF/C++ port to POSIX
+/// @cond
+///***************************************************************************
+/// Last updated for version 6.3.4
+/// Last updated on  2018-09-04
+///
+///                    Q u a n t u m     L e a P s
+///                    ---------------------------
+///                    innovating embedded systems
+///
+/// Copyright (C) Quantum Leaps, LLC. All rights reserved.
+///
+/// This program is open source software: you can redistribute it and/or
+/// modify it under the terms of the GNU General Public License as published
+/// by the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Alternatively, this program may be distributed and modified under the
+/// terms of Quantum Leaps commercial licenses, which expressly supersede
+/// the GNU General Public License and are specifically designed for
+/// licensees interested in retaining the proprietary status of their code.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program. If not, see <http://www.gnu.org/licenses/>.
+///
+/// Contact information:
+/// https://www.state-machine.com
+/// mailto:info@state-machine.com
+///***************************************************************************
+/// @endcond
+
+#ifndef qelasticmpool_h
+#define qelasticmpool_h
+
+namespace QP {
+
+struct QFreeBlock; // free block of a memory pool, see qf_pkg.h
+
+//****************************************************************************
+//! Elastic fixed block-size memory pool backed by mmap()
+/// @description
+/// This memory pool is used as the #QF_EPOOL_TYPE_ of the event pools in
+/// the POSIX port when the macro QF_POSIX_ELASTIC_POOL is defined. It has
+/// the same interface and semantics as QP::QMPool, but it does not run out
+/// of blocks when the storage provided to QP::QF::poolInit() is exhausted.
+/// Instead, the pool grows by slabs of #QF_ELASTIC_SLAB_SIZE bytes, which
+/// are committed on demand inside a virtual address range reserved with
+/// mmap() at the initialization (#QF_ELASTIC_MAX_SLABS slabs). When the
+/// top slab becomes entirely free and the pool keeps more than the
+/// high-water number of free slabs, the slab is released back to the OS,
+/// see NOTE10 in qf_port.h.
+///
+/// @note
+/// The storage provided to QP::QF::poolInit() can be NULL (and the size 0),
+/// in which case all blocks come from the slabs. The blocks returned to the
+/// pool are range-checked against both the provided storage and the
+/// committed slabs.
+///
+class QElasticMPool {
+private:
+    //! head of linked list of free blocks of the storage provided to
+    //! QP::QF::poolInit() (the slabs have their own free lists)
+    void * volatile m_free_head;
+
+    //! start of the storage provided to QP::QF::poolInit() (or NULL)
+    void *m_start;
+
+    //! last block in the storage provided to QP::QF::poolInit() (or NULL)
+    void *m_end;
+
+    //! start of the virtual address range reserved for the slabs
+    uint8_t *m_map;
+
+    //! end of the committed slabs (the next slab to commit)
+    uint8_t * volatile m_mapEnd;
+
+    //! maximum block size (in bytes)
+    QMPoolSize m_blockSize;
+
+    //! number of blocks in one slab
+    QMPoolCtr m_slabBlocks;
+
+    //! total number of blocks (provided storage and committed slabs)
+    QMPoolCtr volatile m_nTot;
+
+    //! number of free blocks remaining
+    QMPoolCtr volatile m_nFree;
+
+    //! minimum number of free blocks ever present in this pool
+    /// @sa QP::QF::getPoolMin().
+    QMPoolCtr m_nMin;
+
+    //! number of free slabs kept before the top slab is released
+    uint_fast16_t m_highWater;
+
+    //! number of committed slabs
+    uint_fast16_t volatile m_nSlabs;
+
+    //! heads of the linked lists of free blocks of the committed slabs
+    QFreeBlock *m_slabHead[QF_ELASTIC_MAX_SLABS];
+
+    //! number of free blocks in every committed slab
+    QMPoolCtr m_slabFree[QF_ELASTIC_MAX_SLABS];
+
+    //! number of 32-bit words in the bitmask m_slabAvail
+    enum { AVAIL_WORDS = (QF_ELASTIC_MAX_SLABS + 31) / 32 };
+
+    //! bitmask of the committed slabs that have any free blocks
+    uint32_t m_slabAvail[AVAIL_WORDS];
+
+    //! serializes committing and releasing of the slabs (outside of the
+    //! critical section, because mmap() is a system call)
+    pthread_mutex_t m_slabMutex;
+
+#ifdef QF_CRIT_OBJ_TYPE
+    //! lock protecting this pool (used instead of the QF critical section)
+    QF_CRIT_OBJ_TYPE m_crit;
+#endif // QF_CRIT_OBJ_TYPE
+
+public:
+    QElasticMPool(void); //!< public default constructor
+
+    //! Initializes the elastic event pool
+    void init(void * const poolSto, uint_fast32_t poolSize,
+              uint_fast16_t blockSize);
+
+    //! Obtains a memory block from the pool (grows the pool if needed)
+    void *get(uint_fast16_t const margin);
+
+    //! Returns a memory block back to the pool
+    void put(void * const b);
+
+    //! Obtains a chain of @p n memory blocks (all or none)
+    void *getN(uint_fast16_t const n, uint_fast16_t const margin);
+
+    //! Returns a chain of @p n memory blocks in one critical section
+    void putN(void * const chain, uint_fast16_t const n);
+
+    //! return the fixed block-size of the blocks managed by this pool
+    QMPoolSize getBlockSize(void) const {
+        return m_blockSize;
+    }
+
+    //! set the number of free slabs kept before releasing the top slab
+    void setHighWater(uint_fast16_t const nSlabs) {
+        m_highWater = nSlabs;
+    }
+
+private:
+    //! the block @p b comes from this pool (storage or committed slabs)
+    bool inRange(void const * const b) const;
+
+    //! take a free block from the provided storage or from the lowest slab
+    //! (in critical section), returns NULL if the free lists are corrupt
+    QFreeBlock *pop(void);
+
+    //! link the block @p b into the free list of the provided storage or
+    //! of its slab (in critical section)
+    void push(void * const b);
+
+    //! commit one more slab unless @p need free blocks are available
+    bool grow(uint_fast32_t const need);
+
+    //! release the top slab if it is free and above the high-water mark
+    void shrink(void);
+
+    //! the top slab is entirely free and above the high-water mark
+    bool canShrink(void) const;
+
+    //! disallow copying of QElasticMPool
+    QElasticMPool(QElasticMPool const &);
+
+    //! disallow assignment of QElasticMPool
+    QElasticMPool & operator=(QElasticMPool const &);
+
+    friend class QF;
+};
+
+} // namespace QP
+
+#endif // qelasticmpool_h
@@ -47,6 +47,25 @@
 
 #include <limits.h>       // for PTHREAD_STACK_MIN
 #include <sys/mman.h>     // for mlockall()
+#include <string.h>       // for strncpy()
+#include <errno.h>        // for EINTR
+#include <time.h>         // for clock_nanosleep()
+#ifdef QF_POSIX_FUTEX
+    #include <linux/futex.h>  // for FUTEX_WAIT_PRIVATE/FUTEX_WAKE_PRIVATE
+    #include <sys/syscall.h>  // for SYS_futex
+    #include <unistd.h>       // for syscall()
+#endif
+#ifdef QF_POSIX_EPOLL
+    #include <sys/epoll.h>    // for epoll_create1()/epoll_ctl()/epoll_wait()
+    #include <sys/eventfd.h>  // for eventfd()
+    #include <unistd.h>       // for read()/write()/close()
+#endif
+#ifdef QF_POSIX_NUMA
+    #include <sched.h>        // for sched_getcpu()
+    #include <stdio.h>        // for fopen()/fscanf() of the sysfs files
+    #include <sys/syscall.h>  // for SYS_mbind
+    #include <unistd.h>       // for syscall()/sysconf()
+#endif
 
 namespace QP {
 
@@ -58,11 +77,75 @@ pthread_mutex_t QF_pThreadMutex_;
 // Local objects *************************************************************
 static bool l_isRunning;    // flag indicating when QF is running
 static pthread_mutex_t l_startupMutex;
-static struct timespec l_tick;
+static struct timespec l_tick; // tick period
+static QFTickStats l_tickStats; // tick statistics
 static int_t l_tickPrio;
 enum { NANOSLEEP_NSEC_PER_SEC = 1000000000 }; // see NOTE05
 
+// maximum number of missed clock ticks to catch up, see NOTE06
+#ifndef QF_TICK_MAX_CATCHUP
+#define QF_TICK_MAX_CATCHUP 10
+#endif
+#ifdef QF_POSIX_MAGAZINE
+// magazines of free blocks of a thread, see NOTE7 in qf_port.h
+struct QFMagazine {
+    QFreeBlock *head[QF_MAX_EPOOL];  // chains of the cached free blocks
+    uint_fast16_t nFree[QF_MAX_EPOOL]; // numbers of the cached free blocks
+    bool isReg;   // registered for the release at the thread exit
+};
+static __thread QFMagazine l_mag; // the magazines of the calling thread
+static uint_fast16_t l_magBatch[QF_MAX_EPOOL]; // refill/spill batch sizes
+static pthread_key_t l_magKey;    // for releasing magazines of exiting thread
+static void magRelease(void *arg);
+#endif // QF_POSIX_MAGAZINE
+#ifdef QF_POSIX_NUMA
+// NUMA nodes of the event pools, see NOTE12 in qf_port.h
+enum {
+    NUMA_NODE_UNKNOWN   = 0xFF,    // allocation node not determined yet
+    NUMA_MPOL_PREFERRED = 1,       // MPOL_PREFERRED of mbind()
+    NUMA_MPOL_MF_MOVE   = (1 << 1) // MPOL_MF_MOVE of mbind()
+};
+static uint_fast8_t l_numaNodes; // number of NUMA nodes (at least one)
+static cpu_set_t l_numaCpus[QF_NUMA_MAX_NODES]; // the CPUs of every node
+static uint8_t l_cpuNode[CPU_SETSIZE]; // the NUMA node of every CPU
+static __thread uint8_t l_allocNode = NUMA_NODE_UNKNOWN; // thread's node
+static void numaInit(void);
+static uint_fast8_t numaAllocNode(void);
+static void numaBind(void * const sto, uint_fast32_t const size,
+                     uint_fast8_t const node);
+#endif // QF_POSIX_NUMA
+#ifdef QF_POSIX_FUTEX
+enum { // states of QFParker::m_state, see NOTE4 in qf_port.h
+    PARKER_RUNNING,
+    PARKER_PARKED,
+    PARKER_SLEEPING,
+    PARKER_WAKING,
+    PARKER_NOTIFIED
+};
+#endif
+
 static void *ao_thread(void *arg); // thread routine for all AOs
+static void dispatchBatch(QActive * const act, QEvt const * const evts[],
+                          uint_fast16_t const n); // see NOTE14
+#ifndef QF_POSIX_TICKLESS
+static void tickWait(struct timespec *deadline); // see NOTE06
+#endif
+#ifdef QF_POSIX_TICKLESS
+static struct timespec l_ticklessOrigin; // the time of the tick #0, NOTE07
+static uint64_t l_tickApplied[QF_MAX_TICK_RATE]; // last tick applied
+static uint64_t l_ticklessNext;       // the next tick planned by the ticker
+static bool l_ticklessPlanning;       // the ticker is planning the next tick
+static bool l_ticklessReplan;         // the next tick must be re-planned
+static bool l_ticklessPending; // l_ticklessNext not delivered to QF yet
+static pthread_mutex_t l_ticklessMutex;
+static pthread_cond_t  l_ticklessCond;
+static uint64_t const TICKLESS_NONE = ~static_cast<uint64_t>(0);
+static void ticklessLoop(void);
+#endif // QF_POSIX_TICKLESS
+
+// the bit of the given attribute in QFThread::m_attrs
+#define QF_ATTR_BIT_(attr_) \
+    static_cast<uint8_t>(1U << static_cast<uint8_t>(attr_))
 
 //****************************************************************************
 void QF::init(void) {
@@ -72,6 +155,16 @@ void QF::init(void) {
     // init the global mutex with the default non-recursive initializer
     pthread_mutex_init(&QF_pThreadMutex_, NULL);
 
+#ifdef QF_CRIT_OBJ_TYPE
+    // init the locks of the time event lists, see NOTE2 in qf_port.h
+    for (uint_fast8_t tickRate = static_cast<uint_fast8_t>(0);
+         tickRate < static_cast<uint_fast8_t>(QF_MAX_TICK_RATE);
+         ++tickRate)
+    {
+        QF_CRIT_OBJ_INIT(&QF_timeEvtCrit_[tickRate]);
+    }
+#endif // QF_CRIT_OBJ_TYPE
+
     // init the startup mutex with the default non-recursive initializer
     pthread_mutex_init(&l_startupMutex, NULL);
 
@@ -84,6 +177,9 @@ void QF::init(void) {
     // uninitialized data (as is required by the C++ Standard).
     extern uint_fast8_t QF_maxPool_;
     QF_maxPool_ = static_cast<uint_fast8_t>(0);
+#if (QF_EPOOL_LUT_SIZE > 0)
+    bzero(&QF_poolLut_[0], static_cast<uint_fast16_t>(sizeof(QF_poolLut_)));
+#endif
     bzero(&QF::timeEvtHead_[0],
           static_cast<uint_fast16_t>(sizeof(QF::timeEvtHead_)));
     bzero(&active_[0], static_cast<uint_fast16_t>(sizeof(active_)));
@@ -91,6 +187,31 @@ void QF::init(void) {
     l_tick.tv_sec = 0;
     l_tick.tv_nsec = NANOSLEEP_NSEC_PER_SEC/100L; // default clock tick
     l_tickPrio = sched_get_priority_min(SCHED_FIFO); // default tick prio
+    bzero(&l_tickStats, static_cast<uint_fast16_t>(sizeof(l_tickStats)));
+    l_tickStats.latencyMin = static_cast<uint32_t>(0xFFFFFFFF);
+
+#ifdef QF_POSIX_MAGAZINE
+    pthread_key_create(&l_magKey, &magRelease);
+#endif
+
+#ifdef QF_POSIX_NUMA
+    numaInit(); // find the NUMA nodes before the event pools are initialized
+#endif
+
+#ifdef QF_POSIX_TICKLESS
+    pthread_mutex_init(&l_ticklessMutex, NULL);
+    pthread_condattr_t cattr;
+    pthread_condattr_init(&cattr);
+    pthread_condattr_setclock(&cattr, CLOCK_MONOTONIC); // see NOTE07
+    pthread_cond_init(&l_ticklessCond, &cattr);
+    pthread_condattr_destroy(&cattr);
+    bzero(&l_tickApplied[0],
+          static_cast<uint_fast16_t>(sizeof(l_tickApplied)));
+    l_ticklessNext = static_cast<uint64_t>(0);
+    l_ticklessPlanning = false;
+    l_ticklessReplan = false;
+    l_ticklessPending = false;
+#endif // QF_POSIX_TICKLESS
 }
 
 //****************************************************************************
@@ -112,11 +233,18 @@ int_t QF::run(void) {
     pthread_mutex_unlock(&l_startupMutex);
 
     l_isRunning = true;
+#ifdef QF_POSIX_TICKLESS
+    ticklessLoop(); // the tickless clock tick loop, NOTE07
+#else
+    struct timespec deadline; // absolute deadline of the tick, NOTE06
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+
     while (l_isRunning) { // the clock tick loop...
         QF_onClockTick(); // clock tick callback (must call QF_TICK_X())
 
-        nanosleep(&l_tick, NULL); // sleep for the number of ticks, NOTE05
+        tickWait(&deadline); // sleep until the next tick, NOTE05, NOTE06
     }
+#endif // QF_POSIX_TICKLESS
     onCleanup(); // invoke cleanup callback
     pthread_mutex_destroy(&l_startupMutex);
     pthread_mutex_destroy(&QF_pThreadMutex_);
@@ -125,12 +253,367 @@ int_t QF::run(void) {
 //****************************************************************************
 void QF_setTickRate(uint32_t ticksPerSec, int_t tickPrio) {
     Q_REQUIRE_ID(300, ticksPerSec != static_cast<uint32_t>(0));
-    l_tick.tv_nsec = NANOSLEEP_NSEC_PER_SEC / ticksPerSec;
+    {
+        // the tick period, see NOTE06
+        uint32_t const nsec = NANOSLEEP_NSEC_PER_SEC / ticksPerSec;
+        l_tick.tv_sec  = static_cast<time_t>(nsec / NANOSLEEP_NSEC_PER_SEC);
+        l_tick.tv_nsec = static_cast<long>(nsec % NANOSLEEP_NSEC_PER_SEC);
+    }
     l_tickPrio = tickPrio;
 }
 //****************************************************************************
+// absolute-deadline tick engine, see NOTE06
+
+// the tick period in nanoseconds
+static int64_t tickPeriod(void) {
+    return static_cast<int64_t>(l_tick.tv_sec) * NANOSLEEP_NSEC_PER_SEC
+           + static_cast<int64_t>(l_tick.tv_nsec);
+}
+//............................................................................
+// add the given number of nanoseconds to the timespec @p t
+static void tickAdd(struct timespec *t, int64_t nsec) {
+    nsec += static_cast<int64_t>(t->tv_nsec);
+    t->tv_sec += static_cast<time_t>(nsec / NANOSLEEP_NSEC_PER_SEC);
+    t->tv_nsec = static_cast<long>(nsec % NANOSLEEP_NSEC_PER_SEC);
+}
+//............................................................................
+// the lateness [ns] of the current time relative to the @p deadline
+static int64_t tickLate(struct timespec const *deadline) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    int64_t late =
+        static_cast<int64_t>(now.tv_sec - deadline->tv_sec)
+            * NANOSLEEP_NSEC_PER_SEC
+        + static_cast<int64_t>(now.tv_nsec - deadline->tv_nsec);
+    if (late < static_cast<int64_t>(0)) { // woken up early?
+        late = static_cast<int64_t>(0);
+    }
+    return late;
+}
+//............................................................................
+// update the tick statistics with one tick
+static void tickStatsUpdate(int64_t const late, int64_t const skipped) {
+    uint32_t const lat = (late < static_cast<int64_t>(0xFFFFFFFF))
+                         ? static_cast<uint32_t>(late)
+                         : static_cast<uint32_t>(0xFFFFFFFF);
+    QF_INT_DISABLE();
+    ++l_tickStats.nTicks;
+    if (late >= tickPeriod()) {
+        ++l_tickStats.nOverruns;
+    }
+    l_tickStats.nSkipped += static_cast<uint32_t>(skipped);
+    if (lat < l_tickStats.latencyMin) {
+        l_tickStats.latencyMin = lat;
+    }
+    if (lat > l_tickStats.latencyMax) {
+        l_tickStats.latencyMax = lat;
+    }
+    l_tickStats.latencySum += static_cast<uint64_t>(lat);
+    QF_INT_ENABLE();
+}
+#ifndef QF_POSIX_TICKLESS
+//............................................................................
+// wait for the next tick deadline and update the tick statistics
+static void tickWait(struct timespec *deadline) {
+    int64_t const period = tickPeriod();
+    tickAdd(deadline, period);
+
+    // sleep until the deadline (restart when interrupted by a signal)
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, deadline,
+                           static_cast<struct timespec *>(0)) == EINTR)
+    {}
+
+    int64_t const late = tickLate(deadline);
+
+    // too many ticks missed? drop the excess beyond the catch-up limit
+    int64_t skipped = (late / period)
+                      - static_cast<int64_t>(QF_TICK_MAX_CATCHUP);
+    if (skipped > static_cast<int64_t>(0)) {
+        tickAdd(deadline, skipped * period);
+    }
+    else {
+        skipped = static_cast<int64_t>(0);
+    }
+    tickStatsUpdate(late, skipped);
+}
+#endif // QF_POSIX_TICKLESS
+//............................................................................
+uint32_t QF_queueTime_(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<uint32_t>(
+        (static_cast<uint64_t>(now.tv_sec) * static_cast<uint64_t>(1000000))
+        + static_cast<uint64_t>(now.tv_nsec / 1000)); // [us]
+}
+//............................................................................
+void QF_getTickStats(QFTickStats * const stats, bool const reset) {
+    QF_INT_DISABLE();
+    *stats = l_tickStats;
+    if (reset) {
+        QF::bzero(&l_tickStats,
+                  static_cast<uint_fast16_t>(sizeof(l_tickStats)));
+        l_tickStats.latencyMin = static_cast<uint32_t>(0xFFFFFFFF);
+    }
+    QF_INT_ENABLE();
+}
+
+#if (QF_ALLOC_HIST_SIZE > 0)
+//............................................................................
+void QF_allocReport(FILE * const out) {
+    // the work area of QF::advisePools() shared by the reporting threads
+    static QFPoolAdviceWork work;
+    static pthread_mutex_t workMutex = PTHREAD_MUTEX_INITIALIZER;
+    QFAllocStats st;
+
+    fprintf(out, "pool blockSize   nAlloc    nFail    nUsed    nPeak"
+                 " maxSize  waste/evt\n");
+    for (uint_fast8_t poolId = static_cast<uint_fast8_t>(1);
+         poolId <= QF_maxPool_;
+         ++poolId)
+    {
+        QF::getAllocStats(poolId, &st, false);
+        uint_fast32_t const blockSize = static_cast<uint_fast32_t>(
+            QF_EPOOL_EVENT_SIZE_(
+                QF_pool_[poolId - static_cast<uint_fast8_t>(1)]));
+
+        // the bytes wasted by rounding up to the block size, counted from
+        // the top of every size class (so at least that many)
+        uint64_t waste = static_cast<uint64_t>(0);
+        for (uint_fast16_t cls = static_cast<uint_fast16_t>(0);
+             cls < static_cast<uint_fast16_t>(QF_ALLOC_HIST_SIZE);
+             ++cls)
+        {
+            uint_fast32_t size = (cls < static_cast<uint_fast16_t>(
+                                         QF_ALLOC_HIST_SIZE - 1))
+                ? ((cls + 1U) * sizeof(void *))
+                : st.maxSize;
+            if (size > blockSize) {
+                size = blockSize;
+            }
+            waste += static_cast<uint64_t>(st.hist[cls])
+                     * (blockSize - size);
+        }
+        fprintf(out, "%4u %9u %8u %8u %8u %8u %7u %10.1f\n",
+                static_cast<unsigned>(poolId),
+                static_cast<unsigned>(blockSize),
+                static_cast<unsigned>(st.nAlloc),
+                static_cast<unsigned>(st.nFail),
+                static_cast<unsigned>(st.nUsed),
+                static_cast<unsigned>(st.nPeak),
+                static_cast<unsigned>(st.maxSize),
+                (st.nAlloc != static_cast<uint32_t>(0))
+                    ? (static_cast<double>(waste) / st.nAlloc)
+                    : 0.0);
+    }
+
+#if (QF_ALLOC_STAT_SIGS > 0)
+    fprintf(out, "signal   nAlloc    nFail    nUsed    nPeak maxSize\n");
+    for (enum_t sig = static_cast<enum_t>(0);
+         sig <= static_cast<enum_t>(QF_ALLOC_STAT_SIGS);
+         ++sig)
+    {
+        QF::getSigAllocStats(sig, &st, false);
+        if ((st.nAlloc != static_cast<uint32_t>(0))
+            || (st.nPeak != static_cast<uint32_t>(0)))
+        {
+            if (sig < static_cast<enum_t>(QF_ALLOC_STAT_SIGS)) {
+                fprintf(out, "%6d", static_cast<int>(sig));
+            }
+            else {
+                fprintf(out, " other");
+            }
+            fprintf(out, " %8u %8u %8u %8u %7u\n",
+                    static_cast<unsigned>(st.nAlloc),
+                    static_cast<unsigned>(st.nFail),
+                    static_cast<unsigned>(st.nUsed),
+                    static_cast<unsigned>(st.nPeak),
+                    static_cast<unsigned>(st.maxSize));
+        }
+    }
+#endif // (QF_ALLOC_STAT_SIGS > 0)
+
+    QFPoolAdvice advice[QF_MAX_EPOOL];
+    pthread_mutex_lock(&workMutex); // concurrent reports take turns
+    uint_fast8_t const n = QF::advisePools(advice,
+                               static_cast<uint_fast8_t>(QF_MAX_EPOOL),
+                               &work);
+    pthread_mutex_unlock(&workMutex);
+    uint64_t total = static_cast<uint64_t>(0);
+    fprintf(out, "advised pools (blockSize x nBlocks, no headroom):\n");
+    for (uint_fast8_t i = static_cast<uint_fast8_t>(0); i < n; ++i) {
+        fprintf(out, "%4u %9u x %u\n",
+                static_cast<unsigned>(i + 1U),
+                static_cast<unsigned>(advice[i].blockSize),
+                static_cast<unsigned>(advice[i].nBlocks));
+        total += static_cast<uint64_t>(advice[i].blockSize)
+                 * advice[i].nBlocks;
+    }
+    fprintf(out, "advised total: %llu bytes\n",
+            static_cast<unsigned long long>(total));
+}
+#endif // (QF_ALLOC_HIST_SIZE > 0)
+
+#ifdef QF_POSIX_TICKLESS
+//****************************************************************************
+// tickless clock tick engine, see NOTE07
+
+// the deadline of the clock tick with the given index
+static void ticklessDeadline(struct timespec *deadline, uint64_t const tick) {
+    *deadline = l_ticklessOrigin;
+    tickAdd(deadline, static_cast<int64_t>(tick) * tickPeriod());
+}
+//............................................................................
+// the index of the last clock tick whose deadline has already passed
+static uint64_t ticklessNow(void) {
+    int64_t const late = tickLate(&l_ticklessOrigin);
+    return static_cast<uint64_t>(late / tickPeriod());
+}
+//............................................................................
+// called from QTimeEvt::armX()/rearm() inside the critical section of the
+// time events at the given tick rate, see NOTE07
+void QF_ticklessArm_(uint_fast8_t const tickRate, QTimeEvtCtr const nTicks) {
+    pthread_mutex_lock(&l_ticklessMutex);
+    if (l_ticklessPlanning
+        || (l_ticklessNext != static_cast<uint64_t>(0))) // ticker running?
+    {
+        // bring the time events up to date with the ticks skipped so far,
+        // but leave the tick planned by the ticker to the ticker until it
+        // has been delivered through QF_onClockTick() (even if the ticker
+        // has already woken up for it)
+        uint64_t now = ticklessNow();
+        if (l_ticklessPending && (now >= l_ticklessNext)) {
+            now = (l_ticklessNext != static_cast<uint64_t>(0))
+                  ? (l_ticklessNext - static_cast<uint64_t>(1))
+                  : static_cast<uint64_t>(0);
+        }
+        if (now > l_tickApplied[tickRate]) {
+            QF::tickAdvance_(tickRate,
+                static_cast<QTimeEvtCtr>(now - l_tickApplied[tickRate]));
+            l_tickApplied[tickRate] = now;
+        }
+
+        // expires before the planned tick? make the ticker re-plan
+        if (l_ticklessPlanning
+            || ((l_tickApplied[tickRate] + static_cast<uint64_t>(nTicks))
+                < l_ticklessNext))
+        {
+            l_ticklessReplan = true;
+            pthread_cond_signal(&l_ticklessCond);
+        }
+    }
+    pthread_mutex_unlock(&l_ticklessMutex);
+}
+//............................................................................
+// the tickless clock tick loop, see NOTE07
+static void ticklessLoop(void) {
+    pthread_mutex_lock(&l_ticklessMutex);
+    clock_gettime(CLOCK_MONOTONIC, &l_ticklessOrigin);
+    l_ticklessPlanning = true;
+    l_ticklessPending = true; // tick 0 is delivered first
+    pthread_mutex_unlock(&l_ticklessMutex);
+
+    uint64_t tick = static_cast<uint64_t>(0);
+    while (l_isRunning) {
+        QF_CRIT_STAT_
+        uint_fast8_t tickRate;
+
+        // apply the skipped ticks and leave this tick to QF_onClockTick()
+        for (tickRate = static_cast<uint_fast8_t>(0);
+             tickRate < static_cast<uint_fast8_t>(QF_MAX_TICK_RATE);
+             ++tickRate)
+        {
+            QF_CRIT_OBJ_ENTRY_(&QF_timeEvtCrit_[tickRate]);
+            if (tick > l_tickApplied[tickRate] + static_cast<uint64_t>(1)) {
+                QF::tickAdvance_(tickRate, static_cast<QTimeEvtCtr>(
+                    tick - l_tickApplied[tickRate] - static_cast<uint64_t>(1)));
+            }
+            if (tick > l_tickApplied[tickRate]) {
+                l_tickApplied[tickRate] = tick;
+            }
+            QF_CRIT_EXIT_();
+        }
+
+        QF_onClockTick(); // clock tick callback (must call QF_TICK_X())
+
+        pthread_mutex_lock(&l_ticklessMutex);
+        l_ticklessPending = false; // the tick has been delivered
+        pthread_mutex_unlock(&l_ticklessMutex);
+
+        // plan the next tick: the nearest expiration of a time event
+        uint64_t next;
+        bool replan;
+        do {
+            next = TICKLESS_NONE;
+            for (tickRate = static_cast<uint_fast8_t>(0);
+                 tickRate < static_cast<uint_fast8_t>(QF_MAX_TICK_RATE);
+                 ++tickRate)
+            {
+                QF_CRIT_OBJ_ENTRY_(&QF_timeEvtCrit_[tickRate]);
+                QTimeEvtCtr const n = QF::tickNearest_(tickRate);
+                if ((n != static_cast<QTimeEvtCtr>(0))
+                    && ((l_tickApplied[tickRate] + static_cast<uint64_t>(n))
+                        < next))
+                {
+                    next = l_tickApplied[tickRate] + static_cast<uint64_t>(n);
+                }
+                QF_CRIT_EXIT_();
+            }
+
+            pthread_mutex_lock(&l_ticklessMutex);
+            if (!l_ticklessReplan) { // nothing armed while planning?
+                l_ticklessPlanning = false;
+                l_ticklessNext = next;
+                l_ticklessPending = true;
+
+                // sleep until the next tick, re-plan or stop
+                struct timespec deadline;
+                ticklessDeadline(&deadline, next);
+                int err = 0;
+                while ((!l_ticklessReplan) && l_isRunning
+                       && (err != ETIMEDOUT))
+                {
+                    if (next == TICKLESS_NONE) { // no time events armed?
+                        err = pthread_cond_wait(&l_ticklessCond,
+                                                &l_ticklessMutex);
+                    }
+                    else {
+                        err = pthread_cond_timedwait(&l_ticklessCond,
+                                                     &l_ticklessMutex,
+                                                     &deadline);
+                    }
+                }
+            }
+            replan = l_ticklessReplan;
+            if (replan) {
+                l_ticklessReplan = false;
+                l_ticklessPlanning = true;
+            }
+            pthread_mutex_unlock(&l_ticklessMutex);
+        } while (replan && l_isRunning);
+
+        if (l_isRunning) {
+            struct timespec deadline;
+            ticklessDeadline(&deadline, next);
+            tickStatsUpdate(tickLate(&deadline), static_cast<int64_t>(0));
+
+            pthread_mutex_lock(&l_ticklessMutex);
+            l_ticklessPlanning = true; // until the next tick is planned
+            pthread_mutex_unlock(&l_ticklessMutex);
+            tick = next;
+        }
+    }
+}
+#endif // QF_POSIX_TICKLESS
+//****************************************************************************
 void QF::stop(void) {
     l_isRunning = false; // stop the loop in QF::run()
+
+#ifdef QF_POSIX_TICKLESS
+    // unblock the tickless ticker so it can terminate
+    pthread_mutex_lock(&l_ticklessMutex);
+    pthread_cond_signal(&l_ticklessCond);
+    pthread_mutex_unlock(&l_ticklessMutex);
+#endif
 }
 //............................................................................
 void QF::thread_(QActive *act) {
@@ -138,18 +621,137 @@ void QF::thread_(QActive *act) {
     pthread_mutex_lock(&l_startupMutex);
     pthread_mutex_unlock(&l_startupMutex);
 
-    // loop until m_thread is cleared in QActive::stop()
-    do {
-        QEvt const *e = act->get_(); // wait for event
-        act->dispatch(e); // dispatch to the active object's state machine
-        gc(e); // check if the event is garbage, and collect it if so
-    } while (act->m_thread != static_cast<uint8_t>(0));
+#ifdef QF_POSIX_NUMA
+    // allocate the events from the home node of the AO, see NOTE12
+    l_allocNode = act->m_thread.m_node;
+#endif
+
+#ifdef QF_POSIX_EPOLL
+    if (act->m_thread.m_epollSig != static_cast<uint8_t>(0)) {
+        QEpollActive * const ea = static_cast<QEpollActive *>(act);
+        struct epoll_event evts[QF_EPOLL_MAX_FDS + 1];
+        QEvt const *batch[QF_ACTIVE_BATCH];
+
+        // loop until m_thread is cleared in QActive::stop(), see NOTE6
+        do {
+            // dispatch the queued events in batches (see NOTE14), but at
+            // most the queue capacity before polling the file descriptors
+            uint_fast16_t left = static_cast<uint_fast16_t>(
+                act->m_eQueue.m_end) + static_cast<uint_fast16_t>(1);
+            while ((left != static_cast<uint_fast16_t>(0))
+                   && (__atomic_load_n(&act->m_eQueue.m_frontEvt,
+                                       __ATOMIC_ACQUIRE)
+                       != static_cast<QEvt const *>(0))
+                   && (act->m_thread.m_running != static_cast<uint8_t>(0)))
+            {
+                uint_fast16_t const n = act->getBatch_(batch,
+                    (left < static_cast<uint_fast16_t>(QF_ACTIVE_BATCH))
+                    ? left
+                    : static_cast<uint_fast16_t>(QF_ACTIVE_BATCH));
+                dispatchBatch(act, batch, n); // does not block
+                left -= n;
+            }
+
+            // poll the file descriptors, block only if the queue is empty
+            int_t const timeout = (__atomic_load_n(&act->m_eQueue.m_frontEvt,
+                                                   __ATOMIC_ACQUIRE)
+                                   != static_cast<QEvt const *>(0))
+                                  ? 0
+                                  : -1;
+            int_t const nEvts = epoll_wait(ea->m_epollFd, evts,
+                                           static_cast<int>(Q_DIM(evts)),
+                                           timeout);
+            for (int_t i = 0; i < nEvts; ++i) {
+                QFdEvt * const fe = static_cast<QFdEvt *>(evts[i].data.ptr);
+                if (fe == static_cast<QFdEvt *>(0)) { // the eventfd?
+                    uint64_t cnt;
+                    ssize_t const nRead = read(act->m_thread.m_eventFd,
+                                               &cnt, sizeof(cnt));
+                    (void)nRead; // the queue is checked in the next pass
+                }
+                // still registered and running?
+                else if ((fe->fd >= 0)
+                    && (act->m_thread.m_running != static_cast<uint8_t>(0)))
+                {
+                    fe->revents = evts[i].events;
+                    act->dispatch(fe); // dispatch in this RTC context
+                }
+            }
+        } while (act->m_thread.m_running != static_cast<uint8_t>(0));
+
+        close(ea->m_epollFd);
+        close(act->m_thread.m_eventFd);
+    }
+    else
+#endif // QF_POSIX_EPOLL
+    {
+        QEvt const *evts[QF_ACTIVE_BATCH];
+
+        // loop until m_thread is cleared in QActive::stop(), see NOTE14
+        do {
+            uint_fast16_t const n = act->getBatch_(evts,
+                static_cast<uint_fast16_t>(QF_ACTIVE_BATCH)); // wait for evts
+            dispatchBatch(act, evts, n);
+        } while (act->m_thread.m_running != static_cast<uint8_t>(0));
+    }
 
     QF::remove_(act); // remove this object from the framework
+#if (defined QF_POSIX_FUTEX)
+    // nothing to cleanup for the futex
+#elif !(defined QF_POSIX_MPSC_QUEUE)
     pthread_cond_destroy(&act->m_osObject); // cleanup the condition variable
+#else
+    pthread_cond_destroy(&act->m_eQueue.m_cond);   // cleanup the queue
+    pthread_mutex_destroy(&act->m_eQueue.m_mutex);
+#endif
+}
+//............................................................................
+// dispatch the batch of @p n events taken from the queue of @p act with
+// QActive::getBatch_(), the events self-posted with postLIFO() and the
+// urgent events first
+static void dispatchBatch(QActive * const act, QEvt const * const evts[],
+                          uint_fast16_t const n)
+{
+    // a self-posted event left from before the batch is in the batch
+    (void)__atomic_fetch_and(&act->m_thread.m_lifo,
+                             static_cast<uint8_t>(~1U), __ATOMIC_RELAXED);
+
+    for (uint_fast16_t i = 0U; i < n; ++i) {
+        if (act->m_thread.m_running != static_cast<uint8_t>(0)) {
+            act->dispatch(evts[i]); // dispatch to the state machine
+        }
+        QF::gc(evts[i]); // check if the event is garbage, and collect it
+
+        // the events posted ahead of the batch go before the rest
+        uint8_t ahead = __atomic_exchange_n(&act->m_thread.m_lifo,
+                            static_cast<uint8_t>(0), __ATOMIC_RELAXED);
+        while ((ahead != static_cast<uint8_t>(0))
+               && (act->m_thread.m_running != static_cast<uint8_t>(0)))
+        {
+            QEvt const *e = static_cast<QEvt const *>(0);
+#ifdef QF_URGENT_LANE
+            e = act->getUrgent_(); // does not block
+#endif
+            if (e == static_cast<QEvt const *>(0)) { // no urgent event?
+                if ((ahead & static_cast<uint8_t>(1)) != 0U) { // LIFO?
+                    ahead &= static_cast<uint8_t>(~1U);
+                    e = act->get_(); // does not block
+                }
+                else {
+                    ahead = static_cast<uint8_t>(0); // all dispatched
+                }
+            }
+            if (e != static_cast<QEvt const *>(0)) {
+                act->dispatch(e);
+                QF::gc(e);
+            }
+            ahead |= __atomic_exchange_n(&act->m_thread.m_lifo,
+                         static_cast<uint8_t>(0), __ATOMIC_RELAXED);
+        }
+    }
 }
 //............................................................................
-void QActive::start(uint_fast8_t prio,
+void QActive::start(QPrio const prio,
                     QEvt const *qSto[], uint_fast16_t qLen,
                     void *stkSto, uint_fast16_t stkSize,
                     QEvt const *ie)
@@ -157,33 +759,76 @@ void QActive::start(uint_fast8_t prio,
     // p-threads allocate stack internally
     Q_REQUIRE_ID(600, stkSto == static_cast<void *>(0));
 
+#if !(defined QF_POSIX_MPSC_QUEUE) && !(defined QF_POSIX_FUTEX)
     pthread_cond_init(&m_osObject, 0);
+#endif
 
     m_eQueue.init(qSto, qLen);
-    m_prio = static_cast<uint8_t>(prio); // set the QF priority of this AO
+    m_prio = prio; // set the QF priority of this AO
+
+#ifdef QF_POSIX_NUMA
+    // without NUMA_NODE_ATTR the home node is the node of the thread
+    // starting the AO, recorded once here, see NOTE12
+    if ((m_thread.m_attrs & QF_ATTR_BIT_(NUMA_NODE_ATTR)) == 0U) {
+        m_thread.m_node = static_cast<uint8_t>(numaAllocNode());
+    }
+#endif
+
     QF::add_(this); // make QF aware of this AO
     this->init(ie); // execute initial transition (virtual call)
 
     pthread_attr_t attr;
     pthread_attr_init(&attr);
 
-    // SCHED_FIFO corresponds to real-time preemptive priority-based scheduler
-    // NOTE: This scheduling policy requires the superuser privileges
-    pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
-
-    // see NOTE04
     struct sched_param param;
-    param.sched_priority = prio
-                           + (sched_get_priority_max(SCHED_FIFO)
-                              - QF_MAX_ACTIVE - 3);
+    if ((m_thread.m_attrs & QF_ATTR_BIT_(SCHED_ATTR)) != 0U) {
+        // the policy and priority set with setAttr(), see NOTE5 in qf_port.h
+        pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+        pthread_attr_setschedpolicy(&attr, m_thread.m_policy);
+        param.sched_priority = m_thread.m_prio;
+    }
+    else {
+        // SCHED_FIFO corresponds to real-time preemptive priority-based
+        // scheduler
+        // NOTE: This scheduling policy requires the superuser privileges
+        pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+
+        // see NOTE04
+        param.sched_priority = prio
+                               + (sched_get_priority_max(SCHED_FIFO)
+                                  - QF_MAX_ACTIVE - 3);
+    }
 
     pthread_attr_setschedparam(&attr, &param);
     pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
 
-    // stack size not provided?
-    if (stkSize == 0U) {
-        stkSize = (uint_fast16_t)PTHREAD_STACK_MIN; // the minimum
+    // stack size provided (STACK_SIZE_ATTR takes precedence)?
+    size_t stkBytes = static_cast<size_t>(stkSize);
+    if ((m_thread.m_attrs & QF_ATTR_BIT_(STACK_SIZE_ATTR)) != 0U) {
+        stkBytes = m_thread.m_stkSize;
+    }
+    if (stkBytes != static_cast<size_t>(0)) {
+        if (stkBytes < static_cast<size_t>(PTHREAD_STACK_MIN)) {
+            stkBytes = static_cast<size_t>(PTHREAD_STACK_MIN); // the minimum
+        }
+        pthread_attr_setstacksize(&attr, stkBytes);
+    }
+
+#ifdef CPU_SETSIZE
+    if ((m_thread.m_attrs & QF_ATTR_BIT_(CPU_SET_ATTR)) != 0U) {
+        pthread_attr_setaffinity_np(&attr, sizeof(cpu_set_t),
+                                    &m_thread.m_cpuSet);
     }
+#ifdef QF_POSIX_NUMA
+    // run on the CPUs of the home node (CPU_SET_ATTR takes precedence)
+    else if ((m_thread.m_attrs & QF_ATTR_BIT_(NUMA_NODE_ATTR)) != 0U) {
+        pthread_attr_setaffinity_np(&attr, sizeof(cpu_set_t),
+                                    &l_numaCpus[m_thread.m_node]);
+    }
+#endif // QF_POSIX_NUMA
+#endif // CPU_SETSIZE
+
+    m_thread.m_running = static_cast<uint8_t>(1);
     pthread_t thread;
     if (pthread_create(&thread, &attr, &ao_thread, this) != 0) {
 
@@ -198,12 +843,73 @@ void QActive::start(uint_fast8_t prio,
         Q_ALLEGE(pthread_create(&thread, &attr, &ao_thread, this)== 0);
     }
     pthread_attr_destroy(&attr);
-    m_thread = static_cast<uint8_t>(1);
+
+#ifdef __linux__
+    if ((m_thread.m_attrs & QF_ATTR_BIT_(THREAD_NAME_ATTR)) != 0U) {
+        pthread_setname_np(thread, m_thread.m_name);
+    }
+#endif
 }
 //............................................................................
 void QActive::stop(void) {
     unsubscribeAll();
-    m_thread = static_cast<uint8_t>(0); // stop the QF::thread_() loop
+    m_thread.m_running = static_cast<uint8_t>(0); // stop QF::thread_() loop
+}
+
+//............................................................................
+void QActive::setAttr(uint32_t attr1, void const *attr2) {
+    /// @pre the attribute value must be provided
+    Q_REQUIRE_ID(800, attr2 != static_cast<void const *>(0));
+
+    /// @pre the thread attributes must be set before QActive::start()
+    Q_REQUIRE_ID(801, (attr1 == static_cast<uint32_t>(SPIN_COUNT_ATTR))
+                      || (m_thread.m_running == static_cast<uint8_t>(0)));
+
+    switch (attr1) {
+        case SPIN_COUNT_ATTR:
+#ifdef QF_POSIX_FUTEX
+            m_osObject.m_spin = *static_cast<uint32_t const *>(attr2);
+#endif
+            // the spinning is not used without QF_POSIX_FUTEX
+            break;
+        case CPU_SET_ATTR:
+#ifdef CPU_SETSIZE
+            m_thread.m_cpuSet = *static_cast<cpu_set_t const *>(attr2);
+            m_thread.m_attrs |= QF_ATTR_BIT_(CPU_SET_ATTR);
+#endif
+            // the CPU affinity is ignored where cpu_set_t is not available
+            break;
+        case SCHED_ATTR: {
+            QFSchedAttr const *sched = static_cast<QFSchedAttr const *>(attr2);
+            m_thread.m_policy = sched->policy;
+            m_thread.m_prio   = sched->prio;
+            m_thread.m_attrs |= QF_ATTR_BIT_(SCHED_ATTR);
+            break;
+        }
+        case STACK_SIZE_ATTR:
+            m_thread.m_stkSize = *static_cast<size_t const *>(attr2);
+            m_thread.m_attrs |= QF_ATTR_BIT_(STACK_SIZE_ATTR);
+            break;
+        case THREAD_NAME_ATTR:
+            // copy the name, truncated to the limit of the OS (15 chars)
+            strncpy(m_thread.m_name, static_cast<char const *>(attr2),
+                    sizeof(m_thread.m_name) - 1U);
+            m_thread.m_name[sizeof(m_thread.m_name) - 1U] = '\0';
+            m_thread.m_attrs |= QF_ATTR_BIT_(THREAD_NAME_ATTR);
+            break;
+        case NUMA_NODE_ATTR:
+            m_thread.m_node = *static_cast<uint8_t const *>(attr2);
+#ifdef QF_POSIX_NUMA
+            /// @pre the home node must be one of the NUMA nodes
+            Q_REQUIRE_ID(820, m_thread.m_node < l_numaNodes);
+#endif
+            // the home node is ignored without QF_POSIX_NUMA
+            m_thread.m_attrs |= QF_ATTR_BIT_(NUMA_NODE_ATTR);
+            break;
+        default:
+            Q_ERROR_ID(810); // unknown attribute
+            break;
+    }
 }
 
 //............................................................................
@@ -212,48 +918,1907 @@ static void *ao_thread(void *arg) { // the expected POSIX signature
     return static_cast<void *>(0); // return success
 }
 
-} // namespace QP
+#ifdef QF_POSIX_EPOLL
+//****************************************************************************
+QEpollActive::QEpollActive(QStateHandler const initial)
+  : QActive(initial),
+    m_epollFd(epoll_create1(EPOLL_CLOEXEC))
+{
+    Q_ASSERT_ID(1000, m_epollFd >= 0);
+
+    m_thread.m_eventFd = eventfd(0U, EFD_CLOEXEC | EFD_NONBLOCK);
+    Q_ASSERT_ID(1001, m_thread.m_eventFd >= 0);
+
+    struct epoll_event ev;
+    ev.events   = EPOLLIN;
+    ev.data.ptr = static_cast<void *>(0); // the eventfd has no QFdEvt
+    Q_ALLEGE_ID(1002, epoll_ctl(m_epollFd, EPOLL_CTL_ADD,
+                                m_thread.m_eventFd, &ev) == 0);
+    m_thread.m_epollSig = static_cast<uint8_t>(1); // idle
+
+    for (uint_fast8_t i = static_cast<uint_fast8_t>(0);
+         i < static_cast<uint_fast8_t>(QF_EPOLL_MAX_FDS);
+         ++i)
+    {
+        m_fdEvt[i].sig     = static_cast<QSignal>(0);
+        m_fdEvt[i].poolId_ = static_cast<uint8_t>(0); // static event
+        m_fdEvt[i].refCtr_ = static_cast<uint8_t>(0);
+        m_fdEvt[i].fd      = -1; // not registered
+    }
+}
+//............................................................................
+QFdEvt *QEpollActive::findFd(int_t const fd) {
+    for (uint_fast8_t i = static_cast<uint_fast8_t>(0);
+         i < static_cast<uint_fast8_t>(QF_EPOLL_MAX_FDS);
+         ++i)
+    {
+        if (m_fdEvt[i].fd == fd) {
+            return &m_fdEvt[i];
+        }
+    }
+    return static_cast<QFdEvt *>(0);
+}
+//............................................................................
+void QEpollActive::addFd(int_t const fd, uint32_t const events,
+                         enum_t const sig)
+{
+    /// @pre the file descriptor must be valid and not registered yet
+    Q_REQUIRE_ID(1010, (fd >= 0)
+                       && (findFd(fd) == static_cast<QFdEvt *>(0)));
+
+    QFdEvt * const fe = findFd(-1); // find a free QFdEvt
+
+    /// @pre at most QF_EPOLL_MAX_FDS file descriptors can be registered
+    Q_REQUIRE_ID(1011, fe != static_cast<QFdEvt *>(0));
+
+    fe->sig     = static_cast<QSignal>(sig);
+    fe->fd      = fd;
+    fe->revents = static_cast<uint32_t>(0);
+
+    struct epoll_event ev;
+    ev.events   = events;
+    ev.data.ptr = fe;
+    Q_ALLEGE_ID(1012, epoll_ctl(m_epollFd, EPOLL_CTL_ADD, fd, &ev) == 0);
+}
+//............................................................................
+void QEpollActive::modifyFd(int_t const fd, uint32_t const events) {
+    QFdEvt * const fe = findFd(fd);
+
+    /// @pre the file descriptor must be registered
+    Q_REQUIRE_ID(1020, (fd >= 0) && (fe != static_cast<QFdEvt *>(0)));
+
+    struct epoll_event ev;
+    ev.events   = events;
+    ev.data.ptr = fe;
+    Q_ALLEGE_ID(1021, epoll_ctl(m_epollFd, EPOLL_CTL_MOD, fd, &ev) == 0);
+}
+//............................................................................
+void QEpollActive::removeFd(int_t const fd) {
+    QFdEvt * const fe = findFd(fd);
+
+    /// @pre the file descriptor must be registered
+    Q_REQUIRE_ID(1030, (fd >= 0) && (fe != static_cast<QFdEvt *>(0)));
+
+    struct epoll_event ev; // ignored, but required by old kernels
+    ev.events   = static_cast<uint32_t>(0);
+    ev.data.ptr = static_cast<void *>(0);
+    Q_ALLEGE_ID(1031, epoll_ctl(m_epollFd, EPOLL_CTL_DEL, fd, &ev) == 0);
+
+    // readiness already returned by epoll_wait() for this file descriptor
+    // is skipped in QF::thread_()
+    fe->fd = -1;
+}
+//............................................................................
+void QF_epollWake_(QFThread * const thr) {
+    // only one of the concurrent producers writes the eventfd
+    if (__atomic_exchange_n(&thr->m_epollSig, static_cast<uint8_t>(1),
+                            __ATOMIC_ACQ_REL) == static_cast<uint8_t>(2))
+    {
+        uint64_t const one = static_cast<uint64_t>(1);
+        ssize_t const nWritten = write(thr->m_eventFd, &one, sizeof(one));
+        (void)nWritten; // the eventfd counter cannot overflow here
+    }
+}
+#endif // QF_POSIX_EPOLL
 
+#ifdef QF_POSIX_MAGAZINE
 //****************************************************************************
-// NOTE01:
-// In Linux, the scheduler policy closest to real-time is the SCHED_FIFO
-// policy, available only with superuser privileges. QF::run() attempts to set
-// this policy as well as to maximize its priority, so that the ticking
-// occurrs in the most timely manner (as close to an interrupt as possible).
-// However, setting the SCHED_FIFO policy might fail, most probably due to
-// insufficient privileges.
-//
-// NOTE02:
-// On some Linux systems nanosleep() might actually not deliver the finest
-// time granularity. For example, on some Linux implementations, nanosleep()
-// could not block for shorter intervals than 20ms, while the underlying
-// clock tick period was only 10ms. Sometimes, the select() system call can
-// provide a finer granularity.
-//
-// NOTE03:
-// Any blocking system call, such as nanosleep() or select() system call can
-// be interrupted by a signal, such as ^C from the keyboard. In this case this
-// QF port breaks out of the event-loop and returns to main() that exits and
-// terminates all spawned p-threads.
-//
-// NOTE04:
-// According to the man pages (for pthread_attr_setschedpolicy) the only value
-// supported in the Linux p-threads implementation is PTHREAD_SCOPE_SYSTEM,
-// meaning that the threads contend for CPU time with all processes running on
-// the machine. In particular, thread priorities are interpreted relative to
-// the priorities of all other processes on the machine.
-//
-// This is good, because it seems that if we set the priorities high enough,
-// no other process (or thread running within) can gain control over the CPU.
-//
-// However, QF limits the number of priority levels to QF_MAX_ACTIVE.
-// Assuming that a QF application will be real-time, this port reserves the
-// three highest Linux priorities for the ISR-like threads (e.g., the ticker,
-// I/O), and the rest highest-priorities for the active objects.
-//
-// NOTE05:
-// In some (older) Linux kernels, the POSIX nanosleep() system call might
-// deliver only 2*actual-system-tick granularity. To compensate for this,
-// you would need to reduce (by 2) the constant NANOSLEEP_NSEC_PER_SEC.
+void QF_magInit_(QF_EPOOL_TYPE_ * const pool,
+                 uint_fast32_t const poolSize)
+{
+    uint_fast8_t const idx = static_cast<uint_fast8_t>(pool - &QF_pool_[0]);
+#ifdef QF_POSIX_ELASTIC_POOL
+    // an elastic pool grows by slabs, so size the batch by one slab at least
+    uint_fast32_t const size =
+        (poolSize > static_cast<uint_fast32_t>(QF_ELASTIC_SLAB_SIZE))
+        ? poolSize
+        : static_cast<uint_fast32_t>(QF_ELASTIC_SLAB_SIZE);
+    uint_fast32_t batch = (size / pool->getBlockSize()) / 16U;
+#else
+    uint_fast32_t batch = (poolSize / pool->getBlockSize()) / 16U;
+#endif
+    if (batch > static_cast<uint_fast32_t>(QF_MAGAZINE_SIZE / 2)) {
+        batch = static_cast<uint_fast32_t>(QF_MAGAZINE_SIZE / 2);
+    }
+    l_magBatch[idx] = static_cast<uint_fast16_t>(batch); // 0: not cached
+}
+//............................................................................
+void *QF_magGet_(QF_EPOOL_TYPE_ * const pool) {
+    uint_fast8_t const idx = static_cast<uint_fast8_t>(pool - &QF_pool_[0]);
+    uint_fast16_t const batch = l_magBatch[idx];
+    QFMagazine * const mag = &l_mag;
+
+    // empty magazine of a cached pool?
+    if ((mag->nFree[idx] == static_cast<uint_fast16_t>(0))
+        && (batch != static_cast<uint_fast16_t>(0)))
+    {
+        if (!mag->isReg) { // release the magazines at the thread exit
+            pthread_setspecific(l_magKey, mag);
+            mag->isReg = true;
+        }
+
+        // refill the magazine in one critical section, but leave at least
+        // one batch in the pool for the other threads
+        mag->head[idx] = static_cast<QFreeBlock *>(pool->getN(batch, batch));
+        if (mag->head[idx] != static_cast<QFreeBlock *>(0)) {
+            mag->nFree[idx] = batch;
+        }
+    }
+
+    void *b;
+    if (mag->nFree[idx] != static_cast<uint_fast16_t>(0)) {
+        QFreeBlock * const fb = mag->head[idx];
+        mag->head[idx] = fb->m_next;
+        --mag->nFree[idx];
+        b = fb;
+    }
+    else { // pool not cached or the refill not possible
+        b = pool->get(static_cast<uint_fast16_t>(0));
+    }
+    return b;
+}
+//............................................................................
+void QF_magPut_(QF_EPOOL_TYPE_ * const pool, void * const b) {
+    uint_fast8_t const idx = static_cast<uint_fast8_t>(pool - &QF_pool_[0]);
+    uint_fast16_t const batch = l_magBatch[idx];
+
+    if (batch == static_cast<uint_fast16_t>(0)) { // pool not cached?
+        pool->put(b);
+    }
+    else {
+        QFMagazine * const mag = &l_mag;
+
+        if (mag->nFree[idx] == (batch + batch)) { // magazine full?
+            // keep the recently used batch and spill the other one
+            QFreeBlock *fb = mag->head[idx];
+            for (uint_fast16_t i = static_cast<uint_fast16_t>(1);
+                 i < batch;
+                 ++i)
+            {
+                fb = fb->m_next;
+            }
+            QFreeBlock * const rest = fb->m_next;
+            fb->m_next = static_cast<QFreeBlock *>(0);
+            pool->putN(rest, batch);
+            mag->nFree[idx] = batch;
+        }
+        else if (!mag->isReg) { // release the magazines at the thread exit
+            pthread_setspecific(l_magKey, mag);
+            mag->isReg = true;
+        }
+        else {
+            // the magazine has room for the block
+        }
+
+        static_cast<QFreeBlock *>(b)->m_next = mag->head[idx];
+        mag->head[idx] = static_cast<QFreeBlock *>(b);
+        ++mag->nFree[idx];
+    }
+}
+//............................................................................
+static void magRelease(void *arg) { // the exiting thread
+    QFMagazine * const mag = static_cast<QFMagazine *>(arg);
+    for (uint_fast8_t idx = static_cast<uint_fast8_t>(0);
+         idx < QF_maxPool_;
+         ++idx)
+    {
+        if (mag->nFree[idx] != static_cast<uint_fast16_t>(0)) {
+            QF_pool_[idx].putN(mag->head[idx], mag->nFree[idx]);
+            mag->head[idx]  = static_cast<QFreeBlock *>(0);
+            mag->nFree[idx] = static_cast<uint_fast16_t>(0);
+        }
+    }
+    mag->isReg = false;
+}
+#endif // QF_POSIX_MAGAZINE
+
+#ifdef QF_POSIX_FUTEX
+
+//****************************************************************************
+// Futex-based blocking of active object threads, see NOTE4 in qf_port.h
+
+#if (defined __i386__) || (defined __x86_64__)
+    #define QF_CPU_RELAX()  __builtin_ia32_pause()
+#elif (defined __aarch64__) || (defined __arm__)
+    #define QF_CPU_RELAX()  __asm__ __volatile__ ("yield")
+#else
+    #define QF_CPU_RELAX()  __asm__ __volatile__ ("" ::: "memory")
+#endif
+
+static inline void QF_futex_(int32_t volatile *addr, int op, int32_t val) {
+    (void)syscall(SYS_futex, const_cast<int32_t *>(addr), op, val,
+                  static_cast<struct timespec const *>(0),
+                  static_cast<int32_t *>(0), 0);
+}
+
+//............................................................................
+QFParker::QFParker(void)
+  : m_state(static_cast<int32_t>(PARKER_RUNNING)),
+    m_spin(static_cast<uint32_t>(0))
+{}
+//............................................................................
+void QFParker::prepare(void) {
+    __atomic_store_n(&m_state, static_cast<int32_t>(PARKER_PARKED),
+                     __ATOMIC_SEQ_CST);
+}
+//............................................................................
+void QFParker::park(void) {
+    // spin phase: wait for the notification without a system call
+    for (uint32_t n = m_spin; n != static_cast<uint32_t>(0); --n) {
+        if (__atomic_load_n(&m_state, __ATOMIC_ACQUIRE)
+            != static_cast<int32_t>(PARKER_PARKED))
+        {
+            break;
+        }
+        QF_CPU_RELAX();
+    }
+
+    // still not notified? go to sleep in the kernel
+    int32_t state = static_cast<int32_t>(PARKER_PARKED);
+    if (__atomic_compare_exchange_n(&m_state, &state,
+            static_cast<int32_t>(PARKER_SLEEPING),
+            false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+    {
+        do {
+            QF_futex_(&m_state, FUTEX_WAIT_PRIVATE,
+                      static_cast<int32_t>(PARKER_SLEEPING));
+        } while (__atomic_load_n(&m_state, __ATOMIC_ACQUIRE)
+                 == static_cast<int32_t>(PARKER_SLEEPING));
+    }
+    __atomic_store_n(&m_state, static_cast<int32_t>(PARKER_RUNNING),
+                     __ATOMIC_RELAXED);
+}
+//............................................................................
+bool QFParker::notify(void) {
+    // the SEQ_CST load pairs with the SEQ_CST store in prepare()
+    int32_t state = __atomic_load_n(&m_state, __ATOMIC_SEQ_CST);
+    for (;;) {
+        int32_t next;
+        if (state == static_cast<int32_t>(PARKER_PARKED)) {
+            next = static_cast<int32_t>(PARKER_NOTIFIED); // no syscall
+        }
+        else if (state == static_cast<int32_t>(PARKER_SLEEPING)) {
+            next = static_cast<int32_t>(PARKER_WAKING); // see wake()
+        }
+        else { // running or already notified
+            return false;
+        }
+        if (__atomic_compare_exchange_n(&m_state, &state, next,
+                false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+        {
+            return (next == static_cast<int32_t>(PARKER_WAKING));
+        }
+    }
+}
+//............................................................................
+void QFParker::wake(void) {
+    int32_t state = static_cast<int32_t>(PARKER_WAKING);
+    if ((__atomic_load_n(&m_state, __ATOMIC_RELAXED) == state)
+        && __atomic_compare_exchange_n(&m_state, &state,
+               static_cast<int32_t>(PARKER_NOTIFIED),
+               false, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+    {
+        QF_futex_(&m_state, FUTEX_WAKE_PRIVATE, 1);
+    }
+}
+
+#endif // QF_POSIX_FUTEX
+
+#ifdef QF_POSIX_MPSC_QUEUE
+
+//****************************************************************************
+// Lock-free MPSC event queue of active objects, see NOTE3 in qf_port.h
+
+QMPSCQueue::QMPSCQueue(void)
+  : m_ring(static_cast<QEvt const * volatile *>(0)),
+    m_end(static_cast<QEQueueCtr>(0)),
+#ifndef QF_POSIX_FUTEX
+    m_waiting(static_cast<uint8_t>(0)),
+#endif
+    m_tail(static_cast<QEQueueCtr>(0)),
+    m_nFree(static_cast<QEQueueCtr>(0)),
+    m_nMin(static_cast<QEQueueCtr>(0)),
+    m_head(static_cast<QEQueueCtr>(0)),
+    m_extra(static_cast<QEvt const *>(0)),
+    m_nTicks(static_cast<QEQueueCtr>(0)),
+    m_tickRate(static_cast<uint8_t>(0))
+{}
+//............................................................................
+void QMPSCQueue::init(QEvt const *qSto[], uint_fast16_t const qLen) {
+    m_ring  = const_cast<QEvt const * volatile *>(&qSto[0]);
+    m_end   = static_cast<QEQueueCtr>(qLen);
+    for (uint_fast16_t i = static_cast<uint_fast16_t>(0); i < qLen; ++i) {
+        m_ring[i] = static_cast<QEvt const *>(0); // all slots empty
+    }
+    m_extra = static_cast<QEvt const *>(0);
+    m_head  = static_cast<QEQueueCtr>(0);
+    m_tail  = static_cast<QEQueueCtr>(0);
+    m_nFree = static_cast<QEQueueCtr>(
+                  qLen + static_cast<uint_fast16_t>(1)); // +1 for m_extra
+    m_nMin  = m_nFree;
+
+#ifndef QF_POSIX_FUTEX
+    m_waiting = static_cast<uint8_t>(0);
+    pthread_mutex_init(&m_mutex, NULL);
+    pthread_cond_init(&m_cond, 0);
+#endif
+}
+
+//............................................................................
+#ifndef Q_SPY
+bool QActive::post_(QEvt const * const e, uint_fast16_t const margin)
+#else
+bool QActive::post_(QEvt const * const e, uint_fast16_t const margin,
+                    void const * const sender)
+#endif
+{
+    /// @pre event pointer must be valid
+    Q_REQUIRE_ID(500, e != static_cast<QEvt const *>(0));
+
+    // reserve one free slot in the queue...
+    bool status;
+    QEQueueCtr nFree = __atomic_load_n(&m_eQueue.m_nFree, __ATOMIC_RELAXED);
+    for (;;) {
+        if (margin == QF_NO_MARGIN) {
+            status = (nFree > static_cast<QEQueueCtr>(0));
+        }
+        else {
+            status = (nFree > static_cast<QEQueueCtr>(margin));
+        }
+        if (!status) { // cannot post?
+            break;
+        }
+        // the acquire pairs with the release of the slot in get_()
+        if (__atomic_compare_exchange_n(&m_eQueue.m_nFree, &nFree,
+                static_cast<QEQueueCtr>(nFree - static_cast<QEQueueCtr>(1)),
+                true, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+            break; // slot reserved
+        }
+    }
+
+    if (status) { // can post the event?
+        QS_CRIT_STAT_
+
+        --nFree; // one free entry just used up
+
+        // update the minimum so far...
+        QEQueueCtr nMin = __atomic_load_n(&m_eQueue.m_nMin, __ATOMIC_RELAXED);
+        while ((nMin > nFree)
+               && (!__atomic_compare_exchange_n(&m_eQueue.m_nMin, &nMin,
+                        nFree, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)))
+        {
+        }
+
+        // is it a dynamic event?
+        if (e->poolId_ != static_cast<uint8_t>(0)) {
+            QF_EVT_REF_CTR_INC_(e); // increment the reference counter
+        }
+
+        QS_BEGIN_(QS_QF_ACTIVE_POST_FIFO,
+                  QS::priv_.locFilter[QS::AO_OBJ], this)
+            QS_TIME_();               // timestamp
+            QS_OBJ_(sender);          // the sender object
+            QS_SIG_(e->sig);          // the signal of the event
+            QS_OBJ_(this);            // this active object
+            QS_2U8_(e->poolId_, e->refCtr_); // pool Id & refCtr of the evt
+            QS_EQC_(static_cast<QEQueueCtr>(nFree + 1U)); // # free entries
+            QS_EQC_(m_eQueue.m_nMin); // min number of free entries
+        QS_END_()
+
+        // claim the index of the slot...
+        QEQueueCtr tail = __atomic_load_n(&m_eQueue.m_tail, __ATOMIC_RELAXED);
+        QEQueueCtr next;
+        do {
+            next = (tail == m_eQueue.m_end)
+                   ? static_cast<QEQueueCtr>(0)
+                   : static_cast<QEQueueCtr>(tail + static_cast<QEQueueCtr>(1));
+        } while (!__atomic_compare_exchange_n(&m_eQueue.m_tail, &tail, next,
+                      true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+        // deliver the event and wake up the consumer if it is blocked
+        __atomic_store_n(m_eQueue.slot(tail), e, __ATOMIC_SEQ_CST);
+#ifdef QF_POSIX_FUTEX
+        if (m_osObject.notify()) {
+            m_osObject.wake();
+        }
+#else
+        if (__atomic_load_n(&m_eQueue.m_waiting, __ATOMIC_SEQ_CST)
+            != static_cast<uint8_t>(0))
+        {
+            pthread_mutex_lock(&m_eQueue.m_mutex);
+            pthread_cond_signal(&m_eQueue.m_cond);
+            pthread_mutex_unlock(&m_eQueue.m_mutex);
+        }
+#endif // QF_POSIX_FUTEX
+    }
+    else { // cannot post the event
+
+        // must be able to post the event when margin is QF_NO_MARGIN
+        Q_ASSERT_ID(510, margin != QF_NO_MARGIN);
+
+        QS_CRIT_STAT_
+        QS_BEGIN_(QS_QF_ACTIVE_POST_ATTEMPT,
+                  QS::priv_.locFilter[QS::AO_OBJ], this)
+            QS_TIME_();           // timestamp
+            QS_OBJ_(sender);      // the sender object
+            QS_SIG_(e->sig);      // the signal of the event
+            QS_OBJ_(this);        // this active object
+            QS_2U8_(e->poolId_, e->refCtr_); // pool Id & refCtr of the evt
+            QS_EQC_(nFree);       // number of free entries
+            QS_EQC_(static_cast<QEQueueCtr>(margin)); // margin requested
+        QS_END_()
+
+        QF::gc(e); // recycle the evnet to avoid a leak
+    }
+
+    return status;
+}
+//............................................................................
+#ifndef Q_SPY
+uint_fast16_t QActive::postN_(QEvt const * const evts[],
+                              uint_fast16_t const n,
+                              uint_fast16_t const margin)
+#else
+uint_fast16_t QActive::postN_(QEvt const * const evts[],
+                              uint_fast16_t const n,
+                              uint_fast16_t const margin,
+                              void const * const sender)
+#endif
+{
+    /// @pre the event array must be valid
+    Q_REQUIRE_ID(1400, evts != static_cast<QEvt const * const *>(0));
+
+    // reserve the free slots for all the events (or as many as fit)...
+    uint_fast16_t nPost;
+    QEQueueCtr nFree = __atomic_load_n(&m_eQueue.m_nFree, __ATOMIC_RELAXED);
+    for (;;) {
+        if (margin == QF_NO_MARGIN) {
+            nPost = (static_cast<uint_fast16_t>(nFree) >= n)
+                    ? n
+                    : static_cast<uint_fast16_t>(0);
+        }
+        else if (nFree > static_cast<QEQueueCtr>(margin)) {
+            nPost = static_cast<uint_fast16_t>(nFree) - margin;
+            if (nPost > n) {
+                nPost = n;
+            }
+        }
+        else {
+            nPost = static_cast<uint_fast16_t>(0);
+        }
+        if (nPost == static_cast<uint_fast16_t>(0)) { // cannot post?
+            break;
+        }
+        // the acquire pairs with the release of the slots in get_()
+        if (__atomic_compare_exchange_n(&m_eQueue.m_nFree, &nFree,
+                static_cast<QEQueueCtr>(nFree - nPost),
+                true, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+            break; // slots reserved
+        }
+    }
+
+    // must be able to post all the events when margin is QF_NO_MARGIN
+    Q_ASSERT_ID(1410, (margin != QF_NO_MARGIN)
+                      || (nPost == n));
+
+    QS_CRIT_STAT_
+    uint_fast16_t i;
+    if (nPost > static_cast<uint_fast16_t>(0)) { // can post the events?
+        nFree = static_cast<QEQueueCtr>(nFree - nPost); // entries used up
+
+        // update the minimum so far...
+        QEQueueCtr nMin = __atomic_load_n(&m_eQueue.m_nMin, __ATOMIC_RELAXED);
+        while ((nMin > nFree)
+               && (!__atomic_compare_exchange_n(&m_eQueue.m_nMin, &nMin,
+                        nFree, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)))
+        {
+        }
+
+        // claim the indices of nPost consecutive slots...
+        QEQueueCtr tail = __atomic_load_n(&m_eQueue.m_tail, __ATOMIC_RELAXED);
+        QEQueueCtr next;
+        do {
+            uint_fast32_t t = static_cast<uint_fast32_t>(tail) + nPost;
+            if (t > static_cast<uint_fast32_t>(m_eQueue.m_end)) {
+                t -= static_cast<uint_fast32_t>(m_eQueue.m_end) + 1U;
+            }
+            next = static_cast<QEQueueCtr>(t);
+        } while (!__atomic_compare_exchange_n(&m_eQueue.m_tail, &tail, next,
+                      true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+        // deliver the events in order...
+        for (i = static_cast<uint_fast16_t>(0); i < nPost; ++i) {
+            QEvt const * const e = evts[i];
+
+            // is it a dynamic event?
+            if (e->poolId_ != static_cast<uint8_t>(0)) {
+                QF_EVT_REF_CTR_INC_(e); // increment the reference counter
+            }
+
+            QS_BEGIN_(QS_QF_ACTIVE_POST_FIFO,
+                      QS::priv_.locFilter[QS::AO_OBJ], this)
+                QS_TIME_();               // timestamp
+                QS_OBJ_(sender);          // the sender object
+                QS_SIG_(e->sig);          // the signal of the event
+                QS_OBJ_(this);            // this active object
+                QS_2U8_(e->poolId_, e->refCtr_); // pool Id & refCtr of evt
+                QS_EQC_(static_cast<QEQueueCtr>(nFree + nPost - i)); // free
+                QS_EQC_(m_eQueue.m_nMin); // min number of free entries
+            QS_END_()
+
+            __atomic_store_n(m_eQueue.slot(tail), e, __ATOMIC_SEQ_CST);
+            tail = (tail == m_eQueue.m_end)
+                ? static_cast<QEQueueCtr>(0)
+                : static_cast<QEQueueCtr>(tail + static_cast<QEQueueCtr>(1));
+        }
+
+        // wake up the consumer if it is blocked (only once)
+#ifdef QF_POSIX_FUTEX
+        if (m_osObject.notify()) {
+            m_osObject.wake();
+        }
+#else
+        if (__atomic_load_n(&m_eQueue.m_waiting, __ATOMIC_SEQ_CST)
+            != static_cast<uint8_t>(0))
+        {
+            pthread_mutex_lock(&m_eQueue.m_mutex);
+            pthread_cond_signal(&m_eQueue.m_cond);
+            pthread_mutex_unlock(&m_eQueue.m_mutex);
+        }
+#endif // QF_POSIX_FUTEX
+    }
+
+    for (i = nPost; i < n; ++i) { // the events that cannot be posted
+        QS_BEGIN_(QS_QF_ACTIVE_POST_ATTEMPT,
+                  QS::priv_.locFilter[QS::AO_OBJ], this)
+            QS_TIME_();           // timestamp
+            QS_OBJ_(sender);      // the sender object
+            QS_SIG_(evts[i]->sig); // the signal of the event
+            QS_OBJ_(this);        // this active object
+            QS_2U8_(evts[i]->poolId_, evts[i]->refCtr_); // pool Id & refCtr
+            QS_EQC_(nFree);       // number of free entries
+            QS_EQC_(static_cast<QEQueueCtr>(margin)); // margin requested
+        QS_END_()
+
+        QF::gc(evts[i]); // recycle the event to avoid a leak
+    }
+
+    return nPost;
+}
+//............................................................................
+// NOTE: can be called only by the owner active object (self-posting)
+void QActive::postLIFO(QEvt const * const e) {
+    QS_CRIT_STAT_
+
+    QEQueueCtr nFree = __atomic_fetch_sub(&m_eQueue.m_nFree,
+                           static_cast<QEQueueCtr>(1), __ATOMIC_ACQUIRE);
+
+    // the queue must be able to accept the event (cannot overflow)
+    Q_ASSERT_ID(610, nFree != static_cast<QEQueueCtr>(0));
+    --nFree; // one free entry just used up
+
+    QEQueueCtr nMin = __atomic_load_n(&m_eQueue.m_nMin, __ATOMIC_RELAXED);
+    while ((nMin > nFree)
+           && (!__atomic_compare_exchange_n(&m_eQueue.m_nMin, &nMin,
+                    nFree, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)))
+    {
+    }
+
+    // is it a dynamic event?
+    if (e->poolId_ != static_cast<uint8_t>(0)) {
+        QF_EVT_REF_CTR_INC_(e); // increment the reference counter
+    }
+
+    QS_BEGIN_(QS_QF_ACTIVE_POST_LIFO, QS::priv_.locFilter[QS::AO_OBJ], this)
+        QS_TIME_();                      // timestamp
+        QS_SIG_(e->sig);                 // the signal of this event
+        QS_OBJ_(this);                   // this active object
+        QS_2U8_(e->poolId_, e->refCtr_); // pool Id & refCtr of the evt
+        QS_EQC_(static_cast<QEQueueCtr>(nFree + 1U)); // # free entries
+        QS_EQC_(m_eQueue.m_nMin);        // min number of free entries
+    QS_END_()
+
+    // insert the event in front of the consumer's head
+    if (m_eQueue.m_head == static_cast<QEQueueCtr>(0)) {
+        m_eQueue.m_head = m_eQueue.m_end; // wrap around
+    }
+    else {
+        --m_eQueue.m_head;
+    }
+    __atomic_store_n(m_eQueue.slot(m_eQueue.m_head), e, __ATOMIC_RELAXED);
+    QACTIVE_EQUEUE_LIFO_(this); // the event goes ahead of the batch, NOTE14
+}
+//............................................................................
+QEvt const *QActive::get_(void) {
+    QEvt const * volatile *slot = m_eQueue.slot(m_eQueue.m_head);
+    QEvt const *e = __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+
+    if (e == static_cast<QEvt const *>(0)) { // queue empty? block
+#ifdef QF_POSIX_FUTEX
+        for (;;) {
+            m_osObject.prepare();
+            e = __atomic_load_n(slot, __ATOMIC_SEQ_CST);
+            if (e != static_cast<QEvt const *>(0)) {
+                __atomic_store_n(&m_osObject.m_state,
+                    static_cast<int32_t>(PARKER_RUNNING), __ATOMIC_RELAXED);
+                break;
+            }
+            m_osObject.park();
+        }
+#else
+        pthread_mutex_lock(&m_eQueue.m_mutex);
+        __atomic_store_n(&m_eQueue.m_waiting, static_cast<uint8_t>(1),
+                         __ATOMIC_SEQ_CST);
+        for (;;) {
+            e = __atomic_load_n(slot, __ATOMIC_SEQ_CST);
+            if (e != static_cast<QEvt const *>(0)) {
+                break;
+            }
+            pthread_cond_wait(&m_eQueue.m_cond, &m_eQueue.m_mutex);
+        }
+        __atomic_store_n(&m_eQueue.m_waiting, static_cast<uint8_t>(0),
+                         __ATOMIC_RELAXED);
+        pthread_mutex_unlock(&m_eQueue.m_mutex);
+#endif // QF_POSIX_FUTEX
+    }
+
+    // free the slot and only then release it to the producers
+    __atomic_store_n(slot, static_cast<QEvt const *>(0), __ATOMIC_RELAXED);
+    if (m_eQueue.m_head == m_eQueue.m_end) { // need to wrap the head?
+        m_eQueue.m_head = static_cast<QEQueueCtr>(0);
+    }
+    else {
+        ++m_eQueue.m_head;
+    }
+    QEQueueCtr nFree = __atomic_add_fetch(&m_eQueue.m_nFree,
+                           static_cast<QEQueueCtr>(1), __ATOMIC_RELEASE);
+
+    QS_CRIT_STAT_
+    if (nFree <= m_eQueue.m_end) { // any events left in the queue?
+        QS_BEGIN_(QS_QF_ACTIVE_GET, QS::priv_.locFilter[QS::AO_OBJ], this)
+            QS_TIME_();                      // timestamp
+            QS_SIG_(e->sig);                 // the signal of this event
+            QS_OBJ_(this);                   // this active object
+            QS_2U8_(e->poolId_, e->refCtr_); // pool Id & refCtr of the evt
+            QS_EQC_(nFree);                  // number of free entries
+        QS_END_()
+    }
+    else {
+        QS_BEGIN_(QS_QF_ACTIVE_GET_LAST,
+                  QS::priv_.locFilter[QS::AO_OBJ], this)
+            QS_TIME_();                      // timestamp
+            QS_SIG_(e->sig);                 // the signal of this event
+            QS_OBJ_(this);                   // this active object
+            QS_2U8_(e->poolId_, e->refCtr_); // pool Id & refCtr of the evt
+        QS_END_()
+    }
+    return e;
+}
+//............................................................................
+uint_fast16_t QActive::getBatch_(QEvt const *evts[], uint_fast16_t const max)
+{
+    /// @pre the event array must be valid and hold at least one event
+    Q_REQUIRE_ID(1420, (evts != static_cast<QEvt const **>(0))
+                       && (max > static_cast<uint_fast16_t>(0)));
+
+    evts[0] = get_(); // wait for the first event
+
+    // take the events already delivered, but stop at the first empty slot
+    uint_fast16_t n = static_cast<uint_fast16_t>(1);
+    QEQueueCtr head = m_eQueue.m_head;
+    while (n < max) {
+        QEvt const * volatile *slot = m_eQueue.slot(head);
+        QEvt const *e = __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+        if (e == static_cast<QEvt const *>(0)) {
+            break;
+        }
+        __atomic_store_n(slot, static_cast<QEvt const *>(0),
+                         __ATOMIC_RELAXED);
+        head = (head == m_eQueue.m_end)
+               ? static_cast<QEQueueCtr>(0)
+               : static_cast<QEQueueCtr>(head + static_cast<QEQueueCtr>(1));
+        evts[n] = e;
+        ++n;
+    }
+
+    if (n > static_cast<uint_fast16_t>(1)) {
+        m_eQueue.m_head = head;
+
+        // free the slots and only then release them to the producers
+        QEQueueCtr nFree = __atomic_add_fetch(&m_eQueue.m_nFree,
+                               static_cast<QEQueueCtr>(n - 1U),
+                               __ATOMIC_RELEASE);
+
+        QS_CRIT_STAT_
+        for (uint_fast16_t i = static_cast<uint_fast16_t>(1); i < n; ++i) {
+            QEQueueCtr const nf =
+                static_cast<QEQueueCtr>(nFree - (n - 1U - i)); // # free
+            if (nf <= m_eQueue.m_end) { // any events left in the queue?
+                QS_BEGIN_(QS_QF_ACTIVE_GET,
+                          QS::priv_.locFilter[QS::AO_OBJ], this)
+                    QS_TIME_();                      // timestamp
+                    QS_SIG_(evts[i]->sig);           // the signal of the evt
+                    QS_OBJ_(this);                   // this active object
+                    QS_2U8_(evts[i]->poolId_, evts[i]->refCtr_);
+                    QS_EQC_(nf);                     // # free entries
+                QS_END_()
+            }
+            else {
+                QS_BEGIN_(QS_QF_ACTIVE_GET_LAST,
+                          QS::priv_.locFilter[QS::AO_OBJ], this)
+                    QS_TIME_();                      // timestamp
+                    QS_SIG_(evts[i]->sig);           // the signal of the evt
+                    QS_OBJ_(this);                   // this active object
+                    QS_2U8_(evts[i]->poolId_, evts[i]->refCtr_);
+                QS_END_()
+            }
+        }
+    }
+    return n;
+}
+//............................................................................
+uint_fast16_t QF::getQueueMin(QPrio const prio) {
+    Q_REQUIRE_ID(700, (prio <= static_cast<QPrio>(QF_MAX_ACTIVE))
+                      && (active_[prio] != static_cast<QActive *>(0)));
+
+    return static_cast<uint_fast16_t>(
+        __atomic_load_n(&active_[prio]->m_eQueue.m_nMin, __ATOMIC_RELAXED));
+}
+
+//****************************************************************************
+QTicker::QTicker(uint_fast8_t const tickRate)
+  : QActive(Q_STATE_CAST(0))
+{
+    m_eQueue.m_tickRate = static_cast<uint8_t>(tickRate);
+}
+//............................................................................
+void QTicker::init(QEvt const * const /*e*/) {
+    m_eQueue.m_nTicks = static_cast<QEQueueCtr>(0);
+}
+//............................................................................
+void QTicker::dispatch(QEvt const * const /*e*/) {
+    // # ticks since the last call (clear the # ticks)
+    QEQueueCtr n = __atomic_exchange_n(&m_eQueue.m_nTicks,
+                       static_cast<QEQueueCtr>(0), __ATOMIC_ACQ_REL);
+
+    for (; n > static_cast<QEQueueCtr>(0); --n) {
+        QF::TICK_X(static_cast<uint_fast8_t>(m_eQueue.m_tickRate), this);
+    }
+}
+//............................................................................
+#ifndef Q_SPY
+bool QTicker::post_(QEvt const * const /*e*/, uint_fast16_t const /*margin*/)
+#else
+bool QTicker::post_(QEvt const * const /*e*/, uint_fast16_t const /*margin*/,
+                    void const * const sender)
+#endif
+{
+    // the first tick since the last dispatch? post the tick event
+    if (__atomic_fetch_add(&m_eQueue.m_nTicks, static_cast<QEQueueCtr>(1),
+                           __ATOMIC_ACQ_REL) == static_cast<QEQueueCtr>(0))
+    {
+#ifdef Q_EVT_CTOR
+        static QEvt const tickEvt(static_cast<QSignal>(0),
+                                  QEvt::STATIC_EVT);
+#else
+        static QEvt const tickEvt = { static_cast<QSignal>(0),
+                                      static_cast<uint8_t>(0),
+                                      static_cast<uint8_t>(0) };
+#endif // Q_EVT_CTOR
+
+        // only one tick event can be in the queue at any given time
+#ifndef Q_SPY
+        (void)QActive::post_(&tickEvt, QF_NO_MARGIN);
+#else
+        (void)QActive::post_(&tickEvt, QF_NO_MARGIN, sender);
+#endif
+    }
+    return true; // the event is always posted correctly
+}
+//............................................................................
+void QTicker::postLIFO(QEvt const * const /*e*/) {
+    Q_ERROR_ID(900); // operation not allowed
+}
+
+#endif // QF_POSIX_MPSC_QUEUE
+
+#ifdef QF_POSIX_LOCKFREE_POOL
+
+//****************************************************************************
+// Lock-free event pools, see NOTE8 in qf_port.h
+
+QLFMPool::QLFMPool(void)
+  : m_top(static_cast<uint64_t>(0)),
+    m_nFree(static_cast<QMPoolCtr>(0)),
+    m_nMin(static_cast<QMPoolCtr>(0)),
+    m_start(static_cast<void *>(0)),
+    m_end(static_cast<void *>(0)),
+    m_blockSize(static_cast<QMPoolSize>(0)),
+    m_nTot(static_cast<QMPoolCtr>(0))
+{}
+//............................................................................
+void QLFMPool::init(void * const poolSto, uint_fast32_t poolSize,
+                    uint_fast16_t blockSize)
+{
+    /// @pre The memory block must be valid and
+    /// the poolSize must fit at least one free block and
+    /// the blockSize must not be too close to the top of the dynamic range
+    Q_REQUIRE_ID(1100, (poolSto != static_cast<void *>(0))
+        && (poolSize >= static_cast<uint_fast32_t>(sizeof(QFreeBlock)))
+        && (static_cast<uint_fast16_t>(
+               blockSize + static_cast<uint_fast16_t>(sizeof(QFreeBlock)))
+            > blockSize));
+
+    // align the storage and round up the blockSize (see QMPool::init())
+    void *sto = poolSto;
+    uint_fast16_t const nblocks = QF_MPOOL_LAYOUT_(sto, poolSize, blockSize);
+    m_blockSize = static_cast<QMPoolSize>(blockSize);
+
+    // the whole pool buffer must fit at least one rounded-up block and
+    // the block numbers must fit the low half of the top word
+    Q_ASSERT_ID(1101, (poolSize >= static_cast<uint_fast32_t>(blockSize))
+        && ((static_cast<uint64_t>(poolSize) / sizeof(QFreeBlock))
+            < static_cast<uint64_t>(0xFFFFFFFFU)));
+
+    // chain all blocks together in a free-list...
+    poolSize -= static_cast<uint_fast32_t>(blockSize);
+    m_nTot = static_cast<QMPoolCtr>(1); // one (the last) block in the pool
+    QFreeBlock *fb = static_cast<QFreeBlock *>(sto);
+    while (poolSize >= static_cast<uint_fast32_t>(blockSize)) {
+        fb->m_next = &QF_PTR_AT_(fb, nblocks); // setup the next link
+        fb = fb->m_next;  // advance to next block
+        poolSize -= static_cast<uint_fast32_t>(blockSize);
+        ++m_nTot;         // increment the number of blocks so far
+    }
+    fb->m_next = static_cast<QFreeBlock *>(0); // the last link points to NULL
+
+    m_start = sto;       // the (aligned) start this pool buffer
+    m_end   = fb;        // the last block in this pool
+    m_top   = topOf(static_cast<QFreeBlock *>(sto),
+                    static_cast<uint64_t>(0));
+    m_nFree = m_nTot;    // all blocks are free
+    m_nMin  = m_nTot;    // the minimum number of free blocks
+}
+//............................................................................
+uint64_t QLFMPool::topOf(QFreeBlock const * const b,
+                         uint64_t const top) const
+{
+    uint64_t n = static_cast<uint64_t>(0); // the empty stack
+    if (b != static_cast<QFreeBlock const *>(0)) {
+        n = (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(b)
+                 - reinterpret_cast<uintptr_t>(m_start))
+             / sizeof(QFreeBlock)) + static_cast<uint64_t>(1);
+    }
+    // the next tag in the high half
+    return (((top >> 32) + static_cast<uint64_t>(1)) << 32) | n;
+}
+//............................................................................
+QFreeBlock *QLFMPool::blockOf(uint64_t const top) const {
+    uint64_t const n = (top & static_cast<uint64_t>(0xFFFFFFFFU));
+    return (n == static_cast<uint64_t>(0))
+        ? static_cast<QFreeBlock *>(0)
+        : (static_cast<QFreeBlock *>(m_start)
+           + static_cast<uintptr_t>(n - static_cast<uint64_t>(1)));
+}
+//............................................................................
+bool QLFMPool::reserve(uint_fast16_t const n, uint_fast16_t const margin) {
+    bool status;
+    QMPoolCtr nFree = __atomic_load_n(&m_nFree, __ATOMIC_RELAXED);
+    for (;;) {
+        status = (static_cast<uint_fast32_t>(nFree)
+                  >= (static_cast<uint_fast32_t>(n) + margin));
+        if (!status) { // not enough free blocks?
+            break;
+        }
+        // the acquire pairs with the release after the push in push()
+        if (__atomic_compare_exchange_n(&m_nFree, &nFree,
+                static_cast<QMPoolCtr>(nFree - static_cast<QMPoolCtr>(n)),
+                true, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+            break; // blocks reserved
+        }
+    }
+
+    if (status) {
+        nFree -= static_cast<QMPoolCtr>(n);
+
+        // update the minimum so far...
+        QMPoolCtr nMin = __atomic_load_n(&m_nMin, __ATOMIC_RELAXED);
+        while ((nMin > nFree)
+               && (!__atomic_compare_exchange_n(&m_nMin, &nMin,
+                        nFree, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)))
+        {
+        }
+    }
+    return status;
+}
+//............................................................................
+QFreeBlock *QLFMPool::pop(void) {
+    QFreeBlock *fb;
+    QFreeBlock *fb_next;
+    uint64_t top = __atomic_load_n(&m_top, __ATOMIC_ACQUIRE);
+    do {
+        fb = blockOf(top);
+
+        // a block has been reserved, so the stack cannot be empty
+        Q_ASSERT_ID(1110, fb != static_cast<QFreeBlock *>(0));
+
+        // the link might be stale (the block taken by another thread),
+        // but then the tag has changed and the CAS below fails
+        fb_next = __atomic_load_n(&fb->m_next, __ATOMIC_RELAXED);
+    } while (!__atomic_compare_exchange_n(&m_top, &top, topOf(fb_next, top),
+                 true, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE));
+
+    // the next free block must be NULL or in range (see NOTE in
+    // QMPool::get() about corrupting the next free block)
+    Q_ASSERT_ID(1111, (fb_next == static_cast<QFreeBlock *>(0))
+                      || QF_PTR_RANGE_(fb_next, m_start, m_end));
+    return fb;
+}
+//............................................................................
+void QLFMPool::push(QFreeBlock * const head, QFreeBlock * const tail) {
+    uint64_t top = __atomic_load_n(&m_top, __ATOMIC_RELAXED);
+    do {
+        __atomic_store_n(&tail->m_next, blockOf(top), __ATOMIC_RELAXED);
+    } while (!__atomic_compare_exchange_n(&m_top, &top, topOf(head, top),
+                 true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+//............................................................................
+void *QLFMPool::get(uint_fast16_t const margin) {
+    QFreeBlock *fb;
+    QS_CRIT_STAT_
+
+    if (reserve(static_cast<uint_fast16_t>(1), margin)) {
+        fb = pop();
+
+        QS_BEGIN_(QS_QF_MPOOL_GET, QS::priv_.locFilter[QS::MP_OBJ], m_start)
+            QS_TIME_();        // timestamp
+            QS_OBJ_(m_start);  // the memory managed by this pool
+            QS_MPC_(m_nFree);  // the number of free blocks in the pool
+            QS_MPC_(m_nMin);   // the mninimum # free blocks in the pool
+        QS_END_()
+    }
+    else { // don't have enough free blocks at this point
+        fb = static_cast<QFreeBlock *>(0);
+
+        QS_BEGIN_(QS_QF_MPOOL_GET_ATTEMPT,
+                  QS::priv_.locFilter[QS::MP_OBJ], m_start)
+            QS_TIME_();        // timestamp
+            QS_OBJ_(m_start);  // the memory managed by this pool
+            QS_MPC_(m_nFree);  // the # free blocks in the pool
+            QS_MPC_(margin);   // the requested margin
+        QS_END_()
+    }
+    return fb; // return the block or NULL pointer to the caller
+}
+//............................................................................
+void QLFMPool::put(void * const b) {
+    /// @pre # free blocks cannot exceed the total # blocks and
+    /// the block pointer must be in range to come from this pool.
+    Q_REQUIRE_ID(1120, (__atomic_load_n(&m_nFree, __ATOMIC_RELAXED) < m_nTot)
+                       && QF_PTR_RANGE_(b, m_start, m_end));
+    QS_CRIT_STAT_
+
+    push(static_cast<QFreeBlock *>(b), static_cast<QFreeBlock *>(b));
+    // the block is on the stack, so it can be reserved now
+    (void)__atomic_add_fetch(&m_nFree, static_cast<QMPoolCtr>(1),
+                             __ATOMIC_RELEASE);
+
+    QS_BEGIN_(QS_QF_MPOOL_PUT, QS::priv_.locFilter[QS::MP_OBJ], m_start)
+        QS_TIME_();       // timestamp
+        QS_OBJ_(m_start); // the memory managed by this pool
+        QS_MPC_(m_nFree); // the number of free blocks in the pool
+    QS_END_()
+}
+//............................................................................
+void *QLFMPool::getN(uint_fast16_t const n, uint_fast16_t const margin) {
+    /// @pre at least one block must be requested
+    Q_REQUIRE_ID(1130, n != static_cast<uint_fast16_t>(0));
+
+    QFreeBlock *head;
+    QS_CRIT_STAT_
+
+    if (reserve(n, margin)) {
+        // pop the reserved blocks one by one (only the top is atomic)
+        head = pop();
+        QFreeBlock *tail = head;
+        for (uint_fast16_t i = static_cast<uint_fast16_t>(1); i < n; ++i) {
+            QFreeBlock * const fb = pop();
+            tail->m_next = fb;
+            tail = fb;
+        }
+        tail->m_next = static_cast<QFreeBlock *>(0); // terminate the chain
+
+        // one trace record for the whole chain
+        QS_BEGIN_(QS_QF_MPOOL_GET, QS::priv_.locFilter[QS::MP_OBJ], m_start)
+            QS_TIME_();        // timestamp
+            QS_OBJ_(m_start);  // the memory managed by this pool
+            QS_MPC_(m_nFree);  // the number of free blocks in the pool
+            QS_MPC_(m_nMin);   // the mninimum # free blocks in the pool
+        QS_END_()
+    }
+    else { // don't have enough free blocks at this point
+        head = static_cast<QFreeBlock *>(0);
+
+        QS_BEGIN_(QS_QF_MPOOL_GET_ATTEMPT,
+                  QS::priv_.locFilter[QS::MP_OBJ], m_start)
+            QS_TIME_();        // timestamp
+            QS_OBJ_(m_start);  // the memory managed by this pool
+            QS_MPC_(m_nFree);  // the # free blocks in the pool
+            QS_MPC_(margin);   // the requested margin
+        QS_END_()
+    }
+    return head; // return the chain or NULL pointer to the caller
+}
+//............................................................................
+void QLFMPool::putN(void * const chain, uint_fast16_t const n) {
+    /// @pre the chain must have at least one block from this pool
+    Q_REQUIRE_ID(1140, (n != static_cast<uint_fast16_t>(0))
+                       && QF_PTR_RANGE_(chain, m_start, m_end));
+
+    QFreeBlock *tail = static_cast<QFreeBlock *>(chain);
+    for (uint_fast16_t i = static_cast<uint_fast16_t>(1); i < n; ++i) {
+        tail = tail->m_next;
+
+        /// @pre all blocks in the chain must come from this pool
+        Q_REQUIRE_ID(1141, QF_PTR_RANGE_(tail, m_start, m_end));
+    }
+    QS_CRIT_STAT_
+
+    // the whole chain is pushed with one compare-and-swap
+    push(static_cast<QFreeBlock *>(chain), tail);
+    QMPoolCtr const nFree = __atomic_add_fetch(&m_nFree,
+                                static_cast<QMPoolCtr>(n), __ATOMIC_RELEASE);
+
+    // # free blocks cannot exceed the total # blocks
+    Q_ASSERT_ID(1142, nFree <= m_nTot);
+
+    // one trace record for the whole chain
+    QS_BEGIN_(QS_QF_MPOOL_PUT, QS::priv_.locFilter[QS::MP_OBJ], m_start)
+        QS_TIME_();       // timestamp
+        QS_OBJ_(m_start); // the memory managed by this pool
+        QS_MPC_(nFree);   // the number of free blocks in the pool
+    QS_END_()
+}
+//............................................................................
+uint_fast16_t QF::getPoolMin(uint_fast8_t const poolId) {
+    Q_REQUIRE_ID(1150, (static_cast<uint_fast8_t>(1) <= poolId)
+                       && (poolId <= QF_maxPool_));
+
+    return static_cast<uint_fast16_t>(__atomic_load_n(
+        &QF_pool_[poolId - static_cast<uint_fast8_t>(1)].m_nMin,
+        __ATOMIC_RELAXED));
+}
+
+#endif // QF_POSIX_LOCKFREE_POOL
+
+#ifdef QF_POSIX_ELASTIC_POOL
+
+//****************************************************************************
+// Elastic event pools, see NOTE10 in qf_port.h
+
+// map the slab at @p slab as read-write memory (huge pages if possible)
+static bool slabCommit(void * const slab) {
+    void *p = MAP_FAILED;
+#if (defined QF_ELASTIC_HUGETLB) && (defined MAP_HUGETLB)
+    p = mmap(slab, static_cast<size_t>(QF_ELASTIC_SLAB_SIZE),
+             PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED | MAP_HUGETLB, -1, 0);
+#endif
+    if (p == MAP_FAILED) {
+        p = mmap(slab, static_cast<size_t>(QF_ELASTIC_SLAB_SIZE),
+                 PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+#ifdef MADV_HUGEPAGE
+        if (p != MAP_FAILED) { // transparent huge pages (if enabled)
+            (void)madvise(p, static_cast<size_t>(QF_ELASTIC_SLAB_SIZE),
+                          MADV_HUGEPAGE);
+        }
+#endif
+    }
+    return (p != MAP_FAILED);
+}
+//............................................................................
+// return the slab at @p slab to the OS, but keep its address range reserved
+static void slabRelease(void * const slab) {
+    (void)mmap(slab, static_cast<size_t>(QF_ELASTIC_SLAB_SIZE), PROT_NONE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED | MAP_NORESERVE,
+               -1, 0);
+}
+
+//............................................................................
+QElasticMPool::QElasticMPool(void)
+  : m_free_head(static_cast<void *>(0)),
+    m_start(static_cast<void *>(0)),
+    m_end(static_cast<void *>(0)),
+    m_map(static_cast<uint8_t *>(0)),
+    m_mapEnd(static_cast<uint8_t *>(0)),
+    m_blockSize(static_cast<QMPoolSize>(0)),
+    m_slabBlocks(static_cast<QMPoolCtr>(0)),
+    m_nTot(static_cast<QMPoolCtr>(0)),
+    m_nFree(static_cast<QMPoolCtr>(0)),
+    m_nMin(static_cast<QMPoolCtr>(0)),
+    m_highWater(static_cast<uint_fast16_t>(QF_ELASTIC_HIGH_WATER)),
+    m_nSlabs(static_cast<uint_fast16_t>(0))
+{}
+//............................................................................
+void QElasticMPool::init(void * const poolSto, uint_fast32_t poolSize,
+                         uint_fast16_t blockSize)
+{
+    /// @pre the blockSize must not be too close to the top of the dynamic
+    /// range and the provided storage (if any) must fit at least one block
+    Q_REQUIRE_ID(1200, (static_cast<uint_fast16_t>(
+               blockSize + static_cast<uint_fast16_t>(sizeof(QFreeBlock)))
+            > blockSize)
+        && ((poolSto == static_cast<void *>(0))
+            || (poolSize >= static_cast<uint_fast32_t>(sizeof(QFreeBlock)))));
+
+    // align the storage and round up the blockSize (see QMPool::init()),
+    // the slabs are aligned to the slab size anyway
+    void *sto = poolSto;
+    uint_fast16_t const nblocks = QF_MPOOL_LAYOUT_(sto, poolSize, blockSize);
+    m_blockSize = static_cast<QMPoolSize>(blockSize);
+
+    // a slab must fit at least one rounded-up block
+    Q_ASSERT_ID(1201, static_cast<unsigned long>(blockSize)
+                      <= static_cast<unsigned long>(QF_ELASTIC_SLAB_SIZE));
+    m_slabBlocks = static_cast<QMPoolCtr>(
+        static_cast<unsigned long>(QF_ELASTIC_SLAB_SIZE) / blockSize);
+
+    // chain the blocks of the provided storage (if any) in a free-list...
+    m_free_head = static_cast<void *>(0);
+    m_start = static_cast<void *>(0);
+    m_end   = static_cast<void *>(0);
+    m_nTot  = static_cast<QMPoolCtr>(0);
+    if ((sto != static_cast<void *>(0))
+        && (poolSize >= static_cast<uint_fast32_t>(blockSize)))
+    {
+        poolSize -= static_cast<uint_fast32_t>(blockSize);
+        m_nTot = static_cast<QMPoolCtr>(1); // one (the last) block
+        QFreeBlock *fb = static_cast<QFreeBlock *>(sto);
+        while (poolSize >= static_cast<uint_fast32_t>(blockSize)) {
+            fb->m_next = &QF_PTR_AT_(fb, nblocks); // setup the next link
+            fb = fb->m_next;  // advance to next block
+            poolSize -= static_cast<uint_fast32_t>(blockSize);
+            ++m_nTot;
+        }
+        fb->m_next = static_cast<QFreeBlock *>(0); // the last link is NULL
+        m_free_head = sto;
+        m_start = sto;
+        m_end   = fb;
+    }
+    m_nFree = m_nTot; // all blocks are free
+    m_nMin  = m_nTot; // the minimum number of free blocks
+
+    // reserve the address range for the slabs (no memory committed yet),
+    // one extra slab to align the range to the slab size (huge pages)
+    size_t const len = static_cast<size_t>(QF_ELASTIC_MAX_SLABS)
+                       * static_cast<size_t>(QF_ELASTIC_SLAB_SIZE);
+    size_t const slab = static_cast<size_t>(QF_ELASTIC_SLAB_SIZE);
+    void * const p = mmap(NULL, len + slab, PROT_NONE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+                          -1, 0);
+    Q_ASSERT_ID(1202, p != MAP_FAILED);
+
+    uintptr_t const start = reinterpret_cast<uintptr_t>(p);
+    uintptr_t const aligned = (start + (slab - 1U))
+                              & ~static_cast<uintptr_t>(slab - 1U);
+    if (aligned != start) { // trim the unaligned head
+        (void)munmap(p, aligned - start);
+    }
+    if ((aligned - start) != slab) { // trim the tail
+        (void)munmap(reinterpret_cast<void *>(aligned + len),
+                     slab - (aligned - start));
+    }
+    m_map    = reinterpret_cast<uint8_t *>(aligned);
+    m_mapEnd = m_map;
+    m_nSlabs = static_cast<uint_fast16_t>(0);
+    bzero(&m_slabHead[0], sizeof(m_slabHead));
+    bzero(&m_slabFree[0], sizeof(m_slabFree));
+    bzero(&m_slabAvail[0], sizeof(m_slabAvail));
+
+    pthread_mutex_init(&m_slabMutex, NULL);
+    QF_CRIT_OBJ_INIT_(&m_crit); // init the lock of this pool (if used)
+}
+//............................................................................
+bool QElasticMPool::inRange(void const * const b) const {
+    return QF_PTR_RANGE_(b, static_cast<void const *>(m_start),
+                            static_cast<void const *>(m_end))
+           || ((static_cast<void const *>(m_map) <= b)
+               && (b < static_cast<void const *>(m_mapEnd)));
+}
+//............................................................................
+QFreeBlock *QElasticMPool::pop(void) {
+    QFreeBlock *fb = static_cast<QFreeBlock *>(m_free_head);
+    if (fb != static_cast<QFreeBlock *>(0)) { // provided storage first
+        void * const fb_next = fb->m_next; // volatile to a temporary
+        if ((fb_next == static_cast<void *>(0)) || inRange(fb_next)) {
+            m_free_head = fb_next;
+        }
+        else {
+            fb = static_cast<QFreeBlock *>(0); // corrupt free list
+        }
+    }
+    else { // the lowest slab with free blocks, so the top slabs drain
+        uint_fast16_t w = static_cast<uint_fast16_t>(0);
+        while ((w < static_cast<uint_fast16_t>(AVAIL_WORDS))
+               && (m_slabAvail[w] == static_cast<uint32_t>(0)))
+        {
+            ++w;
+        }
+        if (w < static_cast<uint_fast16_t>(AVAIL_WORDS)) {
+            uint_fast16_t const i = static_cast<uint_fast16_t>((w << 5)
+                + static_cast<uint_fast16_t>(__builtin_ctz(m_slabAvail[w])));
+            fb = m_slabHead[i];
+            QFreeBlock * const fb_next = fb->m_next;
+            if ((fb_next == static_cast<QFreeBlock *>(0))
+                || inRange(fb_next))
+            {
+                m_slabHead[i] = fb_next;
+                --m_slabFree[i];
+                if (m_slabFree[i] == static_cast<QMPoolCtr>(0)) {
+                    m_slabAvail[w] &= ~(static_cast<uint32_t>(1)
+                                        << (i & 0x1FU));
+                }
+            }
+            else {
+                fb = static_cast<QFreeBlock *>(0); // corrupt free list
+            }
+        }
+    }
+    return fb;
+}
+//............................................................................
+void QElasticMPool::push(void * const b) {
+    QFreeBlock * const fb = static_cast<QFreeBlock *>(b);
+    uint8_t const * const p = static_cast<uint8_t const *>(b);
+    if ((m_map <= p) && (p < m_mapEnd)) { // block from a slab?
+        size_t const i = static_cast<size_t>(p - m_map)
+                         / static_cast<size_t>(QF_ELASTIC_SLAB_SIZE);
+        fb->m_next = m_slabHead[i];
+        m_slabHead[i] = fb;
+        if (m_slabFree[i] == static_cast<QMPoolCtr>(0)) {
+            m_slabAvail[i >> 5] |= (static_cast<uint32_t>(1)
+                                    << (i & 0x1FU));
+        }
+        ++m_slabFree[i];
+    }
+    else { // block from the provided storage
+        fb->m_next = static_cast<QFreeBlock *>(m_free_head);
+        m_free_head = b;
+    }
+}
+//............................................................................
+bool QElasticMPool::canShrink(void) const {
+    return (m_nSlabs != static_cast<uint_fast16_t>(0))
+        && (m_slabFree[m_nSlabs - static_cast<uint_fast16_t>(1)]
+            == m_slabBlocks)
+        && (static_cast<uint_fast32_t>(m_nFree)
+            >= (static_cast<uint_fast32_t>(m_highWater + 1U)
+                * static_cast<uint_fast32_t>(m_slabBlocks)));
+}
+//............................................................................
+bool QElasticMPool::grow(uint_fast32_t const need) {
+    bool status = true;
+    pthread_mutex_lock(&m_slabMutex);
+
+    // no other thread committed a slab or returned blocks in the meantime?
+    if (static_cast<uint_fast32_t>(m_nFree) < need) {
+        uint_fast16_t const i = m_nSlabs;
+        uint8_t * const slab = m_map
+            + (static_cast<size_t>(i)
+               * static_cast<size_t>(QF_ELASTIC_SLAB_SIZE));
+
+        status = (i < static_cast<uint_fast16_t>(QF_ELASTIC_MAX_SLABS))
+                 && slabCommit(slab);
+        if (status) {
+            // chain all blocks of the new slab outside critical section
+            QFreeBlock *fb = reinterpret_cast<QFreeBlock *>(slab);
+            for (QMPoolCtr k = static_cast<QMPoolCtr>(1);
+                 k < m_slabBlocks;
+                 ++k)
+            {
+                fb->m_next = reinterpret_cast<QFreeBlock *>(
+                    reinterpret_cast<uint8_t *>(fb) + m_blockSize);
+                fb = fb->m_next;
+            }
+
+            fb->m_next = static_cast<QFreeBlock *>(0);
+
+            QF_CRIT_STAT_
+            QF_CRIT_OBJ_ENTRY_(&m_crit);
+            m_slabHead[i] = reinterpret_cast<QFreeBlock *>(slab);
+            m_nFree += m_slabBlocks;
+            m_nTot  += m_slabBlocks;
+            m_slabFree[i] = m_slabBlocks;
+            m_slabAvail[i >> 5] |= (static_cast<uint32_t>(1)
+                                    << (i & 0x1FU));
+            m_mapEnd = slab + static_cast<size_t>(QF_ELASTIC_SLAB_SIZE);
+            m_nSlabs = i + static_cast<uint_fast16_t>(1);
+            QF_CRIT_EXIT_();
+        }
+    }
+
+    pthread_mutex_unlock(&m_slabMutex);
+    return status;
+}
+//............................................................................
+void QElasticMPool::shrink(void) {
+    pthread_mutex_lock(&m_slabMutex);
+
+    uint8_t *slab;
+    do { // release the free slabs from the top, one at a time
+        slab = static_cast<uint8_t *>(0);
+
+        QF_CRIT_STAT_
+        QF_CRIT_OBJ_ENTRY_(&m_crit);
+        if (canShrink()) { // still true?
+            uint_fast16_t const top = m_nSlabs - static_cast<uint_fast16_t>(1);
+            slab = m_map + (static_cast<size_t>(top)
+                            * static_cast<size_t>(QF_ELASTIC_SLAB_SIZE));
+
+            // drop the free list of the top slab, which has all its blocks
+            m_slabHead[top] = static_cast<QFreeBlock *>(0);
+            m_slabFree[top] = static_cast<QMPoolCtr>(0);
+            m_slabAvail[top >> 5] &= ~(static_cast<uint32_t>(1)
+                                       << (top & 0x1FU));
+            m_nFree -= m_slabBlocks;
+            m_nTot  -= m_slabBlocks;
+            m_nSlabs = top;
+            m_mapEnd = slab;
+        }
+        QF_CRIT_EXIT_();
+
+        if (slab != static_cast<uint8_t *>(0)) {
+            slabRelease(slab); // the system call outside critical section
+        }
+    } while (slab != static_cast<uint8_t *>(0));
+
+    pthread_mutex_unlock(&m_slabMutex);
+}
+//............................................................................
+void *QElasticMPool::get(uint_fast16_t const margin) {
+    QFreeBlock *fb = static_cast<QFreeBlock *>(0);
+    bool status;
+    do {
+        QF_CRIT_STAT_
+        QF_CRIT_OBJ_ENTRY_(&m_crit);
+        status = (m_nFree > static_cast<QMPoolCtr>(margin));
+        if (status) {
+            fb = pop(); // get a free block
+
+            // the pool has some free blocks, so a free block must be there
+            // and the next free block must be in range (see NOTE in
+            // QMPool::get())
+            Q_ASSERT_CRIT_(1210, fb != static_cast<QFreeBlock *>(0));
+
+            --m_nFree; // one free block less
+            if (m_nMin > m_nFree) {
+                m_nMin = m_nFree; // remember the minimum so far
+            }
+
+            QS_BEGIN_NOCRIT_(QS_QF_MPOOL_GET,
+                             QS::priv_.locFilter[QS::MP_OBJ], m_map)
+                QS_TIME_();        // timestamp
+                QS_OBJ_(m_map);    // the memory managed by this pool
+                QS_MPC_(m_nFree);  // the number of free blocks in the pool
+                QS_MPC_(m_nMin);   // the mninimum # free blocks in the pool
+            QS_END_NOCRIT_()
+        }
+        QF_CRIT_EXIT_();
+    } while ((!status)
+             && grow(static_cast<uint_fast32_t>(margin) + 1U));
+
+    if (!status) { // the whole reserved range is already committed
+        QS_CRIT_STAT_
+        QS_BEGIN_(QS_QF_MPOOL_GET_ATTEMPT,
+                  QS::priv_.locFilter[QS::MP_OBJ], m_map)
+            QS_TIME_();        // timestamp
+            QS_OBJ_(m_map);    // the memory managed by this pool
+            QS_MPC_(m_nFree);  // the # free blocks in the pool
+            QS_MPC_(margin);   // the requested margin
+        QS_END_()
+    }
+    return fb; // return the block or NULL pointer to the caller
+}
+//............................................................................
+void QElasticMPool::put(void * const b) {
+    /// @pre # free blocks cannot exceed the total # blocks and
+    /// the block pointer must come from this pool (storage or slab)
+    Q_REQUIRE_ID(1220, (m_nFree < m_nTot) && inRange(b));
+
+    QF_CRIT_STAT_
+    QF_CRIT_OBJ_ENTRY_(&m_crit);
+    push(b);   // link into the free list
+    ++m_nFree; // one more free block in this pool
+
+    QS_BEGIN_NOCRIT_(QS_QF_MPOOL_PUT,
+                     QS::priv_.locFilter[QS::MP_OBJ], m_map)
+        QS_TIME_();       // timestamp
+        QS_OBJ_(m_map);   // the memory managed by this pool
+        QS_MPC_(m_nFree); // the number of free blocks in the pool
+    QS_END_NOCRIT_()
+
+    bool const shrinkable = canShrink();
+    QF_CRIT_EXIT_();
+
+    if (shrinkable) {
+        shrink();
+    }
+}
+//............................................................................
+void *QElasticMPool::getN(uint_fast16_t const n, uint_fast16_t const margin)
+{
+    /// @pre at least one block must be requested
+    Q_REQUIRE_ID(1230, n != static_cast<uint_fast16_t>(0));
+
+    QFreeBlock *head = static_cast<QFreeBlock *>(0);
+    uint_fast32_t const need = static_cast<uint_fast32_t>(n) + margin;
+    bool status;
+    do {
+        QF_CRIT_STAT_
+        QF_CRIT_OBJ_ENTRY_(&m_crit);
+        status = (static_cast<uint_fast32_t>(m_nFree) >= need);
+        if (status) {
+            head = pop();
+            QFreeBlock *fb = head;
+            for (uint_fast16_t i = static_cast<uint_fast16_t>(1);
+                 (i < n) && (fb != static_cast<QFreeBlock *>(0));
+                 ++i)
+            {
+                fb->m_next = pop();
+                fb = fb->m_next;
+            }
+
+            // the free blocks must be there and the free list in range
+            Q_ASSERT_CRIT_(1231, fb != static_cast<QFreeBlock *>(0));
+            fb->m_next = static_cast<QFreeBlock *>(0); // terminate chain
+
+            m_nFree -= static_cast<QMPoolCtr>(n); // n free blocks less
+            if (m_nMin > m_nFree) {
+                m_nMin = m_nFree; // remember the minimum so far
+            }
+
+            // one trace record for the whole chain
+            QS_BEGIN_NOCRIT_(QS_QF_MPOOL_GET,
+                             QS::priv_.locFilter[QS::MP_OBJ], m_map)
+                QS_TIME_();        // timestamp
+                QS_OBJ_(m_map);    // the memory managed by this pool
+                QS_MPC_(m_nFree);  // the number of free blocks in the pool
+                QS_MPC_(m_nMin);   // the mninimum # free blocks in the pool
+            QS_END_NOCRIT_()
+        }
+        QF_CRIT_EXIT_();
+    } while ((!status) && grow(need));
+
+    if (!status) { // the whole reserved range is already committed
+        QS_CRIT_STAT_
+        QS_BEGIN_(QS_QF_MPOOL_GET_ATTEMPT,
+                  QS::priv_.locFilter[QS::MP_OBJ], m_map)
+            QS_TIME_();        // timestamp
+            QS_OBJ_(m_map);    // the memory managed by this pool
+            QS_MPC_(m_nFree);  // the # free blocks in the pool
+            QS_MPC_(margin);   // the requested margin
+        QS_END_()
+    }
+    return head; // return the chain or NULL pointer to the caller
+}
+//............................................................................
+void QElasticMPool::putN(void * const chain, uint_fast16_t const n) {
+    /// @pre the chain must have at least one block from this pool
+    Q_REQUIRE_ID(1240, (n != static_cast<uint_fast16_t>(0))
+                       && inRange(chain));
+
+    QFreeBlock *tail = static_cast<QFreeBlock *>(chain);
+    for (uint_fast16_t i = static_cast<uint_fast16_t>(1); i < n; ++i) {
+        tail = tail->m_next;
+
+        /// @pre all blocks in the chain must come from this pool
+        Q_REQUIRE_ID(1241, inRange(tail));
+    }
+
+    QF_CRIT_STAT_
+    QF_CRIT_OBJ_ENTRY_(&m_crit);
+
+    // # free blocks cannot exceed the total # blocks
+    Q_ASSERT_CRIT_(1242, (static_cast<uint_fast32_t>(m_nFree) + n)
+                         <= static_cast<uint_fast32_t>(m_nTot));
+
+    // link every block into the free list of its slab or of the storage
+    QFreeBlock *fb = static_cast<QFreeBlock *>(chain);
+    for (uint_fast16_t i = static_cast<uint_fast16_t>(0); i < n; ++i) {
+        QFreeBlock * const next = fb->m_next;
+        push(fb);
+        fb = next;
+    }
+    m_nFree += static_cast<QMPoolCtr>(n); // n more free blocks in this pool
+
+    // one trace record for the whole chain
+    QS_BEGIN_NOCRIT_(QS_QF_MPOOL_PUT,
+                     QS::priv_.locFilter[QS::MP_OBJ], m_map)
+        QS_TIME_();       // timestamp
+        QS_OBJ_(m_map);   // the memory managed by this pool
+        QS_MPC_(m_nFree); // the number of free blocks in the pool
+    QS_END_NOCRIT_()
+
+    bool const shrinkable = canShrink();
+    QF_CRIT_EXIT_();
+
+    if (shrinkable) {
+        shrink();
+    }
+}
+//............................................................................
+uint_fast16_t QF::getPoolMin(uint_fast8_t const poolId) {
+    Q_REQUIRE_ID(1250, (static_cast<uint_fast8_t>(1) <= poolId)
+                       && (poolId <= QF_maxPool_));
+
+    QF_CRIT_STAT_
+    QF_CRIT_OBJ_ENTRY_(
+        &QF_pool_[poolId - static_cast<uint_fast8_t>(1)].m_crit);
+    uint_fast16_t min = static_cast<uint_fast16_t>(
+        QF_pool_[poolId - static_cast<uint_fast8_t>(1)].m_nMin);
+    QF_CRIT_EXIT_();
+
+    return min;
+}
+//............................................................................
+void QF_poolSetHighWater(uint_fast8_t const poolId,
+                         uint_fast16_t const nSlabs)
+{
+    Q_REQUIRE_ID(1260, (static_cast<uint_fast8_t>(1) <= poolId)
+                       && (poolId <= QF_maxPool_));
+
+    QF_pool_[poolId - static_cast<uint_fast8_t>(1)].setHighWater(nSlabs);
+}
+
+#endif // QF_POSIX_ELASTIC_POOL
+
+#ifdef QF_POSIX_NUMA
+
+//****************************************************************************
+// NUMA-aware event pools, see NOTE12 in qf_port.h
+
+static void numaInit(void) {
+    bzero(&l_cpuNode[0], static_cast<uint_fast16_t>(sizeof(l_cpuNode)));
+    l_numaNodes = static_cast<uint_fast8_t>(0);
+
+    // the CPUs of the nodes 0, 1, ... (in the form "0-3,8-11")
+    for (uint_fast8_t node = static_cast<uint_fast8_t>(0);
+         node < static_cast<uint_fast8_t>(QF_NUMA_MAX_NODES);
+         ++node)
+    {
+        char path[64];
+        snprintf(path, sizeof(path),
+                 "/sys/devices/system/node/node%u/cpulist",
+                 static_cast<unsigned>(node));
+        FILE * const f = fopen(path, "r");
+        if (f == static_cast<FILE *>(0)) { // no more nodes?
+            break;
+        }
+        CPU_ZERO(&l_numaCpus[node]);
+        unsigned lo;
+        while (fscanf(f, "%u", &lo) == 1) {
+            unsigned hi = lo;
+            int c = fgetc(f);
+            if ((c == '-') && (fscanf(f, "%u", &hi) == 1)) {
+                c = fgetc(f);
+            }
+            for (unsigned cpu = lo;
+                 (cpu <= hi) && (cpu < static_cast<unsigned>(CPU_SETSIZE));
+                 ++cpu)
+            {
+                CPU_SET(cpu, &l_numaCpus[node]);
+                l_cpuNode[cpu] = static_cast<uint8_t>(node);
+            }
+            if (c != ',') {
+                break;
+            }
+        }
+        (void)fclose(f);
+        ++l_numaNodes;
+    }
+
+    if (l_numaNodes == static_cast<uint_fast8_t>(0)) { // no NUMA support?
+        l_numaNodes = static_cast<uint_fast8_t>(1); // one node of all CPUs
+        CPU_ZERO(&l_numaCpus[0]);
+        for (unsigned cpu = 0U;
+             cpu < static_cast<unsigned>(CPU_SETSIZE);
+             ++cpu)
+        {
+            CPU_SET(cpu, &l_numaCpus[0]);
+        }
+    }
+}
+//............................................................................
+static uint_fast8_t numaAllocNode(void) {
+    // first allocation of a thread without a home node?
+    if (l_allocNode == static_cast<uint8_t>(NUMA_NODE_UNKNOWN)) {
+        int const cpu = sched_getcpu();
+        l_allocNode = ((cpu >= 0) && (cpu < CPU_SETSIZE))
+                      ? l_cpuNode[cpu]
+                      : static_cast<uint8_t>(0);
+    }
+    return static_cast<uint_fast8_t>(l_allocNode);
+}
+//............................................................................
+static void numaBind(void * const sto, uint_fast32_t const size,
+                     uint_fast8_t const node)
+{
+    if (l_numaNodes > static_cast<uint_fast8_t>(1)) {
+        // mbind() applies only to the whole pages inside the storage
+        uintptr_t const page = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+        uintptr_t const lo = (reinterpret_cast<uintptr_t>(sto) + page - 1U)
+                             & ~(page - 1U);
+        uintptr_t const hi = (reinterpret_cast<uintptr_t>(sto) + size)
+                             & ~(page - 1U);
+        if (lo < hi) {
+            unsigned long const mask = (1UL << node);
+
+            // the failure (e.g., no NUMA in the kernel) leaves the default
+            // policy (first touch), so it is not an error
+            (void)syscall(SYS_mbind, lo, hi - lo,
+                          static_cast<int>(NUMA_MPOL_PREFERRED),
+                          &mask, sizeof(mask) * 8U + 1U,
+                          static_cast<unsigned>(NUMA_MPOL_MF_MOVE));
+        }
+    }
+}
+//............................................................................
+QNumaMPool::QNumaMPool(void)
+  : m_nNodes(static_cast<uint_fast8_t>(0))
+{}
+//............................................................................
+void QNumaMPool::init(void * const poolSto, uint_fast32_t poolSize,
+                      uint_fast16_t blockSize)
+{
+    /// @pre the NUMA nodes must be known (QF::init() called before)
+    /// and the poolSize must fit at least one free block
+    Q_REQUIRE_ID(1300, (l_numaNodes != static_cast<uint_fast8_t>(0))
+        && (poolSize >= static_cast<uint_fast32_t>(sizeof(QFreeBlock))));
+
+    m_nNodes = l_numaNodes;
+    for (uint_fast8_t node = static_cast<uint_fast8_t>(0);
+         node < m_nNodes;
+         ++node)
+    {
+        // the provided storage (if any) for the node 0, mmap() otherwise
+        void *sto = poolSto;
+        if ((node != static_cast<uint_fast8_t>(0))
+            || (sto == static_cast<void *>(0)))
+        {
+            sto = mmap(NULL, static_cast<size_t>(poolSize),
+                       PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            Q_ASSERT_ID(1301, sto != MAP_FAILED);
+        }
+
+        // bind the storage before the replica touches it
+        numaBind(sto, poolSize, node);
+        m_node[node].init(sto, poolSize, blockSize);
+        m_lo[node] = static_cast<uint8_t *>(sto);
+        m_hi[node] = static_cast<uint8_t *>(sto) + poolSize;
+    }
+}
+//............................................................................
+uint_fast8_t QNumaMPool::nodeOf(void const * const b) const {
+    uint_fast8_t node = static_cast<uint_fast8_t>(0);
+
+    // the block outside of all replicas fails the checks of QMPool::put()
+    while ((node < (m_nNodes - static_cast<uint_fast8_t>(1)))
+           && !((m_lo[node] <= static_cast<uint8_t const *>(b))
+                && (static_cast<uint8_t const *>(b) < m_hi[node])))
+    {
+        ++node;
+    }
+    return node;
+}
+//............................................................................
+void *QNumaMPool::get(uint_fast16_t const margin) {
+    uint_fast8_t const home = numaAllocNode();
+
+    // the local replica first, then the other ones (if any)
+    void *b = m_node[home].get(margin);
+    for (uint_fast8_t i = static_cast<uint_fast8_t>(1);
+         (b == static_cast<void *>(0)) && (i < m_nNodes);
+         ++i)
+    {
+        uint_fast8_t const node = (home + i) % m_nNodes;
+        b = m_node[node].get(margin);
+    }
+    return b;
+}
+//............................................................................
+void QNumaMPool::put(void * const b) {
+    m_node[nodeOf(b)].put(b);
+}
+//............................................................................
+void *QNumaMPool::getN(uint_fast16_t const n, uint_fast16_t const margin) {
+    uint_fast8_t const home = numaAllocNode();
+
+    // the whole chain from one replica, the local one first
+    void *chain = m_node[home].getN(n, margin);
+    for (uint_fast8_t i = static_cast<uint_fast8_t>(1);
+         (chain == static_cast<void *>(0)) && (i < m_nNodes);
+         ++i)
+    {
+        uint_fast8_t const node = (home + i) % m_nNodes;
+        chain = m_node[node].getN(n, margin);
+    }
+    return chain;
+}
+//............................................................................
+void QNumaMPool::putN(void * const chain, uint_fast16_t const n) {
+    if (m_nNodes == static_cast<uint_fast8_t>(1)) {
+        m_node[0].putN(chain, n);
+    }
+    else {
+        // split the chain by the replicas the blocks come from
+        QFreeBlock *head[QF_NUMA_MAX_NODES];
+        uint_fast16_t cnt[QF_NUMA_MAX_NODES];
+        uint_fast8_t node;
+        for (node = static_cast<uint_fast8_t>(0); node < m_nNodes; ++node) {
+            head[node] = static_cast<QFreeBlock *>(0);
+            cnt[node]  = static_cast<uint_fast16_t>(0);
+        }
+
+        QFreeBlock *fb = static_cast<QFreeBlock *>(chain);
+        for (uint_fast16_t i = static_cast<uint_fast16_t>(0); i < n; ++i) {
+            QFreeBlock * const next = fb->m_next;
+            node = nodeOf(fb);
+            fb->m_next = head[node];
+            head[node] = fb;
+            ++cnt[node];
+            fb = next;
+        }
+
+        for (node = static_cast<uint_fast8_t>(0); node < m_nNodes; ++node) {
+            if (cnt[node] != static_cast<uint_fast16_t>(0)) {
+                m_node[node].putN(head[node], cnt[node]);
+            }
+        }
+    }
+}
+//............................................................................
+uint_fast16_t QF::getPoolMin(uint_fast8_t const poolId) {
+    Q_REQUIRE_ID(1310, (static_cast<uint_fast8_t>(1) <= poolId)
+                       && (poolId <= QF_maxPool_));
+
+    // the sum of the minima of the replicas (which might have occurred
+    // at different times), so it never exceeds the true minimum
+    QNumaMPool &pool = QF_pool_[poolId - static_cast<uint_fast8_t>(1)];
+    uint_fast16_t min = static_cast<uint_fast16_t>(0);
+    for (uint_fast8_t node = static_cast<uint_fast8_t>(0);
+         node < pool.m_nNodes;
+         ++node)
+    {
+        QF_CRIT_STAT_
+        QF_CRIT_OBJ_ENTRY_(&pool.m_node[node].m_crit);
+        min += static_cast<uint_fast16_t>(pool.m_node[node].m_nMin);
+        QF_CRIT_EXIT_();
+    }
+    return min;
+}
+//............................................................................
+uint_fast8_t QF_getNumaNodes(void) {
+    return l_numaNodes;
+}
+//............................................................................
+uint_fast8_t QF_getHomeNode(QActive * const act) {
+    // the node set with NUMA_NODE_ATTR or recorded in QActive::start()
+    return static_cast<uint_fast8_t>(act->getThread().m_node);
+}
+//............................................................................
+uint_fast8_t QF_setAllocNode(uint_fast8_t const node) {
+    /// @pre the node must be one of the NUMA nodes
+    Q_REQUIRE_ID(1320, node < l_numaNodes);
+
+    uint_fast8_t const prev = numaAllocNode();
+    l_allocNode = static_cast<uint8_t>(node);
+    return prev;
+}
+
+#endif // QF_POSIX_NUMA
+
+} // namespace QP
+
+//****************************************************************************
+// NOTE01:
+// In Linux, the scheduler policy closest to real-time is the SCHED_FIFO
+// policy, available only with superuser privileges. QF::run() attempts to set
+// this policy as well as to maximize its priority, so that the ticking
+// occurrs in the most timely manner (as close to an interrupt as possible).
+// However, setting the SCHED_FIFO policy might fail, most probably due to
+// insufficient privileges.
+//
+// NOTE02:
+// On some Linux systems nanosleep() might actually not deliver the finest
+// time granularity. For example, on some Linux implementations, nanosleep()
+// could not block for shorter intervals than 20ms, while the underlying
+// clock tick period was only 10ms. Sometimes, the select() system call can
+// provide a finer granularity.
+//
+// NOTE03:
+// Any blocking system call, such as nanosleep() or select() system call can
+// be interrupted by a signal, such as ^C from the keyboard. In this case this
+// QF port breaks out of the event-loop and returns to main() that exits and
+// terminates all spawned p-threads.
+//
+// NOTE04:
+// According to the man pages (for pthread_attr_setschedpolicy) the only value
+// supported in the Linux p-threads implementation is PTHREAD_SCOPE_SYSTEM,
+// meaning that the threads contend for CPU time with all processes running on
+// the machine. In particular, thread priorities are interpreted relative to
+// the priorities of all other processes on the machine.
+//
+// This is good, because it seems that if we set the priorities high enough,
+// no other process (or thread running within) can gain control over the CPU.
+//
+// However, QF limits the number of priority levels to QF_MAX_ACTIVE.
+// Assuming that a QF application will be real-time, this port reserves the
+// three highest Linux priorities for the ISR-like threads (e.g., the ticker,
+// I/O), and the rest highest-priorities for the active objects.
+//
+// NOTE05:
+// In some (older) Linux kernels, the POSIX nanosleep() system call might
+// deliver only 2*actual-system-tick granularity. To compensate for this,
+// you would need to reduce (by 2) the constant NANOSLEEP_NSEC_PER_SEC.
+//
+// NOTE06:
+// The clock tick uses absolute deadlines on CLOCK_MONOTONIC: the deadline
+// of every tick is the deadline of the previous tick plus the tick period,
+// and the ticker sleeps with clock_nanosleep(TIMER_ABSTIME). The time spent
+// in QF_onClockTick() and any scheduling delays therefore don't accumulate
+// into drift. When the ticker wakes up after the deadline of the next tick
+// already passed (an overrun), the missed ticks are generated immediately
+// one after another (catch-up), but at most QF_TICK_MAX_CATCHUP of them;
+// the rest are dropped and counted in QFTickStats::nSkipped. The lateness
+// of every tick relative to its deadline is collected in QFTickStats,
+// see QF_getTickStats().
+//
+// NOTE07:
+// When the macro QF_POSIX_TICKLESS is defined, the ticker does not wake up
+// at every clock tick. Instead, after every tick it finds the nearest
+// expiration of an armed time event across all tick rates
+// (QF::tickNearest_()) and sleeps until the deadline of that tick, or
+// indefinitely when no time events are armed. The clock ticks in between
+// are still counted on the same drift-free grid of deadlines (NOTE06), and
+// they are applied to the time events at once (QF::tickAdvance_()), so the
+// time events keep their clock-tick semantics. QF_onClockTick() is called
+// only for the ticks at which a time event might expire, so it must call
+// QF_TICK_X() for every tick rate in use and do no other periodic work.
+//
+// QTimeEvt::armX() and QTimeEvt::rearm() call QF_ticklessArm_() (through
+// the QF_TIMEEVT_ARM_() hook) inside their critical section. It first
+// applies the ticks skipped so far to the time events at this tick rate,
+// so that the time event being armed does not count the ticks from before
+// it was armed. The tick planned by the ticker is never applied there,
+// from the moment it is planned until QF_onClockTick() has delivered it
+// (l_ticklessPending), so no tick is applied twice. When the time event
+// expires earlier than the planned tick, it wakes up the ticker to
+// re-plan. The ticker sleeps on a condition variable that uses
+// CLOCK_MONOTONIC.
 //
 
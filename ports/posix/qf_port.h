@@ -39,16 +39,122 @@
 #define qf_port_h
 
 // event queue and thread types
+#ifndef QF_POSIX_MPSC_QUEUE
 #define QF_EQUEUE_TYPE       QEQueue
+#else // lock-free event queues of active objects, see NOTE3
+#define QF_EQUEUE_TYPE       QMPSCQueue
+#ifdef QF_URGENT_LANE
+#error "QF_URGENT_LANE requires the native event queue (not MPSC_QUEUE)"
+#endif
+#if (defined QF_MAX_CONFLATE) && (QF_MAX_CONFLATE > 0)
+#error "QF_MAX_CONFLATE requires the native event queue (not MPSC_QUEUE)"
+#endif
+#if (defined QF_QUEUE_HIST_SIZE) && (QF_QUEUE_HIST_SIZE > 0)
+#error "QF_QUEUE_HIST_SIZE requires the native event queue (not MPSC_QUEUE)"
+#endif
+#endif // QF_POSIX_MPSC_QUEUE
+#ifdef QF_POSIX_FUTEX // futex-based blocking of AO threads, see NOTE4
+#define QF_OS_OBJECT_TYPE    QFParker
+#elif !(defined QF_POSIX_MPSC_QUEUE)
 #define QF_OS_OBJECT_TYPE    pthread_cond_t
-#define QF_THREAD_TYPE       uint8_t
+#endif
+#define QF_THREAD_TYPE       QFThread
 
-// The maximum number of active objects in the application
+#ifdef QF_POSIX_TICKLESS // tickless clock tick, see NOTE07 in qf_port.cpp
+#define QF_TICKLESS
+#endif
+
+#ifdef QF_POSIX_EPOLL // active objects waiting in epoll_wait(), see NOTE6
+#if (defined QF_POSIX_MPSC_QUEUE) || (defined QF_POSIX_FUTEX)
+#error "QF_POSIX_EPOLL cannot be combined with MPSC_QUEUE or FUTEX"
+#endif
+#ifndef QF_EPOLL_MAX_FDS
+// The maximum number of file descriptors per QEpollActive
+#define QF_EPOLL_MAX_FDS     8
+#endif
+#endif // QF_POSIX_EPOLL
+
+#ifdef QF_POSIX_MAGAZINE // per-thread caches of event-pool blocks, see NOTE7
+#ifndef QF_MAGAZINE_SIZE
+// The maximum number of free blocks cached per thread and event pool
+#define QF_MAGAZINE_SIZE     16
+#endif
+#if (QF_MAGAZINE_SIZE < 2) || ((QF_MAGAZINE_SIZE % 2) != 0)
+#error "QF_MAGAZINE_SIZE must be an even number of at least 2"
+#endif
+#endif // QF_POSIX_MAGAZINE
+
+#if (defined QF_POSIX_LOCKFREE_POOL) && !(defined __GNUC__)
+#error "QF_POSIX_LOCKFREE_POOL requires the GCC atomic builtins"
+#endif
+
+#ifdef QF_POSIX_ELASTIC_POOL // event pools growing on demand, see NOTE10
+#ifdef QF_POSIX_LOCKFREE_POOL
+#error "QF_POSIX_ELASTIC_POOL cannot be combined with LOCKFREE_POOL"
+#endif
+#ifndef QF_ELASTIC_SLAB_SIZE
+// The size of one slab of an elastic event pool [bytes] (power of 2)
+#define QF_ELASTIC_SLAB_SIZE (2UL * 1024UL * 1024UL)
+#endif
+#ifndef QF_ELASTIC_MAX_SLABS
+// The maximum number of slabs of an elastic event pool
+#define QF_ELASTIC_MAX_SLABS 64
+#endif
+#ifndef QF_ELASTIC_HIGH_WATER
+// The default number of free slabs kept before releasing a slab
+#define QF_ELASTIC_HIGH_WATER 2
+#endif
+#if ((QF_ELASTIC_SLAB_SIZE & (QF_ELASTIC_SLAB_SIZE - 1UL)) != 0UL)
+#error "QF_ELASTIC_SLAB_SIZE must be a power of 2"
+#endif
+#endif // QF_POSIX_ELASTIC_POOL
+
+#ifdef QF_POSIX_NUMA // NUMA-aware event pools, see NOTE12
+#if (defined QF_POSIX_LOCKFREE_POOL) || (defined QF_POSIX_ELASTIC_POOL)
+#error "QF_POSIX_NUMA cannot be combined with LOCKFREE_POOL or ELASTIC_POOL"
+#endif
+#ifndef QF_NUMA_MAX_NODES
+// The maximum number of NUMA nodes used by the event pools
+#define QF_NUMA_MAX_NODES    4
+#endif
+#if (QF_NUMA_MAX_NODES < 1) || (QF_NUMA_MAX_NODES > 64)
+#error "QF_NUMA_MAX_NODES must be between 1 and 64"
+#endif
+#endif // QF_POSIX_NUMA
+
+#ifndef QF_ACTIVE_BATCH
+// The maximum number of events dispatched per wakeup of an AO, see NOTE14
+#define QF_ACTIVE_BATCH      8
+#endif
+#if (QF_ACTIVE_BATCH < 1)
+#error "QF_ACTIVE_BATCH must be at least 1"
+#endif
+
+// the size of the CPU cache line (to avoid false sharing)
+#define QF_CACHE_LINE_SIZE   64
+
+#ifdef QF_POSIX_POOL_ALIGN // cache-line aligned pool blocks, see NOTE11
+#ifndef QF_MPOOL_ALIGN
+#define QF_MPOOL_ALIGN       QF_CACHE_LINE_SIZE
+#endif
+#endif // QF_POSIX_POOL_ALIGN
+
+#ifndef QF_MAX_ACTIVE
+// The maximum number of active objects in the application (up to 1024)
 #define QF_MAX_ACTIVE        64
+#endif
 
 // The number of system clock tick rates
 #define QF_MAX_TICK_RATE     2
 
+// The maximum number of event pools and the size of the lookup table from
+// the event size to the event pool (events up to 64*sizeof(void*) bytes)
+#define QF_MAX_EPOOL         32
+#define QF_EPOOL_LUT_SIZE    64
+
+// The maximum number of payload buffer pools (zero-copy events)
+#define QF_MAX_BPOOL         8
+
 // various QF object sizes configuration for this port
 #define QF_EVENT_SIZ_SIZE    4
 #define QF_EQUEUE_CTR_SIZE   4
@@ -56,32 +162,324 @@
 #define QF_MPOOL_CTR_SIZE    4
 #define QF_TIMEEVT_CTR_SIZE  4
 
+// QF_LOG2 with the GCC/Clang bit-scan builtin. The argument of
+// __builtin_clzll() is never zero, so QF_LOG2(0) is zero, as required
+#ifdef __GNUC__
+#define QF_LOG2(n_) (static_cast<uint_fast8_t>(63U \
+    - static_cast<uint_fast8_t>(__builtin_clzll( \
+        (static_cast<uint64_t>(n_) << 1) | static_cast<uint64_t>(1)))))
+#endif
+
+// the timestamp of the queue telemetry in [us], see NOTE15
+#define QF_QUEUE_TIME()      (QP::QF_queueTime_())
+
 /* QF interrupt disable/enable, see NOTE1 */
 #define QF_INT_DISABLE()     pthread_mutex_lock(&QP::QF_pThreadMutex_)
 #define QF_INT_ENABLE()      pthread_mutex_unlock(&QP::QF_pThreadMutex_)
 
+#ifndef QF_POSIX_FINE_CRIT
+
 // QF critical section entry/exit for POSIX, see NOTE1
 // QF_CRIT_STAT_TYPE not defined
 #define QF_CRIT_ENTRY(dummy) QF_INT_DISABLE()
 #define QF_CRIT_EXIT(dummy)  QF_INT_ENABLE()
 
+#else // fine-grained locking, see NOTE2
+
+// QF critical section entry/exit for POSIX, the status remembers the mutex
+#define QF_CRIT_STAT_TYPE    pthread_mutex_t *
+#define QF_CRIT_ENTRY(stat_) \
+    ((stat_) = &QP::QF_pThreadMutex_, (void)pthread_mutex_lock((stat_)))
+#define QF_CRIT_EXIT(stat_)  ((void)pthread_mutex_unlock((stat_)))
+
+#ifndef Q_SPY // QS needs the single critical section
+    // individual locks of the event queues, event pools, and time events
+    #define QF_CRIT_OBJ_TYPE pthread_mutex_t
+    #define QF_CRIT_OBJ_INIT(obj_) ((void)pthread_mutex_init((obj_), NULL))
+    #define QF_CRIT_OBJ_ENTRY(stat_, obj_) \
+        ((stat_) = (obj_), (void)pthread_mutex_lock((stat_)))
+#endif // Q_SPY
+
+#endif // QF_POSIX_FINE_CRIT
+
+#if (defined QF_POSIX_FINE_CRIT) || (defined QF_POSIX_MPSC_QUEUE) \
+    || (defined QF_POSIX_ATOMIC_REF_CTR)
+// the event reference counters are updated atomically, see NOTE2 and NOTE9
+#define QF_REF_CTR_ATOMIC
+#define QF_REF_CTR_INC(ctr_) __atomic_add_fetch(&(ctr_), 1U, __ATOMIC_RELAXED)
+#define QF_REF_CTR_DEC(ctr_) __atomic_sub_fetch(&(ctr_), 1U, __ATOMIC_ACQ_REL)
+#endif
+
+#ifdef __GNUC__
+// the allocation statistics are updated atomically, see NOTE13
+#define QF_STAT_ATOMIC
+#define QF_STAT_ADD(ctr_, n_) \
+    __atomic_add_fetch(&(ctr_), (n_), __ATOMIC_RELAXED)
+#define QF_STAT_SUB(ctr_, n_) \
+    __atomic_sub_fetch(&(ctr_), (n_), __ATOMIC_RELAXED)
+#define QF_STAT_MAX(ctr_, v_) (QP::QF_statMax_(&(ctr_), (v_)))
+#endif
+
 #include <pthread.h>   // POSIX-thread API
+#include <stdio.h>     // FILE for the allocation report
+#include <sys/uio.h>   // struct iovec for the payload buffers
 #include "qep_port.h"  // QEP port
 #include "qequeue.h"   // POSIX needs event-queue
 #include "qmpool.h"    // POSIX needs memory-pool
+#ifdef QF_POSIX_MPSC_QUEUE
+#include "qmpscqueue.h" // lock-free event queue for active objects
+#endif
+#ifdef QF_POSIX_LOCKFREE_POOL
+#include "qlfmpool.h"  // lock-free memory pool for the event pools
+#endif
+#ifdef QF_POSIX_ELASTIC_POOL
+#include "qelasticmpool.h" // elastic memory pool for the event pools
+#endif
+#ifdef QF_POSIX_NUMA
+#include "qnumampool.h" // NUMA-aware memory pool for the event pools
+#endif
 #include "qpset.h"     // POSIX needs priority-set
+
+#ifdef QF_POSIX_FUTEX
+namespace QP {
+
+//! Futex-based object for blocking the thread of an active object
+/// @description
+/// The thread of an active object blocks (parks) on this object when its
+/// event queue is empty. The parking can start with a bounded spin phase
+/// (see SPIN_COUNT_ATTR) and makes the futex system calls only when the
+/// thread actually sleeps in the kernel, see NOTE4.
+struct QFParker {
+    //! the state of the thread (RUNNING, PARKED, SLEEPING, WAKING, NOTIFIED)
+    int32_t volatile m_state;
+
+    //! number of spin iterations before sleeping in the kernel
+    uint32_t volatile m_spin;
+
+    QFParker(void); //!< default ctor
+
+    //! announce that the owner thread is going to park (consumer)
+    void prepare(void);
+
+    //! spin, then sleep until notified (consumer, outside critical section)
+    void park(void);
+
+    //! notify the owner thread, returns true if it must be woken up
+    bool notify(void);
+
+    //! wake up the owner thread notified by notify() (producer)
+    void wake(void);
+};
+
+} // namespace QP
+#endif // QF_POSIX_FUTEX
+
+namespace QP {
+
+//! Thread of an active object and its attributes, see NOTE5
+/// @description
+/// The attributes are set with QActive::setAttr() before the active
+/// object is started. The QActive constructor clears this structure,
+/// which means that no attribute is set.
+struct QFThread {
+    //! the thread is running (cleared in QActive::stop())
+    uint8_t volatile m_running;
+
+    //! bitmask of the attributes set with QActive::setAttr()
+    uint8_t m_attrs;
+
+    //! scheduling policy (SCHED_ATTR)
+    int_t m_policy;
+
+    //! scheduling priority (SCHED_ATTR)
+    int_t m_prio;
+
+    //! stack size [bytes] (STACK_SIZE_ATTR)
+    size_t m_stkSize;
+
+#ifdef CPU_SETSIZE
+    //! the CPUs on which the thread can run (CPU_SET_ATTR)
+    cpu_set_t m_cpuSet;
+#endif
+
+    //! the name of the thread, NUL-terminated (THREAD_NAME_ATTR)
+    char m_name[16];
+
+    //! the home NUMA node of the active object (NUMA_NODE_ATTR)
+    uint8_t m_node;
+
+    //! events were posted ahead of the batch being dispatched: bit 0 for
+    //! QActive::postLIFO(), bit 1 for QActive::postUrgent_(), see NOTE14
+    uint8_t m_lifo;
+
+#ifdef QF_POSIX_EPOLL
+    //! signaling of the eventfd (0: not a QEpollActive, 1: idle, 2: pending)
+    uint8_t volatile m_epollSig;
+
+    //! the eventfd signaling the event queue of QEpollActive
+    int_t m_eventFd;
+#endif // QF_POSIX_EPOLL
+};
+
+//! scheduling policy and priority of an active object thread (SCHED_ATTR)
+struct QFSchedAttr {
+    int_t policy; //!< SCHED_FIFO, SCHED_RR, SCHED_OTHER, ...
+    int_t prio;   //!< priority within the policy
+};
+
+} // namespace QP
+
 #include "qf.h"        // QF platform-independent public interface
 
 namespace QP {
 
+// attributes of the active object threads (see QActive::setAttr())
+enum POSIX_ThreadAttrs {
+    SPIN_COUNT_ATTR, // attr2: uint32_t const *, # spins before sleeping
+    CPU_SET_ATTR,    // attr2: cpu_set_t const *, CPU affinity
+    SCHED_ATTR,      // attr2: QFSchedAttr const *, policy and priority
+    STACK_SIZE_ATTR, // attr2: size_t const *, stack size [bytes]
+    THREAD_NAME_ATTR, // attr2: char const *, name (up to 15 characters)
+    NUMA_NODE_ATTR   // attr2: uint8_t const *, home NUMA node, see NOTE12
+};
+
 // set clock tick rate and p-thread priority
 void QF_setTickRate(uint32_t ticksPerSec, int_t tickPrio);
 
 // clock tick callback (provided in the app)
 void QF_onClockTick(void);
 
+// clock tick statistics (see QF_getTickStats()), all times in [ns]
+struct QFTickStats {
+    uint32_t nTicks;     // number of clock ticks generated
+    uint32_t nOverruns;  // ticks late by one tick period or more
+    uint32_t nSkipped;   // ticks dropped beyond QF_TICK_MAX_CATCHUP
+    uint32_t latencyMin; // minimum lateness of a tick vs. its deadline
+    uint32_t latencyMax; // maximum lateness of a tick vs. its deadline
+    uint64_t latencySum; // sum of the lateness (for the average)
+};
+
+// obtain (and optionally reset) the clock tick statistics
+void QF_getTickStats(QFTickStats * const stats, bool const reset);
+
+// monotonic time in [us] modulo 2^32 (QF_QUEUE_TIME())
+uint32_t QF_queueTime_(void);
+
+#ifdef QF_STAT_ATOMIC
+// raise the allocation statistics counter @p ctr to at least @p v
+inline void QF_statMax_(uint32_t * const ctr, uint32_t const v) {
+    uint32_t old = __atomic_load_n(ctr, __ATOMIC_RELAXED);
+    while ((old < v)
+           && !__atomic_compare_exchange_n(ctr, &old, v, true,
+                                           __ATOMIC_RELAXED,
+                                           __ATOMIC_RELAXED))
+    {
+        // old updated by the failed compare-and-swap, try again
+    }
+}
+#endif // QF_STAT_ATOMIC
+
+#if (QF_ALLOC_HIST_SIZE > 0)
+// print the allocation statistics and the recommended event pools
+void QF_allocReport(FILE * const out);
+#endif
+
+#ifdef QF_POSIX_ELASTIC_POOL
+// set the number of free slabs kept by the elastic event pool (poolId 1..)
+void QF_poolSetHighWater(uint_fast8_t const poolId,
+                         uint_fast16_t const nSlabs);
+#endif
+
+#ifdef QF_POSIX_NUMA
+// the number of NUMA nodes used by the event pools (known after QF::init())
+uint_fast8_t QF_getNumaNodes(void);
+
+// the home NUMA node of the active object (the node of the thread that
+// started the active object if it has no NUMA_NODE_ATTR)
+uint_fast8_t QF_getHomeNode(QActive * const act);
+
+// set the NUMA node of the event pools used by the calling thread for the
+// subsequent allocations, returns the previous node
+uint_fast8_t QF_setAllocNode(uint_fast8_t const node);
+#endif // QF_POSIX_NUMA
+
+// fill the scatter-gather vector @p iov with the payloads of @p n buffer
+// events for writev()/sendmsg(), returns the total number of bytes
+inline size_t QF_bufGather(struct iovec * const iov,
+                           QBufEvt const * const evts[],
+                           uint_fast16_t const n)
+{
+    size_t total = static_cast<size_t>(0);
+    for (uint_fast16_t i = static_cast<uint_fast16_t>(0); i < n; ++i) {
+        QBuf * const buf = evts[i]->buf;
+        iov[i].iov_base = buf->data();
+        iov[i].iov_len  = static_cast<size_t>(buf->len);
+        total += iov[i].iov_len;
+    }
+    return total;
+}
+
+#ifdef QF_POSIX_TICKLESS
+// re-plan the tickless clock tick when a time event is armed (internal)
+void QF_ticklessArm_(uint_fast8_t const tickRate, QTimeEvtCtr const nTicks);
+#endif
+
 extern pthread_mutex_t QF_pThreadMutex_; // mutex for QF critical section
 
+#ifdef QF_POSIX_EPOLL
+
+//! Event dispatched to QEpollActive when a file descriptor is ready
+/// @description
+/// The events are owned by QEpollActive (one for every registered file
+/// descriptor) and are dispatched directly, without the event queue.
+/// They are static events, so they are never recycled, but they are
+/// updated with every readiness, see NOTE6.
+struct QFdEvt : public QEvt {
+#ifdef Q_EVT_CTOR
+    QFdEvt(void) : QEvt(static_cast<QSignal>(0), QEvt::STATIC_EVT) {}
+#endif
+    int_t fd;         //!< the file descriptor (negative when not registered)
+    uint32_t revents; //!< the ready events (EPOLLIN, EPOLLOUT, EPOLLHUP, ...)
+};
+
+//! Active object that waits on its event queue and file descriptors
+/// @description
+/// The thread of QEpollActive blocks in epoll_wait() on the eventfd that
+/// signals its event queue and on the registered file descriptors. The
+/// readiness of a file descriptor is dispatched to the state machine as
+/// QFdEvt in the run-to-completion context of the active object, without
+/// any intermediate thread or dynamic event, see NOTE6.
+class QEpollActive : public QActive {
+public:
+    //! register the file descriptor @p fd for the @p events (EPOLLIN, ...)
+    //! to be dispatched as QFdEvt with the signal @p sig
+    void addFd(int_t const fd, uint32_t const events, enum_t const sig);
+
+    //! change the @p events of the registered file descriptor @p fd
+    void modifyFd(int_t const fd, uint32_t const events);
+
+    //! unregister the file descriptor @p fd (before closing it)
+    void removeFd(int_t const fd);
+
+protected:
+    //! protected constructor (abstract class)
+    QEpollActive(QStateHandler const initial);
+
+private:
+    //! the registered file descriptor @p fd
+    QFdEvt *findFd(int_t const fd);
+
+    //! epoll instance of this active object
+    int_t m_epollFd;
+
+    //! the events for the registered file descriptors
+    QFdEvt m_fdEvt[QF_EPOLL_MAX_FDS];
+
+    friend class QF;
+};
+
+#endif // QF_POSIX_EPOLL
+
 } // namespace QP
 
 //****************************************************************************
@@ -94,26 +492,156 @@ extern pthread_mutex_t QF_pThreadMutex_; // mutex for QF critical section
     #define QF_SCHED_LOCK_(dummy) ((void)0)
     #define QF_SCHED_UNLOCK_()    ((void)0)
 
+#ifdef QF_POSIX_TICKLESS
+    // bring the time events up to date before (re)arming, see NOTE07
+    #define QF_TIMEEVT_ARM_(tickRate_, nTicks_) \
+        QF_ticklessArm_((tickRate_), (nTicks_))
+#endif
+
+#ifdef QF_POSIX_MPSC_QUEUE
+    // the operations of the active object event queue (QActive::post_(),
+    // QActive::postN_(), QActive::postLIFO(), QActive::get_(),
+    // QActive::getBatch_(), QF::getQueueMin() and QTicker)
+    // are implemented in qf_port.cpp
+    #define QACTIVE_EQUEUE_PORT_
+#endif
+
+    // the LIFO event must precede the rest of the batch, see NOTE14
+    #define QACTIVE_EQUEUE_LIFO_(me_) \
+        ((void)__atomic_fetch_or(&(me_)->m_thread.m_lifo, \
+                                 static_cast<uint8_t>(1), __ATOMIC_RELAXED))
+
+    // the urgent event must precede the rest of the batch, see NOTE14
+    #define QACTIVE_EQUEUE_URGENT_(me_) \
+        ((void)__atomic_fetch_or(&(me_)->m_thread.m_lifo, \
+                                 static_cast<uint8_t>(2), __ATOMIC_RELAXED))
+
     // native event queue operations...
+#if (defined QF_POSIX_FUTEX)
+    // park outside of the critical section, see NOTE4
+    #define QACTIVE_EQUEUE_WAIT_(me_) \
+        while ((me_)->m_eQueue.m_frontEvt == static_cast<QEvt const *>(0)) { \
+            (me_)->m_osObject.prepare(); \
+            QF_CRIT_EXIT_(); \
+            (me_)->m_osObject.park(); \
+            QF_CRIT_OBJ_ENTRY_(&(me_)->m_eQueue.m_crit); \
+        }
+#elif (defined QF_POSIX_FINE_CRIT)
+    // wait on the mutex of the critical section currently held (critStat_)
+    #define QACTIVE_EQUEUE_WAIT_(me_) \
+        while ((me_)->m_eQueue.m_frontEvt == static_cast<QEvt const *>(0)) \
+            pthread_cond_wait(&(me_)->m_osObject, critStat_)
+#else
     #define QACTIVE_EQUEUE_WAIT_(me_) \
         while ((me_)->m_eQueue.m_frontEvt == static_cast<QEvt const *>(0)) \
             pthread_cond_wait(&(me_)->m_osObject, &QF_pThreadMutex_)
+#endif
+
+#ifdef QF_POSIX_FUTEX
+    #define QACTIVE_EQUEUE_SIGNAL_(me_) \
+        Q_ASSERT_ID(410, QF::active_[(me_)->m_prio] \
+                         != static_cast<QActive *>(0)); \
+        (void)(me_)->m_osObject.notify()
+
+    // the system call (if any) is made after the critical section
+    #define QACTIVE_EQUEUE_WAKE_(me_) ((me_)->m_osObject.wake())
+#elif (defined QF_POSIX_EPOLL)
+    // the eventfd of QEpollActive is written after the critical section
+    #define QACTIVE_EQUEUE_SIGNAL_(me_) \
+        Q_ASSERT_ID(410, QF::active_[(me_)->m_prio] \
+                         != static_cast<QActive *>(0)); \
+        if ((me_)->m_thread.m_epollSig != static_cast<uint8_t>(0)) { \
+            (me_)->m_thread.m_epollSig = static_cast<uint8_t>(2); \
+        } \
+        else { \
+            pthread_cond_signal(&(me_)->m_osObject); \
+        }
 
+    #define QACTIVE_EQUEUE_WAKE_(me_) \
+        if (__atomic_load_n(&(me_)->m_thread.m_epollSig, __ATOMIC_RELAXED) \
+            == static_cast<uint8_t>(2)) \
+        { \
+            QF_epollWake_(&(me_)->m_thread); \
+        }
+
+    namespace QP {
+        // write the eventfd of QEpollActive (outside critical section)
+        void QF_epollWake_(QFThread * const thr);
+    } // namespace QP
+#else
     #define QACTIVE_EQUEUE_SIGNAL_(me_) \
         Q_ASSERT_ID(410, QF::active_[(me_)->m_prio] \
                          != static_cast<QActive *>(0)); \
         pthread_cond_signal(&(me_)->m_osObject) \
 
+#endif // QF_POSIX_FUTEX
+
     // event pool operations...
+#if (defined QF_POSIX_LOCKFREE_POOL) // lock-free event pools, see NOTE8
+    #define QF_EPOOL_TYPE_  QLFMPool
+
+    // QF::getPoolMin() is implemented in qf_port.cpp
+    #define QF_EPOOL_PORT_
+#elif (defined QF_POSIX_ELASTIC_POOL) // elastic event pools, see NOTE10
+    #define QF_EPOOL_TYPE_  QElasticMPool
+
+    // QF::getPoolMin() is implemented in qf_port.cpp
+    #define QF_EPOOL_PORT_
+#elif (defined QF_POSIX_NUMA) // NUMA-aware event pools, see NOTE12
+    #define QF_EPOOL_TYPE_  QNumaMPool
+
+    // QF::getPoolMin() is implemented in qf_port.cpp
+    #define QF_EPOOL_PORT_
+#else
     #define QF_EPOOL_TYPE_  QMPool
+#endif
 
+#ifndef QF_POSIX_MAGAZINE
     #define QF_EPOOL_INIT_(p_, poolSto_, poolSize_, evtSize_) \
         (p_).init((poolSto_), (poolSize_), (evtSize_))
+#else
+    #define QF_EPOOL_INIT_(p_, poolSto_, poolSize_, evtSize_) do { \
+        (p_).init((poolSto_), (poolSize_), (evtSize_)); \
+        QF_magInit_(&(p_), (poolSize_)); \
+    } while (false)
+#endif
 
     #define QF_EPOOL_EVENT_SIZE_(p_)  ((p_).getBlockSize())
+#ifndef QF_POSIX_MAGAZINE
     #define QF_EPOOL_GET_(p_, e_, m_) \
         ((e_) = static_cast<QEvt *>((p_).get((m_))))
     #define QF_EPOOL_PUT_(p_, e_)     ((p_).put(e_))
+#else
+    // allocations with a margin bypass the magazines, see NOTE7
+    #define QF_EPOOL_GET_(p_, e_, m_) \
+        ((e_) = static_cast<QEvt *>(((m_) == static_cast<uint_fast16_t>(0)) \
+                                    ? QF_magGet_(&(p_)) \
+                                    : (p_).get((m_))))
+    #define QF_EPOOL_PUT_(p_, e_)     (QF_magPut_(&(p_), (e_)))
+
+    // the payload buffer pools are not cached in the magazines
+    #define QF_BPOOL_INIT_(p_, poolSto_, poolSize_, bufSize_) \
+        (p_).init((poolSto_), (poolSize_), (bufSize_))
+    #define QF_BPOOL_GET_(p_, b_, m_) ((b_) = (p_).get((m_)))
+    #define QF_BPOOL_PUT_(p_, b_)     ((p_).put(b_))
+
+    namespace QP {
+        // size the magazines for the initialized event pool
+        void QF_magInit_(QF_EPOOL_TYPE_ * const pool,
+                         uint_fast32_t const poolSize);
+
+        // get a block from the magazine of the calling thread
+        void *QF_magGet_(QF_EPOOL_TYPE_ * const pool);
+
+        // put a block to the magazine of the calling thread
+        void QF_magPut_(QF_EPOOL_TYPE_ * const pool, void * const b);
+    } // namespace QP
+#endif // QF_POSIX_MAGAZINE
+
+    // batches of blocks bypass the magazines (if used)
+    #define QF_EPOOL_GET_N_(p_, chain_, n_, m_) \
+        ((chain_) = (p_).getN((n_), (m_)))
+    #define QF_EPOOL_PUT_N_(p_, chain_, n_) ((p_).putN((chain_), (n_)))
 
 #endif // QP_IMPL
 
@@ -146,5 +674,286 @@ extern pthread_mutex_t QF_pThreadMutex_; // mutex for QF critical section
 // implementation, such as Linux p-threads, should support the priority-
 // inheritance protocol.
 //
+// NOTE2:
+// When the macro QF_POSIX_FINE_CRIT is defined (e.g., on the command line),
+// the single mutex QF_pThreadMutex_ protects only the publish-subscribe
+// lists and the registry of active objects (the event reference counters
+// are atomic, see NOTE9). Every event queue (QEQueue), every event
+// pool (QMPool) and the time event list of every tick rate carries its own
+// mutex (QF_CRIT_OBJ_TYPE), so that posting events to different active
+// objects, allocating events from different pools, and ticking the time
+// events proceed in parallel. The critical sections are never nested, so
+// the additional mutexes cannot deadlock. Because the same event can be
+// posted to different queues at the same time, the event reference counters
+// are incremented and decremented with atomic operations (GCC builtins).
+//
+// The QS software tracing writes into a single trace buffer from inside the
+// critical sections. Therefore, when Q_SPY is defined, all critical sections
+// fall back to the single mutex QF_pThreadMutex_.
+//
+// NOTE3:
+// When the macro QF_POSIX_MPSC_QUEUE is defined, the event queues of active
+// objects are the lock-free multiple-producer/single-consumer queues
+// QMPSCQueue (see qmpscqueue.h). A producer first reserves a free slot by
+// an atomic compare-and-swap on the number of free slots, which keeps the
+// margin/QF_NO_MARGIN semantics and the low-watermark statistics. Next, the
+// producer claims the index of the slot by another compare-and-swap and
+// stores the event pointer into the slot. The consumer takes the events in
+// the order of the slots, clears each slot, and only then releases the slot
+// by incrementing the number of free slots.
+//
+// The consumer blocks only when the next slot is empty. It sets the flag
+// m_waiting and re-checks the slot, while every producer checks the flag
+// after storing the event (both with sequentially-consistent atomics), so
+// a wake-up cannot be lost. The mutex and condition variable of the queue
+// are used only when the consumer actually blocks.
+//
+// The LIFO end of this queue belongs to the consumer, so QActive::postLIFO()
+// can be used only for self-posting (e.g., QActive::recall()). The "raw"
+// QEQueue queues (e.g., for event deferral) are not affected by this option.
+// As in NOTE2, the event reference counters are updated atomically.
+//
+// NOTE4:
+// When the macro QF_POSIX_FUTEX is defined (Linux only), the thread of each
+// active object blocks on a futex (QFParker) instead of a condition variable
+// associated with the QF mutex. The thread announces that it is going to
+// park (state PARKED) while still inside the critical section, leaves the
+// critical section, optionally spins for the number of iterations set with
+// QActive::setAttr(SPIN_COUNT_ATTR, &n), and only then goes to sleep in
+// the kernel (state SLEEPING). A producer that finds the thread PARKED just
+// marks it NOTIFIED, without any system call. Only a thread that is actually
+// SLEEPING is marked WAKING inside the critical section and woken up with
+// FUTEX_WAKE *after* the producer leaves the critical section, so the woken
+// thread never has to block on the mutex held by the producer.
+//
+// NOTE5:
+// By default, the thread of an active object is created with the SCHED_FIFO
+// policy and the priority derived from the QF priority (see NOTE04 in
+// qf_port.cpp), the default stack size, and no CPU affinity. The attributes
+// set with QActive::setAttr() before QActive::start() override this, e.g.:
+//
+//     cpu_set_t cpus;
+//     CPU_ZERO(&cpus);
+//     CPU_SET(3, &cpus);  // pin to the isolated core #3
+//     AO_Table->setAttr(CPU_SET_ATTR, &cpus);
+//     QFSchedAttr const sched = { SCHED_RR, 10 };
+//     AO_Table->setAttr(SCHED_ATTR, &sched);
+//     AO_Table->setAttr(THREAD_NAME_ATTR, "table");
+//     AO_Table->start(...);
+//
+// The CPU affinity is available only where cpu_set_t is (glibc/Linux).
+//
+// NOTE6:
+// When the macro QF_POSIX_EPOLL is defined (Linux only), the active objects
+// derived from QEpollActive wait in epoll_wait() on an eventfd and on the
+// file descriptors registered with QEpollActive::addFd(). A producer that
+// posts to the empty queue of such an active object only marks the eventfd
+// pending inside the critical section, and writes it after leaving the
+// critical section. The thread dispatches the events from its queue, but
+// at most the capacity of the queue at a time, and then polls the file
+// descriptors (without blocking as long as the queue is not empty), so
+// neither of them can starve the other. Every ready file descriptor is
+// dispatched as its own QFdEvt, e.g.:
+//
+//     case SOCK_READY_SIG: {
+//         QFdEvt const *fe = static_cast<QFdEvt const *>(e);
+//         if ((fe->revents & EPOLLIN) != 0U) {
+//             n = read(fe->fd, buf, sizeof(buf));
+//             ...
+//
+// The QFdEvt is valid only during the RTC step and must not be deferred.
+// The file descriptors can be added and removed only before the active
+// object is started or from its own RTC steps. Other active objects keep
+// blocking on their condition variables.
+//
+// NOTE7:
+// When the macro QF_POSIX_MAGAZINE is defined, every thread (the thread of
+// each active object, the ticker, or any other thread allocating events)
+// keeps a magazine of up to QF_MAGAZINE_SIZE free blocks for every event
+// pool in the thread-local storage. Q_NEW() takes a block from the magazine
+// and QF::gc() puts it back there, without any lock or shared cache line.
+// Only an empty magazine is refilled with a batch of blocks from the event
+// pool (QMPool::getN()) and only a full magazine (two batches) spills one
+// batch back (QMPool::putN()), each in one critical section. The magazine
+// of a thread is returned to the event pools when the thread exits.
+//
+// The blocks cached in the magazines of one thread are not available to
+// the other threads. Therefore, the batch is QF_MAGAZINE_SIZE/2 blocks, but
+// at most 1/16 of the event pool (the pools of less than 16 blocks are not
+// cached at all), and a refill leaves at least one batch in the event pool.
+// The event pools must still be sized for up to two batches per thread.
+//
+// The event pools see the blocks held in the magazines as allocated, so
+// QF::getPoolMin() and the QS_QF_MPOOL_GET/PUT trace records (produced per
+// refill and spill) remain exact for the shared pools, and conservative
+// by at most two batches per thread for the whole system. For the same
+// reason, the allocations with a margin (Q_NEW_X()) bypass the magazines
+// and keep the exact margin semantics. When a refill is not possible, the
+// magazine falls back to single blocks from the event pool.
+//
+// NOTE8:
+// When the macro QF_POSIX_LOCKFREE_POOL is defined, the event pools are
+// QLFMPool objects (see qlfmpool.h) instead of QMPool. The free blocks form
+// a lock-free stack, whose top is a 64-bit word with the block number and
+// an ABA tag, updated with a single 64-bit compare-and-swap (no double-width
+// CAS is needed). Q_NEW() first reserves a block by decrementing the number
+// of free blocks above the margin and only then pops a block, while
+// QF::gc() first pushes the block and only then increments the number of
+// free blocks. Therefore, a reserved block is always on the stack, the
+// margin of Q_NEW_X() and the low watermark of QF::getPoolMin() keep their
+// exact meaning, and no thread waits for another one inside an event pool.
+//
+// The lock-free pools can be combined with all other options of this port.
+// Together with QF_POSIX_MAGAZINE, a refill of the magazine pops a batch of
+// blocks one by one, while a spill pushes the whole batch at once.
+//
+// NOTE9:
+// When the macro QF_POSIX_ATOMIC_REF_CTR is defined (implied by
+// QF_POSIX_FINE_CRIT and QF_POSIX_MPSC_QUEUE), the event reference counters
+// are updated with the atomic fetch-add and fetch-sub and the port defines
+// QF_REF_CTR_ATOMIC. The decrement is acquire-release, so everything done
+// with the event happens before it is recycled, while the increment can be
+// relaxed, because only a holder of a reference can add another one.
+// QF::gc(), QF::newRef_() and QActive::recall() (as well as QF::bufRef()
+// and QF::bufRelease() for the payload buffers) then drop or add the
+// reference without entering any critical section, so a delivered event
+// costs no lock for its bookkeeping.
+// The thread that drops the last reference recycles the event.
+//
+// The reference counter is one byte by default (two bytes when
+// QF_MAX_ACTIVE is above 252, see qep.h). When an event can have
+// more than 255 references at the same time (e.g., publishing to many
+// subscribers, deferred copies, or long-lived Q_NEW_REF() references),
+// define QF_REF_CTR_SIZE as 2 or 4 for all QP/C++ and application sources.
+//
+// NOTE10:
+// When the macro QF_POSIX_ELASTIC_POOL is defined, the event pools are
+// QElasticMPool objects (see qelasticmpool.h). QF::poolInit() reserves
+// QF_ELASTIC_MAX_SLABS * QF_ELASTIC_SLAB_SIZE bytes of the virtual address
+// space for every pool (mmap() with PROT_NONE, which costs no memory) in
+// addition to the storage provided by the application (which can be NULL).
+// When the free blocks run out (or would fall below the margin of
+// Q_NEW_X()), the pool commits the next slab of the reserved range and
+// links its blocks into the free list. Therefore, Q_NEW() fails only when
+// the whole reserved range is committed. The slabs are aligned to their
+// size and advised as transparent huge pages (MADV_HUGEPAGE). With the
+// macro QF_ELASTIC_HUGETLB, the slabs are first mapped from the explicit
+// huge pages (MAP_HUGETLB), if the system has any available.
+//
+// When a block is returned and the top slab becomes entirely free while
+// the pool keeps more than the high-water number of free slabs
+// (QF_ELASTIC_HIGH_WATER by default, QF_poolSetHighWater() at run time),
+// the slab is returned to the OS. Every slab has its own free list and
+// a count of its free blocks, so the free blocks of the top slab are
+// dropped in O(1), without walking any free list in the critical section.
+// QElasticMPool::get() takes the blocks from the provided storage first
+// and then from the lowest slab with any free blocks (found in a bitmask),
+// so that the top slabs drain. Only the top slab can be released, so that
+// the committed slabs stay contiguous. The mmap() calls are made outside
+// of the critical section, serialized by a mutex of the pool.
+//
+// NOTE11:
+// By default, the blocks of the event pools are only pointer-aligned, so
+// two small events can share one cache line. When such events are used by
+// active objects running on different CPU cores, every write to one event
+// invalidates the cache line of the other (false sharing). When the macro
+// QF_POSIX_POOL_ALIGN is defined, QF_MPOOL_ALIGN is QF_CACHE_LINE_SIZE, so
+// every block of every pool (QMPool, QLFMPool and QElasticMPool alike)
+// starts on a cache line and occupies a whole number of cache lines.
+// The price is the memory: an event of 24 bytes takes 64 bytes. Also, the
+// event pools must differ in the rounded-up block sizes, e.g., pools for
+// the events of 24 and 40 bytes would both have blocks of 64 bytes.
+//
+// The storage of the pools should be aligned as well. QF_MPOOL_EL() rounds
+// up the element to QF_MPOOL_ALIGN and aligns it with QF_MPOOL_ALIGN_ATTR,
+// so the pool gets exactly one block per element. Any other storage should
+// have __attribute__((aligned(QF_CACHE_LINE_SIZE))). Otherwise, the pools
+// skip the unaligned head of the storage.
+//
+// NOTE12:
+// On a host with several NUMA nodes (e.g., a two-socket server), an event
+// allocated from memory of a remote node costs the producer and the
+// consumer the slower remote accesses. When the macro QF_POSIX_NUMA is
+// defined, the event pools (and the payload buffer pools) are QNumaMPool
+// objects (see qnumampool.h) with one replica of every pool per NUMA node.
+// QF::init() finds the nodes and their CPUs in /sys/devices/system/node
+// (a host without NUMA has one node). QF::poolInit() binds the storage of
+// every replica to its node with mbind() (MPOL_PREFERRED, so the pages fall
+// back to other nodes when the node runs out of memory). The storage of
+// the node 0 is the one provided to QF::poolInit(), the other nodes get
+// the storage of the same size from mmap().
+//
+// QF::newX_() (Q_NEW() and friends) takes the block from the replica of
+// the allocation node of the calling thread, and from the other replicas
+// only when the local one is exhausted. An active object declares its home
+// node with QActive::setAttr(NUMA_NODE_ATTR, &node) before it is started.
+// Its thread then allocates from the home node and, unless CPU_SET_ATTR
+// is set too, runs only on the CPUs of that node. An active object without
+// NUMA_NODE_ATTR gets the node of the thread calling QActive::start() as
+// its home node, recorded once, so QF_getHomeNode() returns the same node
+// to every caller and the thread of the active object allocates from it.
+// Other threads allocate from the node of the CPU they run on when they
+// allocate for the first time. To allocate events local to the consumer
+// rather than the producer, a thread can switch its allocation node
+// temporarily:
+//
+//     uint8_t prev = QF_setAllocNode(QF_getHomeNode(AO_Consumer));
+//     MyEvt *e = Q_NEW(MyEvt, MY_SIG);
+//     QF_setAllocNode(prev);
+//
+// A recycled event always returns to the replica it comes from, no matter
+// which thread recycles it.
+//
+// NOTE13:
+// When QF_ALLOC_HIST_SIZE is defined (e.g., -DQF_ALLOC_HIST_SIZE=32 and
+// optionally -DQF_ALLOC_STAT_SIGS=64 for the per-signal statistics), QF
+// records the allocation-size histograms and the peak numbers of the
+// dynamic events (QF::getAllocStats(), QF::getSigAllocStats()). This port
+// defines QF_STAT_ATOMIC, so the counters are updated with relaxed atomic
+// operations outside of any critical section and the statistics can stay
+// enabled in production. QF_allocReport() prints the statistics of every
+// event pool (including the bytes wasted by rounding the events up to the
+// block size) and of every signal, followed by the event pools recommended
+// by QF::advisePools() for the observed peaks, e.g., at QF::onCleanup().
+//
+// NOTE14:
+// The thread of an active object (QF::thread_()) removes up to
+// QF_ACTIVE_BATCH events from its queue with QActive::getBatch_() in one
+// critical section and then dispatches them one by one, so a burst of
+// events costs one wakeup and one lock acquisition instead of one per event.
+// The thread of a QEpollActive drains its queue the same way (at most the
+// queue capacity) before it polls the file descriptors.
+// The producers can post bursts the same way with POST_N() and POST_N_X()
+// (QActive::postN_()), which signal the queue at most once.
+//
+// The events of a batch are already out of the queue, so an event
+// self-posted with QActive::postLIFO() (e.g., QActive::recall()) while the
+// batch is dispatched would land behind them. QActive::postLIFO() therefore
+// sets QFThread::m_lifo (QACTIVE_EQUEUE_LIFO_()) and the thread dispatches
+// the LIFO event(s) before the rest of the batch, which preserves the
+// original order of events. Likewise, QActive::postUrgent_() (from any
+// thread) sets another bit of QFThread::m_lifo (QACTIVE_EQUEUE_URGENT_())
+// and the thread dispatches the urgent events waiting at the front of the
+// queue (QActive::getUrgent_()) before the rest of the batch, so an urgent
+// event never waits for a whole batch. An urgent event is never batched
+// with the regular events (QActive::getBatch_()), which keeps the urgent
+// events in their FIFO order. Defining QF_ACTIVE_BATCH as 1 restores the
+// dispatching of one event per wakeup.
+//
+// NOTE15:
+// When QF_QUEUE_HIST_SIZE is defined (e.g., -DQF_QUEUE_HIST_SIZE=32), the
+// event queues of the active objects count the queue depth at every enqueue
+// in log2 classes. An active object given the timestamp storage with
+// QActive::initQueueStats() also stamps every posted event with
+// QF_QUEUE_TIME() and counts the time the event waited in the queue before
+// its dispatching, again in log2 classes. The timestamps are the
+// CLOCK_MONOTONIC time in microseconds modulo 2^32, so residence times up
+// to about 71 minutes are measured correctly (the nanoseconds would wrap
+// after 4.29 seconds already). The telemetry is read with
+// QF::getQueueStats(), which also produces the QS_QUEUE_STATS trace record.
+// The clock is read outside of the critical section when the event is
+// posted, but inside it when the event is removed (one clock_gettime() call
+// per event, served by the vDSO).
+//
 
 #endif // qf_port_h
@@ -0,0 +1,144 @@
+/// @file
+/// @brief Lock-free memory pool for the QF/C++ port to POSIX/P-threads
+/// @cond
+///***************************************************************************
+/// Last updated for version 6.3.4
+/// Last updated on  2018-09-04
+///
+///                    Q u a n t u m     L e a P s
+///                    ---------------------------
+///                    innovating embedded systems
+///
+/// Copyright (C) Quantum Leaps, LLC. All rights reserved.
+///
+/// This program is open source software: you can redistribute it and/or
+/// modify it under the terms of the GNU General Public License as published
+/// by the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Alternatively, this program may be distributed and modified under the
+/// terms of Quantum Leaps commercial licenses, which expressly supersede
+/// the GNU General Public License and are specifically designed for
+/// licensees interested in retaining the proprietary status of their code.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program. If not, see <http://www.gnu.org/licenses/>.
+///
+/// Contact information:
+/// https://www.state-machine.com
+/// mailto:info@state-machine.com
+///***************************************************************************
+/// @endcond
+
+#ifndef qlfmpool_h
+#define qlfmpool_h
+
+namespace QP {
+
+struct QFreeBlock; // free block of a memory pool, see qf_pkg.h
+
+//****************************************************************************
+//! Lock-free fixed block-size memory pool
+/// @description
+/// This memory pool is used as the #QF_EPOOL_TYPE_ of the event pools in
+/// the POSIX port when the macro QF_POSIX_LOCKFREE_POOL is defined. It has
+/// the same interface and semantics as QP::QMPool (including the margin,
+/// the chains of QP::QMPool::getN()/QP::QMPool::putN() and the low
+/// watermark for QP::QF::getPoolMin()), but none of its operations enters
+/// a critical section, see NOTE8 in qf_port.h.@n
+/// @n
+/// The free blocks form a stack (Treiber stack) linked through their first
+/// pointer-size word (QP::QFreeBlock). The top of the stack is a single
+/// 64-bit word, which holds the number of the top block in the low half and
+/// a modification tag in the high half. Every push and pop increments the
+/// tag, so a compare-and-swap based on a stale top fails even when the same
+/// block is on the top again (ABA problem).
+///
+/// @note
+/// The pool storage is never released, so reading the link of a block
+/// just taken by another thread is harmless: such a read is always followed
+/// by a failing compare-and-swap.
+///
+class QLFMPool {
+private:
+    //! top of the stack of free blocks: the block number (1-based, 0 when
+    //! the stack is empty) in the low half and the ABA tag in the high half
+    uint64_t volatile m_top __attribute__((aligned(QF_CACHE_LINE_SIZE)));
+
+    //! number of free blocks remaining
+    /// @note reserved atomically before popping and released after pushing
+    QMPoolCtr volatile m_nFree __attribute__((aligned(QF_CACHE_LINE_SIZE)));
+
+    //! minimum number of free blocks ever present in this pool
+    /// @sa QP::QF::getPoolMin().
+    QMPoolCtr volatile m_nMin;
+
+    //! start of the memory managed by this memory pool
+    void *m_start __attribute__((aligned(QF_CACHE_LINE_SIZE)));
+
+    //! end of the memory managed by this memory pool
+    void *m_end;
+
+    //! maximum block size (in bytes)
+    QMPoolSize m_blockSize;
+
+    //! total number of blocks
+    QMPoolCtr m_nTot;
+
+public:
+    QLFMPool(void); //!< public default constructor
+
+    //! Initializes the lock-free event pool
+    void init(void * const poolSto, uint_fast32_t poolSize,
+              uint_fast16_t blockSize);
+
+    //! Obtains a memory block from the pool (lock-free)
+    void *get(uint_fast16_t const margin);
+
+    //! Returns a memory block back to the pool (lock-free)
+    void put(void * const b);
+
+    //! Obtains a chain of @p n memory blocks (all or none)
+    void *getN(uint_fast16_t const n, uint_fast16_t const margin);
+
+    //! Returns a chain of @p n memory blocks with one compare-and-swap
+    void putN(void * const chain, uint_fast16_t const n);
+
+    //! return the fixed block-size of the blocks managed by this pool
+    QMPoolSize getBlockSize(void) const {
+        return m_blockSize;
+    }
+
+private:
+    //! reserve @p n free blocks above the @p margin, returns false if none
+    bool reserve(uint_fast16_t const n, uint_fast16_t const margin);
+
+    //! pop one block from the stack (a block must have been reserved)
+    QFreeBlock *pop(void);
+
+    //! push the chain @p head ... @p tail on the stack
+    void push(QFreeBlock * const head, QFreeBlock * const tail);
+
+    //! the top word for the block @p b and the tag following @p top
+    uint64_t topOf(QFreeBlock const * const b, uint64_t const top) const;
+
+    //! the block from the top word @p top (NULL for the empty stack)
+    QFreeBlock *blockOf(uint64_t const top) const;
+
+    //! disallow copying of QLFMPool
+    QLFMPool(QLFMPool const &);
+
+    //! disallow assignment of QLFMPool
+    QLFMPool & operator=(QLFMPool const &);
+
+    friend class QF;
+};
+
+} // namespace QP
+
+#endif // qlfmpool_h
@@ -0,0 +1,152 @@
+/// @file
+/// @brief Lock-free multiple-producer/single-consumer event queue for
+/// the QF/C++ port to POSIX/P-threads
+/// @cond
+///***************************************************************************
+/// Last updated for version 6.3.4
+/// Last updated on  2018-09-04
+///
+///                    Q u a n t u m     L e a P s
+///                    ---------------------------
+///                    innovating embedded systems
+///
+/// Copyright (C) Quantum Leaps, LLC. All rights reserved.
+///
+/// This program is open source software: you can redistribute it and/or
+/// modify it under the terms of the GNU General Public License as published
+/// by the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Alternatively, this program may be distributed and modified under the
+/// terms of Quantum Leaps commercial licenses, which expressly supersede
+/// the GNU General Public License and are specifically designed for
+/// licensees interested in retaining the proprietary status of their code.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program. If not, see <http://www.gnu.org/licenses/>.
+///
+/// Contact information:
+/// https://www.state-machine.com
+/// mailto:info@state-machine.com
+///***************************************************************************
+/// @endcond
+
+#ifndef qmpscqueue_h
+#define qmpscqueue_h
+
+namespace QP {
+
+//****************************************************************************
+//! Lock-free multiple-producer/single-consumer (MPSC) event queue
+/// @description
+/// This event queue is used as the #QF_EQUEUE_TYPE of active objects in the
+/// POSIX port when the macro QF_POSIX_MPSC_QUEUE is defined. Any number of
+/// threads can post events concurrently, and only the thread of the owning
+/// active object takes the events out. None of these operations enters
+/// a critical section, so the producers never block one another or the
+/// consumer (see NOTE3 in qf_port.h).@n
+/// @n
+/// Like QP::QEQueue, the queue stores only event pointers and the storage
+/// of the ring buffer (@c qLen entries) is provided externally. One extra
+/// slot inside the queue object gives the same total capacity of @c qLen+1
+/// events as QP::QEQueue, so the margin and the QP::QF::getQueueMin()
+/// statistics mean the same thing with both queue types.@n
+/// @n
+/// The operations on this queue are implemented in the POSIX port
+/// (QP::QActive::post_(), QP::QActive::postLIFO(), QP::QActive::get_())
+/// with the GCC atomic builtins. When the macro QF_POSIX_FUTEX is also
+/// defined, the blocked consumer is parked on the QP::QFParker of its
+/// active object instead of the mutex and condition variable of the queue.
+///
+/// @note
+/// QP::QActive::postLIFO() can be used only by the owning active object
+/// (self-posting, such as QP::QActive::recall()), because the LIFO end of
+/// the queue belongs to the consumer.
+///
+class QMPSCQueue {
+private:
+    //! pointer to the start of the ring buffer (externally provided storage)
+    QEvt const * volatile *m_ring;
+
+    //! index of the extra slot (the ring buffer has m_end+1 slots)
+    QEQueueCtr m_end;
+
+#ifndef QF_POSIX_FUTEX
+    //! non-zero while the consumer is blocked (or about to block)
+    uint8_t volatile m_waiting;
+
+    //! mutex for blocking the consumer (not used by the queue operations)
+    pthread_mutex_t m_mutex;
+
+    //! condition variable for blocking the consumer
+    pthread_cond_t m_cond;
+#endif // QF_POSIX_FUTEX
+
+    //! index of the slot where the next event will be inserted
+    /// @note updated atomically by the producers
+    QEQueueCtr volatile m_tail __attribute__((aligned(QF_CACHE_LINE_SIZE)));
+
+    //! number of free slots in the queue
+    /// @note reserved atomically by the producers, released by the consumer
+    QEQueueCtr volatile m_nFree
+        __attribute__((aligned(QF_CACHE_LINE_SIZE)));
+
+    //! minimum number of free slots ever in the queue
+    /// @sa QP::QF::getQueueMin().
+    QEQueueCtr volatile m_nMin;
+
+    //! index of the slot where the next event will be extracted
+    /// @note accessed only by the consumer
+    QEQueueCtr m_head __attribute__((aligned(QF_CACHE_LINE_SIZE)));
+
+    //! the extra slot of the ring buffer
+    QEvt const * volatile m_extra;
+
+    //! pending clock ticks (used only by QP::QTicker)
+    QEQueueCtr volatile m_nTicks;
+
+    //! tick rate (used only by QP::QTicker)
+    uint8_t m_tickRate;
+
+public:
+    //! public default constructor
+    QMPSCQueue(void);
+
+    //! Initializes the MPSC event queue
+    void init(QEvt const *qSto[], uint_fast16_t const qLen);
+
+    //! obtain the number of free entries still available in the queue
+    QEQueueCtr getNFree(void) const {
+        return m_nFree;
+    }
+
+    //! obtain the minimum number of free entries ever in the queue
+    QEQueueCtr getNMin(void) const {
+        return m_nMin;
+    }
+
+private:
+    //! the ring-buffer slot at the given index @p i
+    QEvt const * volatile *slot(QEQueueCtr const i) {
+        return (i < m_end) ? &m_ring[i] : &m_extra;
+    }
+
+    //! disallow copying of QMPSCQueue
+    QMPSCQueue(QMPSCQueue const &);
+
+    //! disallow assignment of QMPSCQueue
+    QMPSCQueue & operator=(QMPSCQueue const &);
+
+    friend class QF;
+    friend class QActive;
+    friend class QTicker;
+};
+
+} // namespace QP
+
+#endif // qmpscqueue_h
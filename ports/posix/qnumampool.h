@@ -0,0 +1,118 @@
+/// @file
+/// @brief NUMA-aware memory pool for the QF/C++ port to POSIX/P-threads
+/// @cond
+///***************************************************************************
+/// Last updated for version 6.3.4
+/// Last updated on  2018-09-04
+///
+///                    Q u a n t u m     L e a P s
+///                    ---------------------------
+///                    innovating embedded systems
+///
+/// Copyright (C) Quantum Leaps, LLC. All rights reserved.
+///
+/// This program is open source software: you can redistribute it and/or
+/// modify it under the terms of the GNU General Public License as published
+/// by the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Alternatively, this program may be distributed and modified under the
+/// terms of Quantum Leaps commercial licenses, which expressly supersede
+/// the GNU General Public License and are specifically designed for
+/// licensees interested in retaining the proprietary status of their code.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program. If not, see <http://www.gnu.org/licenses/>.
+///
+/// Contact information:
+/// https://www.state-machine.com
+/// mailto:info@state-machine.com
+///***************************************************************************
+/// @endcond
+
+
+#ifndef qnumampool_h
+#define qnumampool_h
+
+namespace QP {
+
+//****************************************************************************
+//! NUMA-aware fixed block-size memory pool
+/// @description
+/// This memory pool is used as the #QF_EPOOL_TYPE_ of the event pools in
+/// the POSIX port when the macro QF_POSIX_NUMA is defined. It has the same
+/// interface and semantics as QP::QMPool, but it consists of one QP::QMPool
+/// replica for every NUMA node of the host (up to #QF_NUMA_MAX_NODES), each
+/// with the storage bound to the memory of its node, see NOTE12 in
+/// qf_port.h.@n
+/// @n
+/// A block is taken from the replica of the allocation node of the calling
+/// thread (QP::QF_setAllocNode(), by default the home node of the active
+/// object or the node of the CPU), and from the other replicas only when
+/// the local one cannot satisfy the request. A block is always returned to
+/// the replica it comes from, which is found by the address of the block.
+///
+/// @note
+/// The storage provided to QP::QF::poolInit() (if any) is used for the
+/// replica of the node 0, while the replicas of the other nodes are
+/// allocated with mmap(), each of the same size.
+///
+class QNumaMPool {
+private:
+    //! the replicas of the pool, one for every NUMA node
+    QMPool m_node[QF_NUMA_MAX_NODES];
+
+    //! the start of the storage of every replica
+    uint8_t *m_lo[QF_NUMA_MAX_NODES];
+
+    //! the end of the storage of every replica (one past the last byte)
+    uint8_t *m_hi[QF_NUMA_MAX_NODES];
+
+    //! number of the replicas (NUMA nodes)
+    uint_fast8_t m_nNodes;
+
+public:
+    QNumaMPool(void); //!< public default constructor
+
+    //! Initializes the replicas of the NUMA-aware event pool
+    void init(void * const poolSto, uint_fast32_t poolSize,
+              uint_fast16_t blockSize);
+
+    //! Obtains a memory block from the replica local to the caller
+    void *get(uint_fast16_t const margin);
+
+    //! Returns a memory block back to the replica it comes from
+    void put(void * const b);
+
+    //! Obtains a chain of @p n memory blocks (all or none) from one replica
+    void *getN(uint_fast16_t const n, uint_fast16_t const margin);
+
+    //! Returns a chain of @p n memory blocks to the replicas they come from
+    void putN(void * const chain, uint_fast16_t const n);
+
+    //! return the fixed block-size of the blocks managed by this pool
+    QMPoolSize getBlockSize(void) const {
+        return m_node[0].getBlockSize();
+    }
+
+private:
+    //! the index of the replica the block @p b comes from
+    uint_fast8_t nodeOf(void const * const b) const;
+
+    //! disallow copying of QNumaMPool
+    QNumaMPool(QNumaMPool const &);
+
+    //! disallow assignment of QNumaMPool
+    QNumaMPool & operator=(QNumaMPool const &);
+
+    friend class QF;
+};
+
+} // namespace QP
+
+#endif // qnumampool_h
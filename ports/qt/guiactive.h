@@ -44,7 +44,7 @@ namespace QP {
 class GuiQActive : public QActive {
 public:
     GuiQActive(QStateHandler const initial) : QActive(initial) {}
-    virtual void start(uint_fast8_t const prio,
+    virtual void start(QPrio const prio,
         QEvt const *qSto[], uint_fast16_t const qLen,
         void * const stkSto, uint_fast16_t const stkSize,
         QEvt const * const ie);
@@ -61,7 +61,7 @@ public:
 class GuiQMActive : public QMActive {
 public:
     GuiQMActive(QStateHandler const initial) : QMActive(initial) {}
-    virtual void start(uint_fast8_t const prio,
+    virtual void start(QPrio const prio,
                        QEvt const *qSto[], uint_fast16_t const qLen,
                        void * const stkSto, uint_fast16_t const stkSize,
                        QEvt const * const ie);
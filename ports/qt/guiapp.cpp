@@ -89,13 +89,13 @@ bool GuiApp::event(QEvent *e) {
 }
 
 //............................................................................
-void GuiQActive::start(uint_fast8_t const prio,
+void GuiQActive::start(QPrio const prio,
                        QEvt const *qSto[], uint_fast16_t const /*qLen*/,
                        void * const stkSto, uint_fast16_t const /*stkSize*/,
                        QEvt const * const ie)
 {
-    Q_REQUIRE((static_cast<uint_fast8_t>(0) < prio)
-              && (prio <= static_cast<uint_fast8_t>(QF_MAX_ACTIVE))
+    Q_REQUIRE((static_cast<QPrio>(0) < prio)
+              && (prio <= static_cast<QPrio>(QF_MAX_ACTIVE))
               && (qSto == (QEvt const **)0)/* does not need per-actor queue */
               && (stkSto == static_cast<void *>(0))); // AOs don't need stack
 
@@ -169,13 +169,13 @@ void GuiQActive::postLIFO(QEvt const * const e) {
 }
 
 //****************************************************************************
-void GuiQMActive::start(uint_fast8_t const prio,
+void GuiQMActive::start(QPrio const prio,
                         QEvt const *qSto[], uint_fast16_t const /*qLen*/,
                         void * const stkSto, uint_fast16_t const /*stkSize*/,
                         QEvt const * const ie)
 {
-    Q_REQUIRE((static_cast<uint_fast8_t>(0) < prio)
-              && (prio <= static_cast<uint_fast8_t>(QF_MAX_ACTIVE))
+    Q_REQUIRE((static_cast<QPrio>(0) < prio)
+              && (prio <= static_cast<QPrio>(QF_MAX_ACTIVE))
               && (qSto == (QEvt const **)0)/* does not need per-actor queue */
               && (stkSto == static_cast<void *>(0))); // AOs don't need stack
 
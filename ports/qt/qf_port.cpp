@@ -139,7 +139,7 @@ void QF_setTickRate(unsigned ticksPerSec) {
     l_tickerThread.m_tickInterval = 1000U/ticksPerSec;
 }
 //............................................................................
-void QActive::start(uint_fast8_t const prio,
+void QActive::start(QPrio const prio,
                      QEvt const **qSto, uint_fast16_t qLen,
                      void * const stkSto, uint_fast16_t const stkSize,
                      QEvt const * const ie)
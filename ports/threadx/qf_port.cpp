@@ -96,7 +96,7 @@ static void thread_function(ULONG thread_input) { // ThreadX signature
     QF::thread_(reinterpret_cast<QActive *>(thread_input));
 }
 //............................................................................
-void QActive::start(uint_fast8_t prio,
+void QActive::start(QPrio const prio,
                     QEvt const *qSto[], uint_fast16_t qLen,
                     void *stkSto, uint_fast16_t stkSize,
                     QEvt const *ie)
@@ -264,7 +264,7 @@ QEvt const *QActive::get_(void) {
 }
 
 //............................................................................
-void QFSchedLock::lock(uint_fast8_t prio) {
+void QFSchedLock::lock(QPrio prio) {
     m_lockHolder = tx_thread_identify();
 
     /// @pre must be thread level, so current TX thread must be available
@@ -287,7 +287,7 @@ void QFSchedLock::lock(uint_fast8_t prio) {
     }
     else if (tx_err == TX_THRESH_ERROR) {
         // threshold was greater than (lower prio) than the current prio
-        m_lockPrio = static_cast<uint_fast8_t>(0); // threshold not changed
+        m_lockPrio = static_cast<QPrio>(0); // threshold not changed
     }
     else {
         /* no other errors are tolerated */
@@ -301,7 +301,7 @@ void QFSchedLock::unlock(void) const {
 
     /// @pre the lock holder TX thread must be available
     Q_REQUIRE_ID(900, (m_lockHolder != static_cast<TX_THREAD *>(0))
-                      && (m_lockPrio != static_cast<uint_fast8_t>(0)));
+                      && (m_lockPrio != static_cast<QPrio>(0)));
 
     QS_BEGIN_(QS_SCHED_UNLOCK,
               static_cast<void *>(0), static_cast<void *>(0))
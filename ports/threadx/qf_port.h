@@ -71,24 +71,24 @@
     #define QF_SCHED_STAT_ QFSchedLock lockStat_;
     #define QF_SCHED_LOCK_(prio_) do { \
         if (_tx_thread_system_state != (UINT)0) { \
-            lockStat_.m_lockPrio = static_cast<uint_fast8_t>(0); \
+            lockStat_.m_lockPrio = static_cast<QPrio>(0); \
         } else { \
             lockStat_.lock((prio_)); \
         } \
     } while (false)
     #define QF_SCHED_UNLOCK_() do { \
-        if (lockStat_.m_lockPrio != static_cast<uint_fast8_t>(0)) { \
+        if (lockStat_.m_lockPrio != static_cast<QPrio>(0)) { \
             lockStat_.unlock(); \
         } \
     } while (false)
 
     namespace QP {
         struct QFSchedLock {
-            uint_fast8_t m_lockPrio; //!< lock prio [QF numbering scheme]
+            QPrio m_lockPrio;        //!< lock prio [QF numbering scheme]
             UINT m_prevThre;         //!< previoius preemption threshold
             TX_THREAD *m_lockHolder; //!< the thread holding the lock
 
-            void lock(uint_fast8_t prio);
+            void lock(QPrio prio);
             void unlock(void) const;
         };
     } // namespace QP
@@ -72,7 +72,7 @@ void QF::stop(void) {
 }
 
 //............................................................................
-void QActive::start(uint_fast8_t prio,
+void QActive::start(QPrio const prio,
                     QEvt const *qSto[], uint_fast16_t qLen,
                     void *stkSto, uint_fast16_t /* stkSize */,
                     QEvt const *ie)
@@ -80,8 +80,8 @@ void QActive::start(uint_fast8_t prio,
     /// @pre the priority must be in range and the stack storage must not
     /// be provided, because this TI-RTOS port does not need per-AO stacks.
     ///
-    Q_REQUIRE_ID(400, (static_cast<uint_fast8_t>(0) < prio)
-              && (prio <= static_cast<uint_fast8_t>(QF_MAX_ACTIVE))
+    Q_REQUIRE_ID(400, (static_cast<QPrio>(0) < prio)
+              && (prio <= static_cast<QPrio>(QF_MAX_ACTIVE))
               && (stkSto == static_cast<void *>(0)));
 
 
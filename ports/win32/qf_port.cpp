@@ -71,6 +71,9 @@ void QF::init(void) {
     // uninitialized data (as is required by the C++ Standard).
     extern uint_fast8_t QF_maxPool_;
     QF_maxPool_ = static_cast<uint_fast8_t>(0);
+#if (QF_EPOOL_LUT_SIZE > 0)
+    bzero(&QF_poolLut_[0], static_cast<uint_fast16_t>(sizeof(QF_poolLut_)));
+#endif
     bzero(&QF::timeEvtHead_[0],
           static_cast<uint_fast16_t>(sizeof(QF::timeEvtHead_)));
     bzero(&active_[0], static_cast<uint_fast16_t>(sizeof(active_)));
@@ -153,13 +156,13 @@ void QF_setWin32Prio(QActive *act, int_t win32Prio) {
     }
 }
 //****************************************************************************
-void QActive::start(uint_fast8_t prio,
+void QActive::start(QPrio const prio,
                     QEvt const *qSto[], uint_fast16_t qLen,
                     void *stkSto, uint_fast16_t stkSize,
                     QEvt const *ie)
 {
-    Q_REQUIRE_ID(700, (static_cast<uint_fast8_t>(0) < prio) /* priority...*/
-        && (prio <= static_cast<uint_fast8_t>(QF_MAX_ACTIVE)) /*... in range */
+    Q_REQUIRE_ID(700, (static_cast<QPrio>(0) < prio) /* priority...*/
+        && (prio <= static_cast<QPrio>(QF_MAX_ACTIVE)) /*... in range */
         && (stkSto == static_cast<void *>(0)));    /* statck storage must NOT...
                                                     * ... be provided */
 
@@ -67,11 +67,18 @@ QActive *QF::active_[QF_MAX_ACTIVE + 1]; // to be used by QF ports only
 /// @sa QP::QF::remove_()
 ///
 void QF::add_(QActive * const a) {
-    uint_fast8_t p = static_cast<uint_fast8_t>(a->m_prio);
+    QPrio const p = a->m_prio;
 
-    Q_REQUIRE_ID(100, (static_cast<uint_fast8_t>(0) < p)
-                      && (p <= static_cast<uint_fast8_t>(QF_MAX_ACTIVE))
+    Q_REQUIRE_ID(100, (static_cast<QPrio>(0) < p)
+                      && (p <= static_cast<QPrio>(QF_MAX_ACTIVE))
                       && (active_[p] == static_cast<QActive *>(0)));
+#if (QF_MAX_CONFLATE > 0) && !(defined QACTIVE_EQUEUE_PORT_)
+    /// @pre with conflatable signals, the indices into the ring buffer
+    /// of the queue must stay below the special positions QF_cflFront_ and
+    /// QF_cflNone_ of the waiting events (QP::QActive::setConflate())
+    Q_REQUIRE_ID(110, (a->m_nCfl == static_cast<uint8_t>(0))
+                      || (a->m_eQueue.m_end < QF_cflFront_));
+#endif
     QF_CRIT_STAT_
     QF_CRIT_ENTRY_();
     active_[p] = a;  // registger the active object at this priority
@@ -93,10 +100,10 @@ void QF::add_(QActive * const a) {
 /// @sa QP::QF::add_()
 ///
 void QF::remove_(QActive * const a) {
-    uint_fast8_t p = static_cast<uint_fast8_t>(a->m_prio);
+    QPrio const p = a->m_prio;
 
-    Q_REQUIRE_ID(200, (static_cast<uint_fast8_t>(0) < p)
-                      && (p <= static_cast<uint_fast8_t>(QF_MAX_ACTIVE))
+    Q_REQUIRE_ID(200, (static_cast<QPrio>(0) < p)
+                      && (p <= static_cast<QPrio>(QF_MAX_ACTIVE))
                       && (active_[p] == a));
 
     QF_CRIT_STAT_
@@ -140,14 +147,12 @@ void QF::bzero(void * const start, uint_fast16_t len) {
 // Log-base-2 calculations ...
 #ifndef QF_LOG2
 
-//! function that returns (log2(x) + 1), where @p x is a 32-bit bitmask */
-///
 /// @description
 /// This function returns the 1-based number of the most significant 1-bit
 /// of a 32-bit bitmask. This function can be replaced in the QP ports, if
 /// the CPU has special instructions, such as CLZ (count leading zeros).
 ///
-uint_fast8_t QPSet::findMax(void) const {
+uint_fast8_t QF_log2_(uint32_t x) {
     static uint8_t const log2LUT[16] = {
         static_cast<uint8_t>(0), static_cast<uint8_t>(1),
         static_cast<uint8_t>(2), static_cast<uint8_t>(2),
@@ -158,21 +163,7 @@ uint_fast8_t QPSet::findMax(void) const {
         static_cast<uint8_t>(4), static_cast<uint8_t>(4),
         static_cast<uint8_t>(4), static_cast<uint8_t>(4)
     };
-#if (QF_MAX_ACTIVE <= 32)
-    uint32_t x = m_bits;
     uint_fast8_t n = static_cast<uint_fast8_t>(0);
-#else
-    uint32_t x;
-    uint_fast8_t n;
-    if (m_bits[1] != static_cast<uint32_t>(0)) {
-        x = m_bits[1];
-        n = static_cast<uint_fast8_t>(32);
-    }
-    else {
-        x = m_bits[0];
-        n = static_cast<uint_fast8_t>(0);
-    }
-#endif
     if (x != static_cast<uint32_t>(0)) {
         uint32_t t = (x >> 16);
         if (t != static_cast<uint32_t>(0)) {
@@ -194,6 +185,25 @@ uint_fast8_t QPSet::findMax(void) const {
     return n;
 }
 
+//****************************************************************************
+QPrio QPSet::findMax(void) const {
+#if (QF_MAX_ACTIVE <= 32)
+    return static_cast<QPrio>(QF_log2_(m_bits));
+#elif (QF_MAX_ACTIVE <= 64)
+    return (m_bits[1] != static_cast<uint32_t>(0))
+        ? static_cast<QPrio>(QF_log2_(m_bits[1])
+                             + static_cast<uint_fast8_t>(32))
+        : static_cast<QPrio>(QF_log2_(m_bits[0]));
+#else
+    QPrio n = static_cast<QPrio>(QF_log2_(m_summary));
+    if (n != static_cast<QPrio>(0)) {
+        --n; // index of the highest non-empty bitmask
+        n = static_cast<QPrio>(QF_log2_(m_bits[n]) + (n << 5));
+    }
+    return n;
+#endif
+}
+
 #endif // QF_LOG2
 
 } // namespace QP
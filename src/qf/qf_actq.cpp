@@ -51,10 +51,126 @@
     #include "qs_dummy.h" // disable the QS software tracing
 #endif // Q_SPY
 
+// The event queue operations for active objects are provided here for the
+// native QF event queue (QP::QEQueue), unless the QF port implements them for
+// its own event queue type (see the macro QACTIVE_EQUEUE_PORT_).
+#ifndef QACTIVE_EQUEUE_PORT_
+
 namespace QP {
 
 Q_DEFINE_THIS_MODULE("qf_actq")
 
+#if (QF_MAX_CONFLATE > 0)
+//****************************************************************************
+/// @description
+/// Finds the signal @p sig among the conflatable signals of the active
+/// object (QP::QActive::setConflate()).
+///
+/// @returns
+/// the index of the conflatable signal in m_cflSig[] or m_nCfl, if the
+/// signal @p sig is not conflatable.
+///
+inline uint_fast8_t QActive::cflFind_(QSignal const sig) const {
+    uint_fast8_t i = static_cast<uint_fast8_t>(0);
+    while ((i < static_cast<uint_fast8_t>(m_nCfl)) && (m_cflSig[i] != sig)) {
+        ++i;
+    }
+    return i;
+}
+
+//****************************************************************************
+/// @description
+/// Follows the waiting event of a conflatable signal (if any), which moves
+/// from the position @p from to the position @p to in the event queue.
+/// Must be called inside the critical section of the queue.
+///
+inline void QActive::cflMove_(QEQueueCtr const from, QEQueueCtr const to) {
+    for (uint_fast8_t i = static_cast<uint_fast8_t>(0);
+         i < static_cast<uint_fast8_t>(m_nCfl); ++i)
+    {
+        if (m_cflPos[i] == from) {
+            m_cflPos[i] = to;
+            break; // at most one event waits at any position
+        }
+    }
+}
+#endif // (QF_MAX_CONFLATE > 0)
+
+#if (QF_QUEUE_HIST_SIZE > 0)
+//****************************************************************************
+// the log2 class of the value @p x in the queue telemetry histograms
+static inline uint_fast8_t qstatClass_(uint32_t x) {
+#ifdef QF_LOG2
+    // the value 0 has the class 0 (QF_LOG2(0) is undefined in some ports)
+    uint_fast8_t n = (x != static_cast<uint32_t>(0))
+                     ? static_cast<uint_fast8_t>(QF_LOG2(x))
+                     : static_cast<uint_fast8_t>(0);
+#else
+    uint_fast8_t n = static_cast<uint_fast8_t>(0);
+    while (x != static_cast<uint32_t>(0)) {
+        ++n;
+        x >>= 1;
+    }
+#endif // QF_LOG2
+    return (n < static_cast<uint_fast8_t>(QF_QUEUE_HIST_SIZE))
+           ? n
+           : static_cast<uint_fast8_t>(QF_QUEUE_HIST_SIZE - 1);
+}
+
+//****************************************************************************
+/// @description
+/// Stamps the entry @p i of the event queue (the ring-buffer index or
+/// m_eQueue.m_end for the front event) with the enqueue time @p t, if the
+/// active object has the timestamp storage (QP::QActive::initQueueStats()).
+/// Must be called inside the critical section of the queue.
+///
+inline void QActive::qstatStamp_(QEQueueCtr const i, uint32_t const t) {
+    if (m_qTime != static_cast<uint32_t *>(0)) {
+        QF_PTR_AT_(m_qTime, i) = t;
+    }
+}
+
+//****************************************************************************
+/// @description
+/// The enqueue timestamp follows the event, which moves from the queue
+/// entry @p from to the queue entry @p to.
+///
+inline void QActive::qstatMove_(QEQueueCtr const from, QEQueueCtr const to) {
+    if (m_qTime != static_cast<uint32_t *>(0)) {
+        QF_PTR_AT_(m_qTime, to) = QF_PTR_AT_(m_qTime, from);
+    }
+}
+
+//****************************************************************************
+/// @description
+/// Counts the depth of the queue at enqueue, which includes the new event.
+///
+/// @param[in] nFree  the number of free entries after the enqueue
+///
+inline void QActive::qstatDepth_(QEQueueCtr const nFree) {
+    uint32_t const depth = static_cast<uint32_t>(m_eQueue.m_end)
+        + static_cast<uint32_t>(1) - static_cast<uint32_t>(nFree);
+    ++m_qStats.depthHist[qstatClass_(depth)];
+}
+
+//****************************************************************************
+/// @description
+/// Counts the residence time of the front event, which is being taken out
+/// of the queue, from its enqueue timestamp.
+///
+inline void QActive::qstatTime_(void) {
+    if (m_qTime != static_cast<uint32_t *>(0)) {
+        uint32_t const t = static_cast<uint32_t>(QF_QUEUE_TIME()
+            - QF_PTR_AT_(m_qTime, m_eQueue.m_end));
+        ++m_qStats.nEvts;
+        if (m_qStats.maxTime < t) {
+            m_qStats.maxTime = t;
+        }
+        ++m_qStats.timeHist[qstatClass_(t)];
+    }
+}
+#endif // (QF_QUEUE_HIST_SIZE > 0)
+
 //****************************************************************************
 /// @description
 /// Direct event posting is the simplest asynchronous communication method
@@ -78,6 +194,12 @@ Q_DEFINE_THIS_MODULE("qf_actq")
 /// delivery guarantee). An assertion fires, when the event cannot be
 /// delivered in this case.
 ///
+/// @note
+/// An event of a conflatable signal (QP::QActive::setConflate()) replaces
+/// the event of the same signal still waiting in the queue, if any. Such
+/// event takes over the position of the waiting event, which is recycled.
+/// The conflating posting uses no free entries, so it always succeeds.
+///
 /// @usage
 /// @include qf_post.cpp
 ///
@@ -98,7 +220,11 @@ bool QActive::post_(QEvt const * const e, uint_fast16_t const margin,
     /// @pre event pointer must be valid
     Q_REQUIRE_ID(100, e != static_cast<QEvt const *>(0));
 
-    QF_CRIT_ENTRY_();
+#if (QF_QUEUE_HIST_SIZE > 0)
+    uint32_t const now = QF_QUEUE_TIME(); // the enqueue timestamp
+#endif
+
+    QF_CRIT_OBJ_ENTRY_(&m_eQueue.m_crit);
     QEQueueCtr nFree = m_eQueue.m_nFree; // get volatile into the temporary
 
     // test-probe#1 for faking queue overflow
@@ -106,6 +232,51 @@ bool QActive::post_(QEvt const * const e, uint_fast16_t const margin,
         nFree = static_cast<QEQueueCtr>(0);
     )
 
+#if (QF_MAX_CONFLATE > 0)
+    uint_fast8_t const cfl = cflFind_(e->sig);
+    // an event of the same conflatable signal waiting in the queue?
+    if ((cfl < static_cast<uint_fast8_t>(m_nCfl))
+        && (m_cflPos[cfl] != QF_cflNone_))
+    {
+        QEvt const *old; // the event to be replaced
+        if (m_cflPos[cfl] == QF_cflFront_) {
+            old = m_eQueue.m_frontEvt;
+            m_eQueue.m_frontEvt = e; // replace the event at the front
+#if (QF_QUEUE_HIST_SIZE > 0)
+            qstatStamp_(m_eQueue.m_end, now);
+#endif
+        }
+        else {
+            old = QF_PTR_AT_(m_eQueue.m_ring, m_cflPos[cfl]);
+            QF_PTR_AT_(m_eQueue.m_ring, m_cflPos[cfl]) = e; // replace
+#if (QF_QUEUE_HIST_SIZE > 0)
+            qstatStamp_(m_cflPos[cfl], now);
+#endif
+        }
+
+        // is it a dynamic event?
+        if (e->poolId_ != static_cast<uint8_t>(0)) {
+            QF_EVT_REF_CTR_INC_(e); // increment the reference counter
+        }
+
+        QS_BEGIN_NOCRIT_(QS_QF_ACTIVE_POST_FIFO,
+                         QS::priv_.locFilter[QS::AO_OBJ], this)
+            QS_TIME_();               // timestamp
+            QS_OBJ_(sender);          // the sender object
+            QS_SIG_(e->sig);          // the signal of the event
+            QS_OBJ_(this);            // this active object
+            QS_2U8_(e->poolId_, e->refCtr_); // pool Id & refCtr of the evt
+            QS_EQC_(nFree);           // number of free entries (unchanged)
+            QS_EQC_(m_eQueue.m_nMin); // min number of free entries
+        QS_END_NOCRIT_()
+
+        QF_CRIT_EXIT_();
+
+        QF::gc(old); // recycle the replaced event
+        return true;
+    }
+#endif // (QF_MAX_CONFLATE > 0)
+
     if (margin == QF_NO_MARGIN) {
         if (nFree > static_cast<QEQueueCtr>(0)) {
             status = true; // can post
@@ -161,15 +332,38 @@ bool QActive::post_(QEvt const * const e, uint_fast16_t const margin,
             m_eQueue.m_nMin = nFree;  // update minimum so far
         }
 
+#if (QF_QUEUE_HIST_SIZE > 0)
+        // the timestamp storage must cover the whole queue
+        Q_ASSERT_CRIT_(120, (m_qTime == static_cast<uint32_t *>(0))
+                            || (m_qTimeLen > m_eQueue.m_end));
+        qstatDepth_(nFree);
+#endif
+
         // is the queue empty?
         if (m_eQueue.m_frontEvt == static_cast<QEvt const *>(0)) {
             m_eQueue.m_frontEvt = e;      // deliver event directly
+#if (QF_QUEUE_HIST_SIZE > 0)
+            qstatStamp_(m_eQueue.m_end, now);
+#endif
+#if (QF_MAX_CONFLATE > 0)
+            if (cfl < static_cast<uint_fast8_t>(m_nCfl)) {
+                m_cflPos[cfl] = QF_cflFront_; // the event waits at the front
+            }
+#endif
             QACTIVE_EQUEUE_SIGNAL_(this); // signal the event queue
         }
         // queue is not empty, insert event into the ring-buffer
         else {
             // insert event pointer e into the buffer (FIFO)
             QF_PTR_AT_(m_eQueue.m_ring, m_eQueue.m_head) = e;
+#if (QF_QUEUE_HIST_SIZE > 0)
+            qstatStamp_(m_eQueue.m_head, now);
+#endif
+#if (QF_MAX_CONFLATE > 0)
+            if (cfl < static_cast<uint_fast8_t>(m_nCfl)) {
+                m_cflPos[cfl] = m_eQueue.m_head; // the event waits here
+            }
+#endif
 
             // need to wrap head?
             if (m_eQueue.m_head == static_cast<QEQueueCtr>(0)) {
@@ -181,6 +375,8 @@ bool QActive::post_(QEvt const * const e, uint_fast16_t const margin,
     }
 #endif
         QF_CRIT_EXIT_();
+
+        QACTIVE_EQUEUE_WAKE_(this); // complete signaling the event queue
     }
     else { // cannot post the event
 
@@ -203,6 +399,203 @@ bool QActive::post_(QEvt const * const e, uint_fast16_t const margin,
     return status;
 }
 
+//****************************************************************************
+/// @description
+/// Bulk direct event posting. The function posts the events from the
+/// array @p evts (FIFO) in one critical section and signals the event queue
+/// at most once, which is cheaper than calling QP::QActive::post_() for
+/// every event of a burst.
+///
+/// @param[in] evts   array of pointers to the events to be posted
+/// @param[in] n      number of events in the array
+/// @param[in] margin number of required free slots in the queue after
+///                   posting the events. The special value QP::QF_NO_MARGIN
+///                   means that all the events must be posted (all-or-
+///                   nothing), or this function asserts.
+///
+/// @returns
+/// the number of events posted, which are the first events of the array
+/// @p evts. The events that were not posted are recycled, just like the
+/// event of a failed QP::QActive::post_().
+///
+/// @note
+/// When the active object has conflatable signals (QActive::setConflate()),
+/// the events are posted one by one with QP::QActive::post_(), because
+/// the replaced events can be recycled only outside the critical section.
+///
+/// @attention
+/// Should be called only via the macro POST_N() or POST_N_X(). This
+/// function is not virtual and cannot be used with QP::QTicker.
+///
+/// @sa
+/// QActive::post_(), QActive::getBatch_()
+///
+#ifndef Q_SPY
+uint_fast16_t QActive::postN_(QEvt const * const evts[],
+                              uint_fast16_t const n,
+                              uint_fast16_t const margin)
+#else
+uint_fast16_t QActive::postN_(QEvt const * const evts[],
+                              uint_fast16_t const n,
+                              uint_fast16_t const margin,
+                              void const * const sender)
+#endif
+{
+    QF_CRIT_STAT_
+    QS_TEST_PROBE_DEF(&QActive::postN_)
+
+    /// @pre the event array must be valid
+    Q_REQUIRE_ID(500, evts != static_cast<QEvt const * const *>(0));
+
+#if (QF_MAX_CONFLATE > 0)
+    if (m_nCfl != static_cast<uint8_t>(0)) { // any conflatable signals?
+        uint_fast16_t k = static_cast<uint_fast16_t>(0);
+        while ((k < n) && POST_X(evts[k], margin, sender)) {
+            ++k;
+        }
+        // the event that failed is already recycled by post_()
+        for (uint_fast16_t j = k + 1U; j < n; ++j) {
+            QF::gc(evts[j]); // recycle the events to avoid a leak
+        }
+        return k;
+    }
+#endif // (QF_MAX_CONFLATE > 0)
+
+#if (QF_QUEUE_HIST_SIZE > 0)
+    uint32_t const now = QF_QUEUE_TIME(); // the enqueue timestamp
+#endif
+
+    QF_CRIT_OBJ_ENTRY_(&m_eQueue.m_crit);
+    QEQueueCtr nFree = m_eQueue.m_nFree; // get volatile into the temporary
+
+    // test-probe#1 for faking queue overflow
+    QS_TEST_PROBE_ID(1,
+        nFree = static_cast<QEQueueCtr>(0);
+    )
+
+    uint_fast16_t nPost; // the number of events that can be posted
+    if (margin == QF_NO_MARGIN) {
+        if (static_cast<uint_fast16_t>(nFree) >= n) {
+            nPost = n; // can post all the events
+        }
+        else {
+            nPost = static_cast<uint_fast16_t>(0); // cannot post
+            Q_ERROR_CRIT_(510); // must be able to post all the events
+        }
+    }
+    else if (nFree > static_cast<QEQueueCtr>(margin)) {
+        nPost = static_cast<uint_fast16_t>(nFree) - margin;
+        if (nPost > n) {
+            nPost = n; // can post all the events
+        }
+    }
+    else {
+        nPost = static_cast<uint_fast16_t>(0); // cannot post, don't assert
+    }
+
+    QEvt const * const frontEvt = m_eQueue.m_frontEvt; // empty queue?
+    uint_fast16_t i;
+    for (i = static_cast<uint_fast16_t>(0); i < nPost; ++i) {
+        QEvt const * const e = evts[i];
+
+        // is it a dynamic event?
+        if (e->poolId_ != static_cast<uint8_t>(0)) {
+            QF_EVT_REF_CTR_INC_(e); // increment the reference counter
+        }
+
+        QS_BEGIN_NOCRIT_(QS_QF_ACTIVE_POST_FIFO,
+                         QS::priv_.locFilter[QS::AO_OBJ], this)
+            QS_TIME_();               // timestamp
+            QS_OBJ_(sender);          // the sender object
+            QS_SIG_(e->sig);          // the signal of the event
+            QS_OBJ_(this);            // this active object
+            QS_2U8_(e->poolId_, e->refCtr_); // pool Id & refCtr of the evt
+            QS_EQC_(nFree);           // number of free entries
+            QS_EQC_(m_eQueue.m_nMin); // min number of free entries
+        QS_END_NOCRIT_()
+
+#ifdef Q_UTEST
+    // in QUTest the events are posted under the same conditions
+    // as in QActive::post_()
+    if ((qs_tp_ == static_cast<uint32_t>(2))
+        || (sender == this)
+        || (QS::priv_.locFilter[QS::AO_OBJ] == this)
+        || ((QS::priv_.locFilter[QS::AO_OBJ] == static_cast<void *>(0))
+            && (sender == &QS::rxPriv_)))
+    {
+#endif
+
+        --nFree;  // one free entry just used up
+        if (m_eQueue.m_nMin > nFree) {
+            m_eQueue.m_nMin = nFree;  // update minimum so far
+        }
+
+#if (QF_QUEUE_HIST_SIZE > 0)
+        // the timestamp storage must cover the whole queue
+        Q_ASSERT_CRIT_(520, (m_qTime == static_cast<uint32_t *>(0))
+                            || (m_qTimeLen > m_eQueue.m_end));
+        qstatDepth_(nFree);
+#endif
+
+        // is the queue empty?
+        if (m_eQueue.m_frontEvt == static_cast<QEvt const *>(0)) {
+            m_eQueue.m_frontEvt = e;  // deliver event directly
+#if (QF_QUEUE_HIST_SIZE > 0)
+            qstatStamp_(m_eQueue.m_end, now);
+#endif
+        }
+        // queue is not empty, insert event into the ring-buffer
+        else {
+            // insert event pointer e into the buffer (FIFO)
+            QF_PTR_AT_(m_eQueue.m_ring, m_eQueue.m_head) = e;
+#if (QF_QUEUE_HIST_SIZE > 0)
+            qstatStamp_(m_eQueue.m_head, now);
+#endif
+
+            // need to wrap head?
+            if (m_eQueue.m_head == static_cast<QEQueueCtr>(0)) {
+                m_eQueue.m_head = m_eQueue.m_end; // wrap around
+            }
+            --m_eQueue.m_head; // advance the head (counter clockwise)
+        }
+#ifdef Q_UTEST
+    }
+#endif
+    }
+    m_eQueue.m_nFree = nFree; // update the volatile
+
+    // was the queue empty? signal the event queue only once
+    if ((frontEvt == static_cast<QEvt const *>(0))
+        && (m_eQueue.m_frontEvt != static_cast<QEvt const *>(0)))
+    {
+        QACTIVE_EQUEUE_SIGNAL_(this); // signal the event queue
+    }
+
+    for (; i < n; ++i) { // the events that cannot be posted
+        QS_BEGIN_NOCRIT_(QS_QF_ACTIVE_POST_ATTEMPT,
+                         QS::priv_.locFilter[QS::AO_OBJ], this)
+            QS_TIME_();           // timestamp
+            QS_OBJ_(sender);      // the sender object
+            QS_SIG_(evts[i]->sig); // the signal of the event
+            QS_OBJ_(this);        // this active object
+            QS_2U8_(evts[i]->poolId_, evts[i]->refCtr_); // pool Id & refCtr
+            QS_EQC_(nFree);       // number of free entries
+            QS_EQC_(static_cast<QEQueueCtr>(margin)); // margin requested
+        QS_END_NOCRIT_()
+    }
+    QF_CRIT_EXIT_();
+
+    if (nPost > static_cast<uint_fast16_t>(0)) {
+        QACTIVE_EQUEUE_WAKE_(this); // complete signaling the event queue
+    }
+
+    for (i = nPost; i < n; ++i) {
+        QF::gc(evts[i]); // recycle the events to avoid a leak
+    }
+
+    return nPost;
+}
+
 //****************************************************************************
 /// @description
 /// posts an event to the event queue of the active object  using the
@@ -221,13 +614,25 @@ void QActive::postLIFO(QEvt const * const e) {
     QF_CRIT_STAT_
     QS_TEST_PROBE_DEF(&QActive::postLIFO)
 
-    QF_CRIT_ENTRY_();
+#if (QF_QUEUE_HIST_SIZE > 0)
+    uint32_t const now = QF_QUEUE_TIME(); // the enqueue timestamp
+#endif
+
+    QF_CRIT_OBJ_ENTRY_(&m_eQueue.m_crit);
     QEQueueCtr nFree = m_eQueue.m_nFree;// tmp to avoid UB for volatile access
 
     QS_TEST_PROBE_ID(1,
         nFree = static_cast<QEQueueCtr>(0);
     )
 
+#ifdef QF_URGENT_LANE
+    // an urgent event at the front gives back the entry it borrowed
+    bool const uFront = (m_uFront != static_cast<uint8_t>(0));
+    if (uFront) {
+        ++nFree;
+    }
+#endif // QF_URGENT_LANE
+
     // the queue must be able to accept the event (cannot overflow)
     Q_ASSERT_CRIT_(210, nFree != static_cast<QEQueueCtr>(0));
 
@@ -252,9 +657,40 @@ void QActive::postLIFO(QEvt const * const e) {
         m_eQueue.m_nMin = nFree; // update minimum so far
     }
 
+#if (QF_QUEUE_HIST_SIZE > 0)
+    // the timestamp storage must cover the whole queue
+    Q_ASSERT_CRIT_(230, (m_qTime == static_cast<uint32_t *>(0))
+                        || (m_qTimeLen > m_eQueue.m_end));
+    qstatDepth_(nFree);
+#endif
+
     QEvt const *frontEvt = m_eQueue.m_frontEvt;// read volatile into temporary
     m_eQueue.m_frontEvt = e; // deliver the event directly to the front
 
+#ifdef QACTIVE_EQUEUE_LIFO_
+    QACTIVE_EQUEUE_LIFO_(this); // the event goes ahead of a batch, if any
+#endif
+
+#ifdef QF_URGENT_LANE
+    // was an urgent event at the front? return it to the urgent lane
+    if (uFront) {
+        // the urgent event still holds its entry in the urgent lane
+        Q_ASSERT_CRIT_(220, m_uQueue.m_nFree <= m_uQueue.m_end);
+
+        // insert the urgent event at the front of the urgent lane
+        QEvt const *uEvt = m_uQueue.m_frontEvt;
+        m_uQueue.m_frontEvt = frontEvt;
+        if (uEvt != static_cast<QEvt const *>(0)) {
+            ++m_uQueue.m_tail;
+            if (m_uQueue.m_tail == m_uQueue.m_end) { // need to wrap?
+                m_uQueue.m_tail = static_cast<QEQueueCtr>(0); // wrap around
+            }
+            QF_PTR_AT_(m_uQueue.m_ring, m_uQueue.m_tail) = uEvt;
+        }
+        m_uFront = static_cast<uint8_t>(0);
+    }
+    else
+#endif // QF_URGENT_LANE
     // was the queue empty?
     if (frontEvt == static_cast<QEvt const *>(0)) {
         QACTIVE_EQUEUE_SIGNAL_(this); // signal the event queue
@@ -267,37 +703,331 @@ void QActive::postLIFO(QEvt const * const e) {
         }
 
         QF_PTR_AT_(m_eQueue.m_ring, m_eQueue.m_tail) = frontEvt;
+#if (QF_QUEUE_HIST_SIZE > 0)
+        qstatMove_(m_eQueue.m_end, m_eQueue.m_tail);
+#endif
+#if (QF_MAX_CONFLATE > 0)
+        cflMove_(QF_cflFront_, m_eQueue.m_tail);
+#endif
     }
+#if (QF_QUEUE_HIST_SIZE > 0)
+    qstatStamp_(m_eQueue.m_end, now); // the new front event
+#endif
     QF_CRIT_EXIT_();
+
+    QACTIVE_EQUEUE_WAKE_(this); // complete signaling the event queue
 }
 
+#if (QF_MAX_CONFLATE > 0)
 //****************************************************************************
 /// @description
-/// The behavior of this function depends on the kernel used in the QF port.
-/// For built-in kernels (Vanilla or QK) the function can be called only when
-/// the queue is not empty, so it doesn't block. For a blocking kernel/OS
-/// the function can block and wait for delivery of an event.
+/// Marks the signal @p sig as conflatable in the event queue of the active
+/// object. A newly posted event of a conflatable signal replaces the event
+/// of the same signal, which is still waiting in the queue (see
+/// QP::QActive::post_()), so only the latest value of such signal is
+/// dispatched. This bounds the queue depth and the wasted dispatching of
+/// the stale values, for example the sensor readings or the progress
+/// updates, which a slow active object cannot keep up with.
+///
+/// @param[in] sig  the signal to be conflated
+///
+/// @attention
+/// This function must be called before the active object is started.
+/// The queue length of an active object with conflatable signals must be
+/// below the largest value of QP::QEQueueCtr minus one (e.g., below 254
+/// with #QF_EQUEUE_CTR_SIZE 1), see QP::QF::add_().
+///
+/// @note
+/// The events posted with QP::QActive::postLIFO() or to the urgent lane
+/// are never replaced (or replacing).
+///
+void QActive::setConflate(enum_t const sig) {
+    /// @pre the conflatable signals must fit into QF_MAX_CONFLATE
+    Q_REQUIRE_ID(800, m_nCfl < static_cast<uint8_t>(QF_MAX_CONFLATE));
+
+    m_cflSig[m_nCfl] = static_cast<QSignal>(sig);
+    m_cflPos[m_nCfl] = QF_cflNone_; // no event waiting yet
+    ++m_nCfl;
+}
+
+#endif // (QF_MAX_CONFLATE > 0)
+
+#if (QF_QUEUE_HIST_SIZE > 0)
+//****************************************************************************
+/// @description
+/// Provides the storage for the enqueue timestamps of the events waiting
+/// in the event queue of the active object, which enables the residence
+/// time telemetry (QP::QFQueueStats). The depth telemetry needs no storage
+/// and is always on. This function must be called before the active object
+/// is started.
+///
+/// @param[in] tSto pointer to the storage for the timestamps
+/// @param[in] tLen length of the storage, which must be at least the queue
+///                 length + 1 (the front event needs a timestamp as well)
+///
+/// @sa QP::QF::getQueueStats()
+///
+void QActive::initQueueStats(uint32_t tSto[], uint_fast16_t const tLen) {
+    m_qTime    = tSto;
+    m_qTimeLen = tLen;
+    QF::bzero(&m_qStats, static_cast<uint_fast16_t>(sizeof(m_qStats)));
+}
+#endif // (QF_QUEUE_HIST_SIZE > 0)
+
+#ifdef QF_URGENT_LANE
+//****************************************************************************
+/// @description
+/// Provides the storage for the urgent lane of the event queue of the
+/// active object. This function must be called before the active object
+/// is started, otherwise the urgent lane has no capacity.
+///
+/// @param[in] qSto pointer to the storage for the urgent lane
+/// @param[in] qLen length of the storage (in event pointers)
+///
+/// @sa QActive::postUrgent_()
+///
+void QActive::initUrgent(QEvt const *qSto[], uint_fast16_t const qLen) {
+    m_uQueue.init(qSto, qLen);
+    m_uFront = static_cast<uint8_t>(0);
+}
+
+//****************************************************************************
+/// @description
+/// Posts an event to the urgent lane of the event queue of the active
+/// object. The urgent events overtake all the regular events waiting in
+/// the queue, but keep the FIFO order among themselves, so the order of the
+/// regular events is not changed either. The urgent lane has its own
+/// free entries and minimum (QP::QF::getUrgentQueueMin()).
+///
+/// @param[in] e      pointer to the event to be posted
+/// @param[in] margin number of required free slots in the urgent lane after
+///                   posting the event. The special value QP::QF_NO_MARGIN
+///                   means that this function will assert if posting fails.
 ///
 /// @returns
-/// A pointer to the received event. The returned pointer is guaranteed to be
-/// valid (can't be NULL).
+/// 'true' (success) if the posting succeeded (with the provided margin) and
+/// 'false' (failure) when the posting fails.
+///
+/// @attention
+/// Should be called only via the macro POST_URGENT() or POST_URGENT_X().
 ///
 /// @note
-/// This function is used internally by a QF port to extract events from
-/// the event queue of an active object. This function depends on the event
-/// queue implementation and is sometimes customized in the QF port
-/// (file qf_port.h). Depending on the definition of the macro
-/// QACTIVE_EQUEUE_WAIT_(), the function might block the calling thread when
-/// no events are available.
+/// The oldest urgent event waits at the front of the event queue, where
+/// it borrows one free entry of the regular events, but it keeps its entry
+/// in the urgent lane until it is dispatched. When the regular events
+/// fill the whole queue, the urgent event waits behind the regular event
+/// at the front. An event self-posted with QP::QActive::postLIFO() is
+/// dispatched next, even before the urgent events, and the urgent event
+/// at the front returns to its reserved entry in the urgent lane.
 ///
-QEvt const *QActive::get_(void) {
+#ifndef Q_SPY
+bool QActive::postUrgent_(QEvt const * const e, uint_fast16_t const margin)
+#else
+bool QActive::postUrgent_(QEvt const * const e, uint_fast16_t const margin,
+                          void const * const sender)
+#endif
+{
+    bool status;
     QF_CRIT_STAT_
 
-    QF_CRIT_ENTRY_();
-    QACTIVE_EQUEUE_WAIT_(this); // wait for event to arrive directly
+    /// @pre event pointer must be valid
+    Q_REQUIRE_ID(700, e != static_cast<QEvt const *>(0));
+
+    QF_CRIT_OBJ_ENTRY_(&m_eQueue.m_crit);
+    QEQueueCtr nFree = m_uQueue.m_nFree; // get volatile into the temporary
+
+    if (margin == QF_NO_MARGIN) {
+        if (nFree > static_cast<QEQueueCtr>(0)) {
+            status = true; // can post
+        }
+        else {
+            status = false; // cannot post
+            Q_ERROR_CRIT_(710); // must be able to post the event
+        }
+    }
+    else if (nFree > static_cast<QEQueueCtr>(margin)) {
+        status = true; // can post
+    }
+    else {
+        status = false; // cannot post, but don't assert
+    }
+
+    if (status) { // can post the event?
 
+        // is it a dynamic event?
+        if (e->poolId_ != static_cast<uint8_t>(0)) {
+            QF_EVT_REF_CTR_INC_(e); // increment the reference counter
+        }
+
+        QS_BEGIN_NOCRIT_(QS_QF_ACTIVE_POST_URGENT,
+                         QS::priv_.locFilter[QS::AO_OBJ], this)
+            QS_TIME_();               // timestamp
+            QS_OBJ_(sender);          // the sender object
+            QS_SIG_(e->sig);          // the signal of the event
+            QS_OBJ_(this);            // this active object
+            QS_2U8_(e->poolId_, e->refCtr_); // pool Id & refCtr of the evt
+            QS_EQC_(nFree);           // number of free entries (urgent)
+            QS_EQC_(m_uQueue.m_nMin); // min number of free entries (urgent)
+        QS_END_NOCRIT_()
+
+        // the event holds one entry in the urgent lane, even when it
+        // waits at the front of the queue (see QActive::postLIFO())
+        --nFree;  // one free entry just used up
+        m_uQueue.m_nFree = nFree; // update the volatile
+        if (m_uQueue.m_nMin > nFree) {
+            m_uQueue.m_nMin = nFree; // update minimum so far
+        }
+
+        QEvt const *frontEvt = m_eQueue.m_frontEvt; // read volatile
+        QEQueueCtr const eFree = m_eQueue.m_nFree;  // read volatile
+
+        // is the queue empty?
+        if (frontEvt == static_cast<QEvt const *>(0)) {
+            m_eQueue.m_frontEvt = e;  // deliver event directly
+            m_uFront = static_cast<uint8_t>(1);
+            m_eQueue.m_nFree = eFree - static_cast<QEQueueCtr>(1); // borrow
+            if (m_eQueue.m_nMin > m_eQueue.m_nFree) {
+                m_eQueue.m_nMin = m_eQueue.m_nFree; // update minimum so far
+            }
+            QACTIVE_EQUEUE_SIGNAL_(this); // signal the event queue
+        }
+        // a regular event at the front and a free entry to borrow?
+        else if ((m_uFront == static_cast<uint8_t>(0))
+                 && (m_uQueue.m_frontEvt == static_cast<QEvt const *>(0))
+                 && (eFree > static_cast<QEQueueCtr>(0)))
+        {
+            m_eQueue.m_nFree = eFree - static_cast<QEQueueCtr>(1); // borrow
+            if (m_eQueue.m_nMin > m_eQueue.m_nFree) {
+                m_eQueue.m_nMin = m_eQueue.m_nFree; // update minimum so far
+            }
+
+            // the regular event goes back to the ring buffer (like LIFO)
+            ++m_eQueue.m_tail;
+            if (m_eQueue.m_tail == m_eQueue.m_end) { // need to wrap?
+                m_eQueue.m_tail = static_cast<QEQueueCtr>(0); // wrap around
+            }
+            QF_PTR_AT_(m_eQueue.m_ring, m_eQueue.m_tail) = frontEvt;
+#if (QF_QUEUE_HIST_SIZE > 0)
+            qstatMove_(m_eQueue.m_end, m_eQueue.m_tail);
+#endif
+#if (QF_MAX_CONFLATE > 0)
+            cflMove_(QF_cflFront_, m_eQueue.m_tail);
+#endif
+
+            m_eQueue.m_frontEvt = e; // overtake the regular event
+            m_uFront = static_cast<uint8_t>(1);
+        }
+        // queue behind the other urgent events (FIFO)
+        else {
+            if (m_uQueue.m_frontEvt == static_cast<QEvt const *>(0)) {
+                m_uQueue.m_frontEvt = e;
+            }
+            else {
+                QF_PTR_AT_(m_uQueue.m_ring, m_uQueue.m_head) = e;
+                if (m_uQueue.m_head == static_cast<QEQueueCtr>(0)) {
+                    m_uQueue.m_head = m_uQueue.m_end; // wrap around
+                }
+                --m_uQueue.m_head;
+            }
+        }
+#ifdef QACTIVE_EQUEUE_URGENT_
+        QACTIVE_EQUEUE_URGENT_(this); // the event goes ahead of a batch
+#endif
+        QF_CRIT_EXIT_();
+
+        QACTIVE_EQUEUE_WAKE_(this); // complete signaling the event queue
+    }
+    else { // cannot post the event
+
+        QS_BEGIN_NOCRIT_(QS_QF_ACTIVE_POST_ATTEMPT,
+                         QS::priv_.locFilter[QS::AO_OBJ], this)
+            QS_TIME_();           // timestamp
+            QS_OBJ_(sender);      // the sender object
+            QS_SIG_(e->sig);      // the signal of the event
+            QS_OBJ_(this);        // this active object
+            QS_2U8_(e->poolId_, e->refCtr_); // pool Id & refCtr of the evt
+            QS_EQC_(nFree);       // number of free entries (urgent)
+            QS_EQC_(static_cast<QEQueueCtr>(margin)); // margin requested
+        QS_END_NOCRIT_()
+
+        QF_CRIT_EXIT_();
+
+        QF::gc(e); // recycle the evnet to avoid a leak
+    }
+
+    return status;
+}
+#endif // QF_URGENT_LANE
+
+//****************************************************************************
+/// @description
+/// Removes the event from the front of the event queue of the active object
+/// and moves the next event (if any) to the front. The queue must not be
+/// empty and the function must be called inside the critical section of
+/// the queue (QP::QActive::get_(), QP::QActive::getBatch_()).
+///
+/// @returns
+/// A pointer to the removed event.
+///
+inline QEvt const *QActive::getInCrit_(void) {
     QEvt const *e = m_eQueue.m_frontEvt; // always remove evt from the front
     QEQueueCtr nFree = m_eQueue.m_nFree + static_cast<QEQueueCtr>(1);
+
+#if (QF_MAX_CONFLATE > 0) || (QF_QUEUE_HIST_SIZE > 0)
+#ifdef QF_URGENT_LANE
+    if (m_uFront == static_cast<uint8_t>(0)) // a regular event at the front?
+#endif
+    {
+#if (QF_MAX_CONFLATE > 0)
+        cflMove_(QF_cflFront_, QF_cflNone_); // the event no longer waits
+#endif
+#if (QF_QUEUE_HIST_SIZE > 0)
+        qstatTime_(); // the event waited since its enqueue timestamp
+#endif
+    }
+#endif // (QF_MAX_CONFLATE > 0) || (QF_QUEUE_HIST_SIZE > 0)
+
+#ifdef QF_URGENT_LANE
+    // an urgent event at the front gives back its entry in the urgent lane
+    if (m_uFront != static_cast<uint8_t>(0)) {
+        m_uQueue.m_nFree = m_uQueue.m_nFree + static_cast<QEQueueCtr>(1);
+        m_uFront = static_cast<uint8_t>(0); // the front entry is free again
+    }
+
+    // any urgent events? the oldest one goes to the front (borrowing it),
+    // but keeps its entry in the urgent lane
+    if (m_uQueue.m_frontEvt != static_cast<QEvt const *>(0)) {
+        m_eQueue.m_frontEvt = m_uQueue.m_frontEvt;
+        m_uFront = static_cast<uint8_t>(1);
+        --nFree; // the front entry is borrowed again
+
+        // any events in the ring buffer (besides the one moved out)?
+        if (m_uQueue.m_nFree < m_uQueue.m_end) {
+            m_uQueue.m_frontEvt = QF_PTR_AT_(m_uQueue.m_ring,
+                                             m_uQueue.m_tail);
+            if (m_uQueue.m_tail == static_cast<QEQueueCtr>(0)) { // wrap?
+                m_uQueue.m_tail = m_uQueue.m_end; // wrap around
+            }
+            --m_uQueue.m_tail;
+        }
+        else {
+            m_uQueue.m_frontEvt = static_cast<QEvt const *>(0);
+        }
+        m_eQueue.m_nFree = nFree; // upate the number of free
+
+        QS_BEGIN_NOCRIT_(QS_QF_ACTIVE_GET,
+                         QS::priv_.locFilter[QS::AO_OBJ], this)
+            QS_TIME_();                      // timestamp
+            QS_SIG_(e->sig);                 // the signal of this event
+            QS_OBJ_(this);                   // this active object
+            QS_2U8_(e->poolId_, e->refCtr_); // pool Id & refCtr of the evt
+            QS_EQC_(nFree);                  // number of free entries
+        QS_END_NOCRIT_()
+
+        return e;
+    }
+#endif // QF_URGENT_LANE
+
     m_eQueue.m_nFree = nFree; // upate the number of free
 
     // any events in the ring buffer?
@@ -305,6 +1035,12 @@ QEvt const *QActive::get_(void) {
 
         // remove event from the tail
         m_eQueue.m_frontEvt = QF_PTR_AT_(m_eQueue.m_ring, m_eQueue.m_tail);
+#if (QF_QUEUE_HIST_SIZE > 0)
+        qstatMove_(m_eQueue.m_tail, m_eQueue.m_end);
+#endif
+#if (QF_MAX_CONFLATE > 0)
+        cflMove_(m_eQueue.m_tail, QF_cflFront_);
+#endif
         if (m_eQueue.m_tail == static_cast<QEQueueCtr>(0)) { // need to wrap?
             m_eQueue.m_tail = m_eQueue.m_end; // wrap around
         }
@@ -323,10 +1059,6 @@ QEvt const *QActive::get_(void) {
         // the queue becomes empty
         m_eQueue.m_frontEvt = static_cast<QEvt const *>(0);
 
-        // all entries in the queue must be free (+1 for fronEvt)
-        Q_ASSERT_CRIT_(310, nFree ==
-                            (m_eQueue.m_end + static_cast<QEQueueCtr>(1)));
-
         QS_BEGIN_NOCRIT_(QS_QF_ACTIVE_GET_LAST,
                          QS::priv_.locFilter[QS::AO_OBJ], this)
             QS_TIME_();                      // timestamp
@@ -335,9 +1067,128 @@ QEvt const *QActive::get_(void) {
             QS_2U8_(e->poolId_, e->refCtr_); // pool Id & refCtr of the evt
         QS_END_NOCRIT_()
     }
+    return e;
+}
+
+//****************************************************************************
+/// @description
+/// The behavior of this function depends on the kernel used in the QF port.
+/// For built-in kernels (Vanilla or QK) the function can be called only when
+/// the queue is not empty, so it doesn't block. For a blocking kernel/OS
+/// the function can block and wait for delivery of an event.
+///
+/// @returns
+/// A pointer to the received event. The returned pointer is guaranteed to be
+/// valid (can't be NULL).
+///
+/// @note
+/// This function is used internally by a QF port to extract events from
+/// the event queue of an active object. This function depends on the event
+/// queue implementation and is sometimes customized in the QF port
+/// (file qf_port.h). Depending on the definition of the macro
+/// QACTIVE_EQUEUE_WAIT_(), the function might block the calling thread when
+/// no events are available.
+///
+QEvt const *QActive::get_(void) {
+    QF_CRIT_STAT_
+
+    QF_CRIT_OBJ_ENTRY_(&m_eQueue.m_crit);
+    QACTIVE_EQUEUE_WAIT_(this); // wait for event to arrive directly
+
+    QEvt const *e = getInCrit_(); // always remove evt from the front
+
+    // all entries in an empty queue must be free (+1 for fronEvt)
+    Q_ASSERT_CRIT_(310, (m_eQueue.m_frontEvt != static_cast<QEvt const *>(0))
+        || (m_eQueue.m_nFree
+            == (m_eQueue.m_end + static_cast<QEQueueCtr>(1))));
+    QF_CRIT_EXIT_();
+    return e;
+}
+
+//****************************************************************************
+/// @description
+/// Removes up to @p max events from the event queue of the active object
+/// in one critical section. Like QP::QActive::get_(), the function might
+/// block (QACTIVE_EQUEUE_WAIT_()) until at least one event is available.
+///
+/// @param[out] evts array for the pointers to the received events
+/// @param[in]  max  capacity of the array @p evts (must be at least 1)
+///
+/// @returns
+/// The number of events placed in @p evts (at least one), in the order in
+/// which QP::QActive::get_() would have returned them.
+///
+/// @note
+/// This function is used internally by a QF port to dispatch a burst of
+/// events per wakeup of the active object thread. An event posted with
+/// QP::QActive::postLIFO() while the batch is dispatched must be processed
+/// before the rest of the batch, which the QF port can detect with the
+/// macro QACTIVE_EQUEUE_LIFO_(). The same holds for the urgent events
+/// (macro QACTIVE_EQUEUE_URGENT_() and QP::QActive::getUrgent_()), so an
+/// urgent event is never batched together with the regular events.
+///
+uint_fast16_t QActive::getBatch_(QEvt const *evts[], uint_fast16_t const max)
+{
+    /// @pre the event array must be valid and hold at least one event
+    Q_REQUIRE_ID(600, (evts != static_cast<QEvt const **>(0))
+                      && (max > static_cast<uint_fast16_t>(0)));
+
+    QF_CRIT_STAT_
+    QF_CRIT_OBJ_ENTRY_(&m_eQueue.m_crit);
+    QACTIVE_EQUEUE_WAIT_(this); // wait for event to arrive directly
+
+    uint_fast16_t n = static_cast<uint_fast16_t>(0);
+#ifdef QF_URGENT_LANE
+    // an urgent event at the front makes a batch of its own
+    uint_fast16_t const lim = (m_uFront != static_cast<uint8_t>(0))
+                              ? static_cast<uint_fast16_t>(1)
+                              : max;
+#else
+    uint_fast16_t const lim = max;
+#endif
+    do {
+        evts[n] = getInCrit_(); // always remove evt from the front
+        ++n;
+#ifdef QF_URGENT_LANE
+        if (m_uFront != static_cast<uint8_t>(0)) { // urgent event next?
+            break; // the batch of regular events ends before it
+        }
+#endif
+    } while ((m_eQueue.m_frontEvt != static_cast<QEvt const *>(0))
+             && (n < lim));
+
+    // all entries in an empty queue must be free (+1 for fronEvt)
+    Q_ASSERT_CRIT_(610, (m_eQueue.m_frontEvt != static_cast<QEvt const *>(0))
+        || (m_eQueue.m_nFree
+            == (m_eQueue.m_end + static_cast<QEQueueCtr>(1))));
+    QF_CRIT_EXIT_();
+    return n;
+}
+
+#ifdef QF_URGENT_LANE
+//****************************************************************************
+/// @description
+/// Removes the urgent event from the front of the event queue of the
+/// active object, if there is one, but never blocks and never removes a
+/// regular event. The QF port uses it to dispatch the urgent events posted
+/// while a batch of regular events (QP::QActive::getBatch_()) is dispatched
+/// before the rest of the batch.
+///
+/// @returns
+/// A pointer to the removed urgent event or NULL if the event at the front
+/// of the queue (if any) is not urgent.
+///
+QEvt const *QActive::getUrgent_(void) {
+    QEvt const *e = static_cast<QEvt const *>(0);
+    QF_CRIT_STAT_
+    QF_CRIT_OBJ_ENTRY_(&m_eQueue.m_crit);
+    if (m_uFront != static_cast<uint8_t>(0)) { // urgent event at the front?
+        e = getInCrit_();
+    }
     QF_CRIT_EXIT_();
     return e;
 }
+#endif // QF_URGENT_LANE
 
 //****************************************************************************
 /// @description
@@ -357,13 +1208,13 @@ QEvt const *QActive::get_(void) {
 /// the minimum of free ever present in the given event queue of an active
 /// object with priority @p prio, since the active object was started.
 ///
-uint_fast16_t QF::getQueueMin(uint_fast8_t const prio) {
+uint_fast16_t QF::getQueueMin(QPrio const prio) {
 
-    Q_REQUIRE_ID(400, (prio <= static_cast<uint_fast8_t>(QF_MAX_ACTIVE))
+    Q_REQUIRE_ID(400, (prio <= static_cast<QPrio>(QF_MAX_ACTIVE))
                       && (active_[prio] != static_cast<QActive *>(0)));
 
     QF_CRIT_STAT_
-    QF_CRIT_ENTRY_();
+    QF_CRIT_OBJ_ENTRY_(&active_[prio]->m_eQueue.m_crit);
     uint_fast16_t min =
         static_cast<uint_fast16_t>(active_[prio]->m_eQueue.m_nMin);
     QF_CRIT_EXIT_();
@@ -371,6 +1222,83 @@ uint_fast16_t QF::getQueueMin(uint_fast8_t const prio) {
     return min;
 }
 
+#ifdef QF_URGENT_LANE
+//****************************************************************************
+/// @description
+/// Queries the minimum of free entries ever present in the urgent lane of
+/// the event queue of an active object with priority @p prio.
+///
+/// @param[in] prio  Priority of the active object, whose queue is queried
+///
+/// @returns
+/// the minimum of free entries ever present in the urgent lane.
+///
+/// @sa QP::QF::getQueueMin(), QP::QActive::postUrgent_()
+///
+uint_fast16_t QF::getUrgentQueueMin(QPrio const prio) {
+
+    Q_REQUIRE_ID(410, (prio <= static_cast<QPrio>(QF_MAX_ACTIVE))
+                      && (active_[prio] != static_cast<QActive *>(0)));
+
+    QF_CRIT_STAT_
+    QF_CRIT_OBJ_ENTRY_(&active_[prio]->m_eQueue.m_crit);
+    uint_fast16_t min =
+        static_cast<uint_fast16_t>(active_[prio]->m_uQueue.m_nMin);
+    QF_CRIT_EXIT_();
+
+    return min;
+}
+#endif // QF_URGENT_LANE
+
+#if (QF_QUEUE_HIST_SIZE > 0)
+//****************************************************************************
+/// @description
+/// Copies the queue residence-time and depth telemetry of the active object
+/// with priority @p prio and (optionally) starts the new measurement
+/// period. When the QS tracing is enabled, the function also produces the
+/// QS_QUEUE_STATS trace record with the same data, so the telemetry can be
+/// collected from the target by the QS host tools.
+///
+/// @param[in]  prio   Priority of the active object, whose queue is queried
+/// @param[out] stats  the telemetry of the active object
+/// @param[in]  reset  clear the telemetry after copying it
+///
+/// @sa QP::QActive::initQueueStats(), QP::QF::getQueueMin()
+///
+void QF::getQueueStats(QPrio const prio,
+                       QFQueueStats * const stats, bool const reset)
+{
+    Q_REQUIRE_ID(420, (prio <= static_cast<QPrio>(QF_MAX_ACTIVE))
+                      && (active_[prio] != static_cast<QActive *>(0))
+                      && (stats != static_cast<QFQueueStats *>(0)));
+
+    QActive * const act = active_[prio];
+    QF_CRIT_STAT_
+    QF_CRIT_OBJ_ENTRY_(&act->m_eQueue.m_crit);
+    *stats = act->m_qStats;
+    if (reset) {
+        QF::bzero(&act->m_qStats,
+                  static_cast<uint_fast16_t>(sizeof(act->m_qStats)));
+    }
+
+    QS_BEGIN_NOCRIT_(QS_QUEUE_STATS, QS::priv_.locFilter[QS::AO_OBJ], act)
+        QS_TIME_();                 // timestamp
+        QS_OBJ_(act);               // the active object
+        QS_U32_(stats->nEvts);      // number of the events with the time
+        QS_U32_(stats->maxTime);    // the longest residence time
+        QS_U8_(static_cast<uint8_t>(QF_QUEUE_HIST_SIZE)); // number of classes
+        for (uint_fast8_t i = static_cast<uint_fast8_t>(0);
+             i < static_cast<uint_fast8_t>(QF_QUEUE_HIST_SIZE); ++i)
+        {
+            QS_U32_(stats->timeHist[i]);  // residence-time class i
+            QS_U32_(stats->depthHist[i]); // depth class i
+        }
+    QS_END_NOCRIT_()
+
+    QF_CRIT_EXIT_();
+}
+#endif // (QF_QUEUE_HIST_SIZE > 0)
+
 //****************************************************************************
 QTicker::QTicker(uint_fast8_t const tickRate)
   : QActive(Q_STATE_CAST(0))
@@ -385,7 +1313,7 @@ void QTicker::init(QEvt const * const /*e*/) {
 //............................................................................
 void QTicker::dispatch(QEvt const * const /*e*/) {
     QF_CRIT_STAT_
-    QF_CRIT_ENTRY_();
+    QF_CRIT_OBJ_ENTRY_(&m_eQueue.m_crit);
     QEQueueCtr n = m_eQueue.m_tail; // # ticks since the last call
     m_eQueue.m_tail = static_cast<QEQueueCtr>(0); // clear the # ticks
     QF_CRIT_EXIT_();
@@ -403,7 +1331,7 @@ bool QTicker::post_(QEvt const * const /*e*/, uint_fast16_t const /*margin*/,
 #endif
 {
     QF_CRIT_STAT_
-    QF_CRIT_ENTRY_();
+    QF_CRIT_OBJ_ENTRY_(&m_eQueue.m_crit);
     if (m_eQueue.m_frontEvt == static_cast<QEvt const *>(0)) {
 
 #ifdef Q_EVT_CTOR
@@ -437,6 +1365,8 @@ bool QTicker::post_(QEvt const * const /*e*/, uint_fast16_t const /*margin*/,
 
     QF_CRIT_EXIT_();
 
+    QACTIVE_EQUEUE_WAKE_(this); // complete signaling the event queue
+
     return true; // the event is always posted correctly
 }
 
@@ -447,3 +1377,4 @@ void QTicker::postLIFO(QEvt const * const /*e*/) {
 
 } // namespace QP
 
+#endif // QACTIVE_EQUEUE_PORT_
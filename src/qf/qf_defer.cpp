@@ -117,6 +117,29 @@ bool QActive::recall(QEQueue * const eq) {
     if (e != static_cast<QEvt const *>(0)) {
         this->postLIFO(e); // post it to the _front_ of the AO's queue
 
+#ifdef QF_REF_CTR_ATOMIC
+        QEvtRefCtr ctr = static_cast<QEvtRefCtr>(0);
+
+        // is it a dynamic event?
+        if (e->poolId_ != static_cast<uint8_t>(0)) {
+            // decrement the reference counter once, to account for removing
+            // the event from the deferred event queue (see below)
+            ctr = QF_EVT_REF_CTR_DEC_(e);
+
+            // the AO's event queue still references the event
+            Q_ASSERT_ID(210, ctr >= static_cast<QEvtRefCtr>(1));
+        }
+
+        QS_CRIT_STAT_
+        QS_BEGIN_(QS_QF_ACTIVE_RECALL,
+                  QS::priv_.locFilter[QS::AO_OBJ], this)
+            QS_TIME_();      // time stamp
+            QS_OBJ_(this);   // this active object
+            QS_OBJ_(eq);     // the deferred queue
+            QS_SIG_(e->sig); // the signal of the event
+            QS_2U8_(e->poolId_, ctr); // pool Id & ref Count
+        QS_END_()
+#else
         QF_CRIT_STAT_
         QF_CRIT_ENTRY_();
 
@@ -127,11 +150,11 @@ bool QActive::recall(QEQueue * const eq) {
             // at least twice: once in the deferred event queue (eq->get()
             // did NOT decrement the reference counter) and once in the
             // AO's event queue.
-            Q_ASSERT_CRIT_(210, e->refCtr_ >= static_cast<uint8_t>(2));
+            Q_ASSERT_CRIT_(210, e->refCtr_ >= static_cast<QEvtRefCtr>(2));
 
             // we need to decrement the reference counter once, to account
             // for removing the event from the deferred event queue.
-            QF_EVT_REF_CTR_DEC_(e); // decrement the reference counter
+            (void)QF_EVT_REF_CTR_DEC_(e); // decrement the reference counter
         }
 
         QS_BEGIN_NOCRIT_(QS_QF_ACTIVE_RECALL,
@@ -144,6 +167,7 @@ bool QActive::recall(QEQueue * const eq) {
         QS_END_NOCRIT_()
 
         QF_CRIT_EXIT_();
+#endif // QF_REF_CTR_ATOMIC
         recalled = true;
     }
     else {
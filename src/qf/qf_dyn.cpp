@@ -53,6 +53,40 @@ Q_DEFINE_THIS_MODULE("qf_dyn")
 QF_EPOOL_TYPE_ QF_pool_[QF_MAX_EPOOL]; // allocate the event pools
 uint_fast8_t QF_maxPool_;              // number of initialized event pools
 
+#if (QF_EPOOL_LUT_SIZE > 0)
+// the lookup table from the event size to the event pool ID (0 for no pool),
+// the entry i is the first pool for the events of (i*sizeof(void*) + 1) bytes
+uint8_t QF_poolLut_[QF_EPOOL_LUT_SIZE];
+#endif
+
+#if (QF_MAX_BPOOL > 0)
+static QF_EPOOL_TYPE_ l_bufPool[QF_MAX_BPOOL]; // the payload buffer pools
+static uint_fast8_t l_maxBufPool;  // number of initialized buffer pools
+#endif
+
+#if (QF_ALLOC_HIST_SIZE > 0)
+static QFAllocStats l_poolStats[QF_MAX_EPOOL]; // statistics of event pools
+#if (QF_ALLOC_STAT_SIGS > 0)
+// the statistics of the signals, the last entry for all other signals
+static QFAllocStats l_sigStats[QF_ALLOC_STAT_SIGS + 1];
+#endif
+#endif // (QF_ALLOC_HIST_SIZE > 0)
+
+// Local functions ***********************************************************
+static uint_fast8_t findPool(uint_fast16_t const evtSize);
+static bool dropRef(QEvt const * const e);
+static uint32_t dropRefs(QEvt const * const evts[], uint_fast16_t const n);
+static uint_fast8_t retire(QEvt const * const e);
+static void recycle(QEvt const * const e);
+static void putChain(uint_fast8_t const idx,
+                     QFreeBlock * const chain, uint_fast16_t const n);
+#if (QF_ALLOC_HIST_SIZE > 0)
+static void statAlloc(uint_fast8_t const idx, uint_fast16_t const evtSize,
+                      enum_t const sig, uint_fast16_t const n);
+static void statFail(uint_fast8_t const idx, enum_t const sig);
+static void statFree(uint_fast8_t const idx, enum_t const sig);
+#endif // (QF_ALLOC_HIST_SIZE > 0)
+
 //****************************************************************************
 /// @description
 /// This function initializes one event pool at a time and must be called
@@ -86,6 +120,14 @@ void QF::poolInit(void * const poolSto,
     /// @pre cannot exceed the number of available memory pools
     Q_REQUIRE_ID(200, QF_maxPool_
                       < static_cast<uint_fast8_t>(Q_DIM(QF_pool_)));
+    /// @pre the event pools must differ in the block size rounded up to
+    /// the pointer size or to #QF_MPOOL_ALIGN, e.g., with QF_MPOOL_ALIGN 64
+    /// the pools for events of 24 and 40 bytes would both have 64-byte
+    /// blocks, so use a single pool for such events instead
+    Q_REQUIRE_ID(202, (QF_maxPool_ == static_cast<uint_fast8_t>(0))
+        || (QF_EPOOL_EVENT_SIZE_(
+               QF_pool_[QF_maxPool_ - static_cast<uint_fast8_t>(1)])
+            != QF_poolStride_(evtSize)));
     /// @pre please initialize event pools in ascending order of evtSize
     Q_REQUIRE_ID(201, (QF_maxPool_ == static_cast<uint_fast8_t>(0))
         || (QF_EPOOL_EVENT_SIZE_(
@@ -93,7 +135,28 @@ void QF::poolInit(void * const poolSto,
             < evtSize));
 
     QF_EPOOL_INIT_(QF_pool_[QF_maxPool_], poolSto, poolSize, evtSize);
+#if (QF_ALLOC_HIST_SIZE > 0)
+    bzero(&l_poolStats[QF_maxPool_],
+          static_cast<uint_fast16_t>(sizeof(l_poolStats[0])));
+#endif
     ++QF_maxPool_; // one more pool
+
+#if (QF_EPOOL_LUT_SIZE > 0)
+    // the new pool is the first pool for the event sizes not covered by
+    // the previous (smaller) pools, but covered by this pool
+    uint_fast32_t const blockSize = static_cast<uint_fast32_t>(
+        QF_EPOOL_EVENT_SIZE_(
+            QF_pool_[QF_maxPool_ - static_cast<uint_fast8_t>(1)]));
+    for (uint_fast16_t i = static_cast<uint_fast16_t>(0);
+         (i < static_cast<uint_fast16_t>(QF_EPOOL_LUT_SIZE))
+         && ((static_cast<uint_fast32_t>(i) * sizeof(void *)) < blockSize);
+         ++i)
+    {
+        if (QF_poolLut_[i] == static_cast<uint8_t>(0)) {
+            QF_poolLut_[i] = static_cast<uint8_t>(QF_maxPool_);
+        }
+    }
+#endif // QF_EPOOL_LUT_SIZE
 }
 
 //****************************************************************************
@@ -125,17 +188,45 @@ void QF::poolInit(void * const poolSto,
 QEvt *QF::newX_(uint_fast16_t const evtSize,
                 uint_fast16_t const margin, enum_t const sig)
 {
-    uint_fast8_t idx;
+    uint_fast8_t const idx = findPool(evtSize);
 
-    // find the pool id that fits the requested event size ...
-    for (idx = static_cast<uint_fast8_t>(0); idx < QF_maxPool_; ++idx) {
-        if (evtSize <= QF_EPOOL_EVENT_SIZE_(QF_pool_[idx])) {
-            break;
-        }
-    }
     // cannot run out of registered pools
     Q_ASSERT_ID(310, idx < QF_maxPool_);
 
+    return newFromPool_(static_cast<uint_fast8_t>(
+                            idx + static_cast<uint_fast8_t>(1)),
+                        evtSize, margin, sig);
+}
+
+//****************************************************************************
+/// @description
+/// Allocates an event dynamically from the given QF event pool, without
+/// searching for the pool by the event size.
+///
+/// @param[in] poolId  the event pool ID (1-based order of QF::poolInit())
+/// @param[in] evtSize the size (in bytes) of the event to allocate
+/// @param[in] margin  the number of un-allocated events still available
+///                    in a given event pool after the allocation completes
+/// @param[in] sig     the signal to be assigned to the allocated event
+///
+/// @returns
+/// pointer to the newly allocated event, see QP::QF::newX_().
+///
+/// @note
+/// The application code should not call this function directly.
+/// The only allowed use is thorough the macros Q_NEW() or Q_NEW_X() for
+/// the event types bound to an event pool with the macro Q_EVT_POOL().
+///
+QEvt *QF::newFromPool_(uint_fast8_t const poolId,
+                       uint_fast16_t const evtSize,
+                       uint_fast16_t const margin, enum_t const sig)
+{
+    /// @pre the pool must be initialized and large enough for the event
+    Q_REQUIRE_ID(330, (static_cast<uint_fast8_t>(1) <= poolId)
+        && (poolId <= QF_maxPool_)
+        && (evtSize <= QF_EPOOL_EVENT_SIZE_(
+                           QF_pool_[poolId - static_cast<uint_fast8_t>(1)])));
+
     QS_CRIT_STAT_
     QS_BEGIN_(QS_QF_NEW, static_cast<void *>(0), static_cast<void *>(0))
         QS_TIME_();                              // timestamp
@@ -143,6 +234,8 @@ QEvt *QF::newX_(uint_fast16_t const evtSize,
         QS_SIG_(static_cast<QSignal>(sig));      // the signal of the event
     QS_END_()
 
+    uint_fast8_t const idx = poolId - static_cast<uint_fast8_t>(1);
+
     // get e -- platform-dependent
     QEvt *e;
     QF_EPOOL_GET_(QF_pool_[idx], e,
@@ -153,13 +246,17 @@ QEvt *QF::newX_(uint_fast16_t const evtSize,
     // was e allocated correctly?
     if (e != static_cast<QEvt const *>(0)) {
         e->sig     = static_cast<QSignal>(sig); // set the signal
-        // store pool ID
-        e->poolId_ = static_cast<uint8_t>(
-                       idx + static_cast<uint_fast8_t>(1));
+        e->poolId_ = static_cast<uint8_t>(poolId); // store pool ID
         // initialize the reference counter to 0
-        e->refCtr_ = static_cast<uint8_t>(0);
+        e->refCtr_ = static_cast<QEvtRefCtr>(0);
+#if (QF_ALLOC_HIST_SIZE > 0)
+        statAlloc(idx, evtSize, sig, static_cast<uint_fast16_t>(1));
+#endif
     }
     else {
+#if (QF_ALLOC_HIST_SIZE > 0)
+        statFail(idx, sig);
+#endif
         // must tolerate bad alloc.
         Q_ASSERT_ID(320, margin != static_cast<uint_fast16_t>(QF_NO_MARGIN));
     }
@@ -192,50 +289,459 @@ QEvt *QF::newX_(uint_fast16_t const evtSize,
 void QF::gc(QEvt const * const e) {
     // is it a dynamic event?
     if (e->poolId_ != static_cast<uint8_t>(0)) {
-        QF_CRIT_STAT_
-        QF_CRIT_ENTRY_();
+        if (dropRef(e)) { // was it the last reference?
+            recycle(e);
+        }
+    }
+}
+
+//****************************************************************************
+/// @description
+/// Allocates a batch of @p n dynamic events of the same size from one
+/// event pool, all or none. When the QF port provides the batch operations
+/// on its event pools (QF_EPOOL_GET_N_()), the blocks are taken from
+/// the pool as a chain in a single critical section and the pool produces
+/// a single trace record for the whole batch. The QS_QF_NEW records of the
+/// events are produced in a single QS critical section too.
+///
+/// @param[out] evts    the array for the @p n allocated events
+/// @param[in]  n       the number of events to allocate
+/// @param[in]  poolId  the event pool ID (1-based order of QF::poolInit()),
+///                     or 0 to select the pool by the event size
+/// @param[in]  evtSize the size (in bytes) of every event in the batch
+/// @param[in]  margin  the number of un-allocated events still available
+///                     in the given event pool after the allocation.
+///                     The special value QP::QF_NO_MARGIN means that this
+///                     function will assert if allocation fails.
+/// @param[in]  sig     the signal to be assigned to the allocated events
+///
+/// @returns
+/// true if all @p n events have been allocated. The return can be false
+/// only if margin!=QP::QF_NO_MARGIN and the batch cannot be allocated with
+/// the specified margin still available in the given pool, in which case
+/// no event has been allocated.
+///
+/// @note
+/// The application code should not call this function directly.
+/// The only allowed use is thorough the macros Q_NEW_BATCH() or
+/// Q_NEW_BATCH_X().
+///
+bool QF::newBatch_(QEvt *evts[], uint_fast16_t const n,
+                   uint_fast8_t poolId, uint_fast16_t const evtSize,
+                   uint_fast16_t const margin, enum_t const sig)
+{
+    if (poolId == static_cast<uint_fast8_t>(0)) { // select pool by size?
+        poolId = static_cast<uint_fast8_t>(
+            findPool(evtSize) + static_cast<uint_fast8_t>(1));
+    }
+
+    /// @pre at least one event must be requested, and the pool must be
+    /// initialized and large enough for the events
+    Q_REQUIRE_ID(700, (n != static_cast<uint_fast16_t>(0))
+        && (static_cast<uint_fast8_t>(1) <= poolId)
+        && (poolId <= QF_maxPool_)
+        && (evtSize <= QF_EPOOL_EVENT_SIZE_(
+                           QF_pool_[poolId - static_cast<uint_fast8_t>(1)])));
+
+    uint_fast8_t const idx = poolId - static_cast<uint_fast8_t>(1);
+    uint_fast16_t const m = (margin != QF_NO_MARGIN)
+                            ? margin
+                            : static_cast<uint_fast16_t>(0);
+    uint_fast16_t i;
+
+#ifdef QF_EPOOL_GET_N_
+    // get the chain of n blocks -- platform-dependent
+    void *chain;
+    QF_EPOOL_GET_N_(QF_pool_[idx], chain, n, m);
+
+    // split the chain into the events
+    QFreeBlock *fb = static_cast<QFreeBlock *>(chain);
+    for (i = static_cast<uint_fast16_t>(0);
+         fb != static_cast<QFreeBlock *>(0);
+         ++i)
+    {
+        QFreeBlock * const next = fb->m_next;
+        evts[i] = static_cast<QEvt *>(static_cast<void *>(fb));
+        fb = next;
+    }
+#else
+    // get the events one by one (no batch operations in this QF port)
+    for (i = static_cast<uint_fast16_t>(0); i < n; ++i) {
+        QF_EPOOL_GET_(QF_pool_[idx], evts[i], m);
+        if (evts[i] == static_cast<QEvt *>(0)) {
+            break;
+        }
+    }
+    if (i < n) { // not all events allocated? return the allocated ones
+        while (i > static_cast<uint_fast16_t>(0)) {
+            --i;
+            QF_EPOOL_PUT_(QF_pool_[idx], evts[i]);
+        }
+    }
+#endif // QF_EPOOL_GET_N_
+
+    bool const ok = (i == n);
+    if (ok) {
+        for (i = static_cast<uint_fast16_t>(0); i < n; ++i) {
+            QEvt * const e = evts[i];
+            e->sig     = static_cast<QSignal>(sig); // set the signal
+            e->poolId_ = static_cast<uint8_t>(poolId); // store pool ID
+            // initialize the reference counter to 0
+            e->refCtr_ = static_cast<QEvtRefCtr>(0);
+        }
+
+#ifdef Q_SPY
+        // trace the whole batch in a single QS critical section
+        if (QS_GLB_FILTER_(QS_QF_NEW)) {
+            QS_CRIT_STAT_
+            QS_CRIT_ENTRY_();
+            for (i = static_cast<uint_fast16_t>(0); i < n; ++i) {
+                QS_BEGIN_NOCRIT_(QS_QF_NEW,
+                          static_cast<void *>(0), static_cast<void *>(0))
+                    QS_TIME_();                          // timestamp
+                    QS_EVS_(static_cast<QEvtSize>(evtSize)); // size of evt
+                    QS_SIG_(static_cast<QSignal>(sig));  // the signal of evt
+                QS_END_NOCRIT_()
+            }
+            QS_CRIT_EXIT_();
+        }
+#endif // Q_SPY
+#if (QF_ALLOC_HIST_SIZE > 0)
+        statAlloc(idx, evtSize, sig, n);
+#endif
+    }
+    else {
+#if (QF_ALLOC_HIST_SIZE > 0)
+        statFail(idx, sig);
+#endif
+        // must tolerate bad alloc.
+        Q_ASSERT_ID(720, margin != static_cast<uint_fast16_t>(QF_NO_MARGIN));
+    }
+    return ok;
+}
+
+//****************************************************************************
+/// @description
+/// Drops one reference to each of the @p n events, like QP::QF::gc(), and
+/// returns the events without any references to their event pools. The
+/// consecutive recycled events from the same pool are returned as a chain,
+/// which takes a single critical section and produces a single trace record
+/// of the pool, when the QF port provides the batch operations on its event
+/// pools (QF_EPOOL_PUT_N_()).
+///
+/// The references of up to 32 events are dropped (and traced) in a single
+/// critical section, instead of one critical section for every event.
+///
+/// @param[in] evts  the array of the events to recycle (static events are
+///                  ignored, as in QP::QF::gc())
+/// @param[in] n     the number of the events in the array
+///
+void QF::gcBatch(QEvt const * const evts[], uint_fast16_t const n) {
+    QFreeBlock *chain = static_cast<QFreeBlock *>(0);
+    uint_fast16_t nChain = static_cast<uint_fast16_t>(0);
+    uint_fast8_t chainIdx = static_cast<uint_fast8_t>(0);
+    uint32_t last = static_cast<uint32_t>(0);
+
+    for (uint_fast16_t i = static_cast<uint_fast16_t>(0); i < n; ++i) {
+        QEvt const * const e = evts[i];
+        uint_fast8_t const bit = static_cast<uint_fast8_t>(i & 31U);
+
+        // drop the references of the next (up to) 32 events at once
+        if (bit == static_cast<uint_fast8_t>(0)) {
+            last = dropRefs(&evts[i], ((n - i) < 32U)
+                                      ? (n - i)
+                                      : static_cast<uint_fast16_t>(32));
+        }
+
+        // a dynamic event losing its last reference?
+        if ((last & (static_cast<uint32_t>(1) << bit))
+            != static_cast<uint32_t>(0))
+        {
+            uint_fast8_t const idx = retire(e);
+
+            // return the chain of a different pool first
+            if ((nChain != static_cast<uint_fast16_t>(0))
+                && (idx != chainIdx))
+            {
+                putChain(chainIdx, chain, nChain);
+                chain = static_cast<QFreeBlock *>(0);
+                nChain = static_cast<uint_fast16_t>(0);
+            }
+
+            // cast 'const' away, which is OK, because it's a pool event
+            QFreeBlock * const fb = static_cast<QFreeBlock *>(
+                static_cast<void *>(QF_EVT_CONST_CAST_(e)));
+            fb->m_next = chain;
+            chain = fb;
+            ++nChain;
+            chainIdx = idx;
+        }
+    }
+    if (nChain != static_cast<uint_fast16_t>(0)) {
+        putChain(chainIdx, chain, nChain);
+    }
+}
+
+//****************************************************************************
+// find the index of the first event pool that fits @p evtSize bytes,
+// returns QF_maxPool_ if no pool is large enough
+static uint_fast8_t findPool(uint_fast16_t const evtSize) {
+    uint_fast8_t idx;
+
+#if (QF_EPOOL_LUT_SIZE > 0)
+    // look up the first pool that can fit the requested event size, the
+    // events above the range of the lookup table start at its last entry
+    uint_fast16_t const i = static_cast<uint_fast16_t>(
+        static_cast<uint_fast16_t>(evtSize - static_cast<uint_fast16_t>(1))
+        / static_cast<uint_fast16_t>(sizeof(void *)));
+    idx = static_cast<uint_fast8_t>(
+        QF_poolLut_[(i < static_cast<uint_fast16_t>(QF_EPOOL_LUT_SIZE))
+                  ? i
+                  : static_cast<uint_fast16_t>(QF_EPOOL_LUT_SIZE - 1)]);
+    if (idx == static_cast<uint_fast8_t>(0)) { // no pool in the table?
+        idx = QF_maxPool_;
+    }
+    else {
+        --idx; // pool ID to the pool index
+    }
+
+    // skip the pools smaller than the event (only above the table or for
+    // the block sizes not aligned to sizeof(void*))
+    while ((idx < QF_maxPool_)
+           && (evtSize > QF_EPOOL_EVENT_SIZE_(QF_pool_[idx])))
+    {
+        ++idx;
+    }
+#else
+    // find the pool id that fits the requested event size ...
+    for (idx = static_cast<uint_fast8_t>(0); idx < QF_maxPool_; ++idx) {
+        if (evtSize <= QF_EPOOL_EVENT_SIZE_(QF_pool_[idx])) {
+            break;
+        }
+    }
+#endif // QF_EPOOL_LUT_SIZE
 
-        // isn't this the last reference?
-        if (e->refCtr_ > static_cast<uint8_t>(1)) {
+    return idx;
+}
+
+//****************************************************************************
+// drop one reference to the dynamic event @p e, returns true if it was
+// the last reference (so the event must be recycled)
+static bool dropRef(QEvt const * const e) {
+    bool last;
+#ifdef QF_REF_CTR_ATOMIC
+    // drop this reference atomically, outside of any critical section.
+    // NOTE: the counter of an event that has never been posted is zero
+    // and wraps around, which also means that no other reference exists.
+    QEvtRefCtr const ctr = QF_EVT_REF_CTR_DEC_(e);
+    QS_CRIT_STAT_
 
+    // isn't this the last reference?
+    last = (ctr == static_cast<QEvtRefCtr>(0))
+           || (ctr == static_cast<QEvtRefCtr>(~static_cast<QEvtRefCtr>(0)));
+    if (!last) {
+        QS_BEGIN_(QS_QF_GC_ATTEMPT,
+                  static_cast<void *>(0), static_cast<void *>(0))
+            QS_TIME_();        // timestamp
+            QS_SIG_(e->sig);   // the signal of the event
+            QS_2U8_(QF_EVT_POOL_ID_(e), ctr + 1U);// pool Id & refCtr of evt
+        QS_END_()
+    }
+    // this is the last reference to this event
+    else {
+        QS_BEGIN_(QS_QF_GC,
+                  static_cast<void *>(0), static_cast<void *>(0))
+            QS_TIME_();        // timestamp
+            QS_SIG_(e->sig);   // the signal of the event
+            QS_2U8_(QF_EVT_POOL_ID_(e), ctr + 1U);// pool Id & refCtr of evt
+        QS_END_()
+    }
+#else
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
+
+    // isn't this the last reference?
+    // NOTE: with the individually locked event queues (#QF_CRIT_OBJ_TYPE)
+    // the reference counter can be incremented concurrently, but it is
+    // decremented only inside the QF critical section, so it cannot
+    // drop between the following test and the decrement.
+    last = (QF_EVT_REF_CTR_(e) <= static_cast<QEvtRefCtr>(1));
+    if (!last) {
+        QS_BEGIN_NOCRIT_(QS_QF_GC_ATTEMPT,
+                         static_cast<void *>(0), static_cast<void *>(0))
+            QS_TIME_();        // timestamp
+            QS_SIG_(e->sig);   // the signal of the event
+            // pool Id & refCtr of the evt
+            QS_2U8_(QF_EVT_POOL_ID_(e), QF_EVT_REF_CTR_(e));
+        QS_END_NOCRIT_()
+
+        (void)QF_EVT_REF_CTR_DEC_(e); // decrement the ref counter
+    }
+    // this is the last reference to this event
+    else {
+        QS_BEGIN_NOCRIT_(QS_QF_GC,
+                         static_cast<void *>(0), static_cast<void *>(0))
+            QS_TIME_();        // timestamp
+            QS_SIG_(e->sig);   // the signal of the event
+            // pool Id & refCtr of the evt
+            QS_2U8_(QF_EVT_POOL_ID_(e), QF_EVT_REF_CTR_(e));
+        QS_END_NOCRIT_()
+    }
+    QF_CRIT_EXIT_();
+#endif // QF_REF_CTR_ATOMIC
+
+    return last;
+}
+
+//****************************************************************************
+// drop one reference to each of the @p n (at most 32) events @p evts[],
+// returns the bitmask of the dynamic events losing their last reference
+// (bit i for evts[i]). The references are dropped in a single critical
+// section (or atomically) and traced in a single QS critical section.
+static uint32_t dropRefs(QEvt const * const evts[], uint_fast16_t const n) {
+    uint32_t last = static_cast<uint32_t>(0);
+    uint_fast16_t i;
+#ifdef QF_REF_CTR_ATOMIC
+    QEvtRefCtr ctr[32]; // the counters after the drop, for the trace
+    for (i = static_cast<uint_fast16_t>(0); i < n; ++i) {
+        if (evts[i]->poolId_ != static_cast<uint8_t>(0)) {
+            ctr[i] = QF_EVT_REF_CTR_DEC_(evts[i]);
+            // the counter wraps for an event that has never been posted
+            if ((ctr[i] == static_cast<QEvtRefCtr>(0))
+                || (ctr[i] == static_cast<QEvtRefCtr>(
+                                  ~static_cast<QEvtRefCtr>(0))))
+            {
+                last |= (static_cast<uint32_t>(1) << i);
+            }
+        }
+    }
+
+#ifdef Q_SPY
+    QS_CRIT_STAT_
+    QS_CRIT_ENTRY_();
+    for (i = static_cast<uint_fast16_t>(0); i < n; ++i) {
+        QEvt const * const e = evts[i];
+        if (e->poolId_ == static_cast<uint8_t>(0)) {
+            // static event, not traced
+        }
+        else if ((last & (static_cast<uint32_t>(1) << i))
+                 == static_cast<uint32_t>(0))
+        {
             QS_BEGIN_NOCRIT_(QS_QF_GC_ATTEMPT,
                              static_cast<void *>(0), static_cast<void *>(0))
                 QS_TIME_();        // timestamp
                 QS_SIG_(e->sig);   // the signal of the event
-                QS_2U8_(e->poolId_, e->refCtr_);// pool Id & refCtr of the evt
+                QS_2U8_(QF_EVT_POOL_ID_(e), ctr[i] + 1U); // pool Id & refCtr
             QS_END_NOCRIT_()
-
-            QF_EVT_REF_CTR_DEC_(e); // decrement the ref counter
-
-            QF_CRIT_EXIT_();
         }
-        // this is the last reference to this event, recycle it
         else {
-            uint_fast8_t idx = static_cast<uint_fast8_t>(e->poolId_)
-                               - static_cast<uint_fast8_t>(1);
+            QS_BEGIN_NOCRIT_(QS_QF_GC,
+                             static_cast<void *>(0), static_cast<void *>(0))
+                QS_TIME_();        // timestamp
+                QS_SIG_(e->sig);   // the signal of the event
+                QS_2U8_(QF_EVT_POOL_ID_(e), ctr[i] + 1U); // pool Id & refCtr
+            QS_END_NOCRIT_()
+        }
+    }
+    QS_CRIT_EXIT_();
+#endif // Q_SPY
+#else
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
+    for (i = static_cast<uint_fast16_t>(0); i < n; ++i) {
+        QEvt const * const e = evts[i];
+        if (e->poolId_ == static_cast<uint8_t>(0)) {
+            // static event, ignored
+        }
+        // not the last reference? (see the NOTE in dropRef())
+        else if (QF_EVT_REF_CTR_(e) > static_cast<QEvtRefCtr>(1)) {
+            QS_BEGIN_NOCRIT_(QS_QF_GC_ATTEMPT,
+                             static_cast<void *>(0), static_cast<void *>(0))
+                QS_TIME_();        // timestamp
+                QS_SIG_(e->sig);   // the signal of the event
+                // pool Id & refCtr of the evt
+                QS_2U8_(QF_EVT_POOL_ID_(e), QF_EVT_REF_CTR_(e));
+            QS_END_NOCRIT_()
 
+            (void)QF_EVT_REF_CTR_DEC_(e); // decrement the ref counter
+        }
+        else { // this is the last reference to this event
             QS_BEGIN_NOCRIT_(QS_QF_GC,
                              static_cast<void *>(0), static_cast<void *>(0))
                 QS_TIME_();        // timestamp
                 QS_SIG_(e->sig);   // the signal of the event
-                QS_2U8_(e->poolId_, e->refCtr_);// pool Id & refCtr of the evt
+                // pool Id & refCtr of the evt
+                QS_2U8_(QF_EVT_POOL_ID_(e), QF_EVT_REF_CTR_(e));
             QS_END_NOCRIT_()
 
-            QF_CRIT_EXIT_();
+            last |= (static_cast<uint32_t>(1) << i);
+        }
+    }
+    QF_CRIT_EXIT_();
+#endif // QF_REF_CTR_ATOMIC
+
+    return last;
+}
+
+//****************************************************************************
+// release everything attached to the dynamic event @p e without any
+// references, returns the index of its event pool
+static uint_fast8_t retire(QEvt const * const e) {
+    uint8_t poolId = QF_EVT_POOL_ID_(e);
+
+#if (QF_MAX_BPOOL > 0)
+    // release the payload buffer attached to the event (if any)
+    if ((poolId & QF_EVT_BUF_) != static_cast<uint8_t>(0)) {
+        poolId &= static_cast<uint8_t>(~QF_EVT_BUF_);
+        QF::bufRelease(static_cast<QBufEvt const *>(e)->buf);
+    }
+#endif // (QF_MAX_BPOOL > 0)
+
+    uint_fast8_t idx = static_cast<uint_fast8_t>(poolId)
+                       - static_cast<uint_fast8_t>(1);
 
-            // pool ID must be in range
-            Q_ASSERT_ID(410, idx < QF_maxPool_);
+    // pool ID must be in range
+    Q_ASSERT_ID(410, idx < QF_maxPool_);
+
+#if (QF_ALLOC_HIST_SIZE > 0)
+    statFree(idx, static_cast<enum_t>(e->sig));
+#endif
 
 #ifdef Q_EVT_VIRTUAL
-            // explicitly exectute the destructor'
-            // NOTE: casting 'const' away is legitimate,
-            // because it's a pool event
-            QF_EVT_CONST_CAST_(e)->~QEvt(); // xtor,
+    // explicitly exectute the destructor'
+    // NOTE: casting 'const' away is legitimate,
+    // because it's a pool event
+    QF_EVT_CONST_CAST_(e)->~QEvt(); // xtor,
 #endif
-            // cast 'const' away, which is OK, because it's a pool event
-            QF_EPOOL_PUT_(QF_pool_[idx], QF_EVT_CONST_CAST_(e));
-        }
+    return idx;
+}
+
+//****************************************************************************
+// return the dynamic event @p e without any references to its event pool
+static void recycle(QEvt const * const e) {
+    uint_fast8_t const idx = retire(e);
+
+    // cast 'const' away, which is OK, because it's a pool event
+    QF_EPOOL_PUT_(QF_pool_[idx], QF_EVT_CONST_CAST_(e));
+}
+
+//****************************************************************************
+// return the @p chain of @p n retired events to the event pool @p idx
+static void putChain(uint_fast8_t const idx,
+                     QFreeBlock * const chain, uint_fast16_t const n)
+{
+#ifdef QF_EPOOL_PUT_N_
+    QF_EPOOL_PUT_N_(QF_pool_[idx], chain, n);
+#else
+    // put the blocks one by one (no batch operations in this QF port)
+    (void)n;
+    QFreeBlock *fb = chain;
+    while (fb != static_cast<QFreeBlock *>(0)) {
+        QFreeBlock * const next = fb->m_next;
+        QF_EPOOL_PUT_(QF_pool_[idx], fb);
+        fb = next;
     }
+#endif // QF_EPOOL_PUT_N_
 }
 
 //****************************************************************************
@@ -259,10 +765,23 @@ QEvt const *QF::newRef_(QEvt const * const e, QEvt const * const evtRef) {
         (e->poolId_ != static_cast<uint8_t>(0))
         && (evtRef == static_cast<QEvt const *>(0)));
 
+#ifdef QF_REF_CTR_ATOMIC
+    QEvtRefCtr const ctr = QF_EVT_REF_CTR_INC_(e); // increments the ref ctr
+    QS_CRIT_STAT_
+
+    QS_BEGIN_(QS_QF_NEW_REF, static_cast<void *>(0), static_cast<void *>(0))
+        QS_TIME_();      // timestamp
+        QS_SIG_(e->sig); // the signal of the event
+        QS_2U8_(e->poolId_, ctr); // pool Id & ref Count
+    QS_END_()
+
+    // the reference counter must not wrap around
+    Q_ASSERT_ID(510, ctr != static_cast<QEvtRefCtr>(0));
+#else
     QF_CRIT_STAT_
     QF_CRIT_ENTRY_();
 
-    QF_EVT_REF_CTR_INC_(e); // increments the ref counter
+    (void)QF_EVT_REF_CTR_INC_(e); // increments the ref counter
 
     QS_BEGIN_NOCRIT_(QS_QF_NEW_REF,
                      static_cast<void *>(0), static_cast<void *>(0))
@@ -272,6 +791,7 @@ QEvt const *QF::newRef_(QEvt const * const e, QEvt const * const evtRef) {
     QS_END_NOCRIT_()
 
     QF_CRIT_EXIT_();
+#endif // QF_REF_CTR_ATOMIC
 
     return e;
 }
@@ -308,5 +828,542 @@ uint_fast16_t QF::poolGetMaxBlockSize(void) {
                QF_pool_[QF_maxPool_ - static_cast<uint_fast8_t>(1)]);
 }
 
-} // namespace QP
+#if (QF_MAX_BPOOL > 0)
+//****************************************************************************
+/// @description
+/// This function initializes one payload buffer pool at a time and must be
+/// called exactly once for each buffer pool before the pool can be used
+/// by QP::QF::newBuf().
+///
+/// @param[in] poolSto  pointer to the storage for the buffer pool
+/// @param[in] poolSize size of the storage for the pool in bytes
+/// @param[in] bufSize  the maximum payload size (in bytes) of the buffers
+///                     from this pool (without the QP::QBuf header)
+///
+/// @note
+/// Like the event pools, the buffer pools must be initialized in the
+/// ascending order of the buffer size.
+///
+/// @sa QP::QBuf, QP::QF::poolInit()
+///
+void QF::bufPoolInit(void * const poolSto, uint_fast32_t const poolSize,
+                     uint_fast16_t const bufSize)
+{
+    uint_fast16_t const blockSize = static_cast<uint_fast16_t>(
+        bufSize + static_cast<uint_fast16_t>(sizeof(QBuf)));
+
+    /// @pre cannot exceed the number of available buffer pools and
+    /// the block size must not overflow
+    Q_REQUIRE_ID(600, (l_maxBufPool
+                       < static_cast<uint_fast8_t>(Q_DIM(l_bufPool)))
+                      && (blockSize > bufSize));
+    /// @pre please initialize buffer pools in ascending order of bufSize
+    Q_REQUIRE_ID(601, (l_maxBufPool == static_cast<uint_fast8_t>(0))
+        || (QF_EPOOL_EVENT_SIZE_(
+               l_bufPool[l_maxBufPool - static_cast<uint_fast8_t>(1)])
+            < blockSize));
+
+    QF_BPOOL_INIT_(l_bufPool[l_maxBufPool], poolSto, poolSize, blockSize);
+    ++l_maxBufPool; // one more pool
+}
+
+//****************************************************************************
+/// @description
+/// Allocates a payload buffer from the smallest buffer pool that fits
+/// the requested payload size.
+///
+/// @param[in] size    the payload size (in bytes) of the buffer
+/// @param[in] margin  the number of un-allocated buffers still available
+///                    in a given buffer pool after the allocation completes.
+///                    The special value QP::QF_NO_MARGIN means that this
+///                    function will assert if allocation fails.
+///
+/// @returns
+/// pointer to the new buffer without any references and with the used
+/// length (QP::QBuf::len) of zero. The pointer can be NULL only if
+/// margin!=QP::QF_NO_MARGIN and the buffer cannot be allocated with the
+/// specified margin still available in the given pool.
+///
+QBuf *QF::newBuf(uint_fast32_t const size, uint_fast16_t const margin) {
+    uint_fast32_t const blockSize =
+        size + static_cast<uint_fast32_t>(sizeof(QBuf));
+
+    // find the buffer pool that fits the requested payload size...
+    uint_fast8_t idx;
+    for (idx = static_cast<uint_fast8_t>(0); idx < l_maxBufPool; ++idx) {
+        if (blockSize <= static_cast<uint_fast32_t>(
+                             QF_EPOOL_EVENT_SIZE_(l_bufPool[idx])))
+        {
+            break;
+        }
+    }
+    // cannot run out of registered pools
+    Q_ASSERT_ID(610, idx < l_maxBufPool);
+
+    // get the buffer -- platform-dependent
+    void *b;
+    QF_BPOOL_GET_(l_bufPool[idx], b,
+                  ((margin != QF_NO_MARGIN)
+                      ? margin
+                      : static_cast<uint_fast16_t>(0)));
+
+    QBuf *buf = static_cast<QBuf *>(b);
+    if (buf != static_cast<QBuf *>(0)) {
+        buf->len     = static_cast<uint32_t>(0);
+        buf->poolId_ = static_cast<uint8_t>(
+                           idx + static_cast<uint_fast8_t>(1));
+        buf->refCtr_ = static_cast<QEvtRefCtr>(0);
+    }
+    else {
+        // must tolerate bad alloc.
+        Q_ASSERT_ID(620, margin != static_cast<uint_fast16_t>(QF_NO_MARGIN));
+    }
+    return buf;
+}
+
+//****************************************************************************
+/// @description
+/// Attaches the payload buffer to a new dynamic event, which then holds
+/// one reference to the buffer until the event is recycled.
+///
+/// @param[in] e    pointer to the new event (not posted or published yet)
+/// @param[in] buf  pointer to the payload buffer
+///
+/// @usage
+/// @code
+/// FrameEvt *fe = Q_NEW(FrameEvt, FRAME_SIG); // FrameEvt derives QBufEvt
+/// QBuf *buf = QF::newBuf(len, QF_NO_MARGIN);
+/// buf->len = read(fd, buf->data(), len);
+/// QF::bufAttach(fe, buf);
+/// QF::PUBLISH(fe, me); // all subscribers share the same payload
+/// @endcode
+///
+void QF::bufAttach(QBufEvt * const e, QBuf * const buf) {
+    /// @pre the event must be dynamic, not posted yet and without any
+    /// attached buffer, and the buffer must come from a buffer pool
+    Q_REQUIRE_ID(630, (e->poolId_ != static_cast<uint8_t>(0))
+        && ((e->poolId_ & QF_EVT_BUF_) == static_cast<uint8_t>(0))
+        && (e->refCtr_ == static_cast<QEvtRefCtr>(0))
+        && (static_cast<uint_fast8_t>(1) <= buf->poolId_)
+        && (buf->poolId_ <= l_maxBufPool));
+
+    bufRef(buf);
+    e->buf = buf;
+    e->poolId_ |= QF_EVT_BUF_; // recycle() releases the buffer
+}
+
+//****************************************************************************
+/// @description
+/// Adds a reference to the payload buffer, which keeps the buffer from
+/// being recycled until the reference is released with
+/// QP::QF::bufRelease().
+///
+/// @param[in] buf  pointer to the payload buffer
+///
+void QF::bufRef(QBuf * const buf) {
+#ifdef QF_REF_CTR_ATOMIC
+    QEvtRefCtr const ctr = QF_REF_CTR_INC(buf->refCtr_);
+
+    // the reference counter must not wrap around
+    Q_ASSERT_ID(640, ctr != static_cast<QEvtRefCtr>(0));
+#else
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
+    QEvtRefCtr const ctr = QF_REF_CTR_INC(buf->refCtr_);
+    QF_CRIT_EXIT_();
+
+    // the reference counter must not wrap around
+    Q_ASSERT_ID(641, ctr != static_cast<QEvtRefCtr>(0));
+#endif // QF_REF_CTR_ATOMIC
+}
+
+//****************************************************************************
+/// @description
+/// Releases a reference to the payload buffer and recycles the buffer when
+/// no more references are outstanding. Like for the dynamic events, the
+/// buffer without any references (never attached to an event) is recycled
+/// right away.
+///
+/// @param[in] buf  pointer to the payload buffer
+///
+void QF::bufRelease(QBuf * const buf) {
+    uint_fast8_t const idx = static_cast<uint_fast8_t>(buf->poolId_)
+                             - static_cast<uint_fast8_t>(1);
+
+    /// @pre the buffer must come from a buffer pool
+    Q_REQUIRE_ID(650, idx < l_maxBufPool);
+
+#ifdef QF_REF_CTR_ATOMIC
+    // drop this reference atomically, outside of any critical section.
+    // NOTE: the counter of a buffer without references is zero and wraps
+    // around, which also means that no other reference exists.
+    QEvtRefCtr const ctr = QF_REF_CTR_DEC(buf->refCtr_);
+    bool const last = (ctr == static_cast<QEvtRefCtr>(0))
+        || (ctr == static_cast<QEvtRefCtr>(~static_cast<QEvtRefCtr>(0)));
+#else
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
+    bool const last = (buf->refCtr_ <= static_cast<QEvtRefCtr>(1));
+    if (!last) {
+        (void)QF_REF_CTR_DEC(buf->refCtr_); // decrement the ref counter
+    }
+    QF_CRIT_EXIT_();
+#endif // QF_REF_CTR_ATOMIC
+
+    if (last) { // this is the last reference to this buffer, recycle it
+        QF_BPOOL_PUT_(l_bufPool[idx], buf);
+    }
+}
+#endif // (QF_MAX_BPOOL > 0)
+
+#if (QF_ALLOC_HIST_SIZE > 0)
+
+//****************************************************************************
+// the index of the statistics of the signal @p sig in l_sigStats[]
+#if (QF_ALLOC_STAT_SIGS > 0)
+static uint_fast16_t sigStatIdx(enum_t const sig) {
+    return ((sig >= static_cast<enum_t>(0))
+            && (sig < static_cast<enum_t>(QF_ALLOC_STAT_SIGS)))
+           ? static_cast<uint_fast16_t>(sig)
+           : static_cast<uint_fast16_t>(QF_ALLOC_STAT_SIGS);
+}
+#endif // (QF_ALLOC_STAT_SIGS > 0)
+
+//****************************************************************************
+// count @p n allocations of @p evtSize bytes in the statistics @p st
+static void statCount(QFAllocStats * const st, uint_fast16_t const cls,
+                      uint_fast16_t const evtSize, uint_fast16_t const n)
+{
+    (void)QF_STAT_ADD(st->nAlloc, static_cast<uint32_t>(n));
+    (void)QF_STAT_ADD(st->hist[cls], static_cast<uint32_t>(n));
+    QF_STAT_MAX(st->maxSize, static_cast<uint32_t>(evtSize));
+    uint32_t const used = QF_STAT_ADD(st->nUsed, static_cast<uint32_t>(n));
+    QF_STAT_MAX(st->nPeak, used);
+}
+
+//****************************************************************************
+// record @p n events of @p evtSize bytes allocated from the pool @p idx
+static void statAlloc(uint_fast8_t const idx, uint_fast16_t const evtSize,
+                      enum_t const sig, uint_fast16_t const n)
+{
+    // the size class of the event, the last class for all larger events
+    uint_fast16_t cls = static_cast<uint_fast16_t>(0);
+    if (evtSize > static_cast<uint_fast16_t>(0)) {
+        cls = static_cast<uint_fast16_t>(
+            (evtSize - static_cast<uint_fast16_t>(1))
+            / static_cast<uint_fast16_t>(sizeof(void *)));
+    }
+    if (cls >= static_cast<uint_fast16_t>(QF_ALLOC_HIST_SIZE)) {
+        cls = static_cast<uint_fast16_t>(QF_ALLOC_HIST_SIZE - 1);
+    }
+
+#ifndef QF_STAT_ATOMIC
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
+#endif
+    statCount(&l_poolStats[idx], cls, evtSize, n);
+#if (QF_ALLOC_STAT_SIGS > 0)
+    statCount(&l_sigStats[sigStatIdx(sig)], cls, evtSize, n);
+#else
+    (void)sig;
+#endif
+#ifndef QF_STAT_ATOMIC
+    QF_CRIT_EXIT_();
+#endif
+}
+
+//****************************************************************************
+// record a failed allocation from the pool @p idx
+static void statFail(uint_fast8_t const idx, enum_t const sig) {
+#ifndef QF_STAT_ATOMIC
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
+#endif
+    (void)QF_STAT_ADD(l_poolStats[idx].nFail, static_cast<uint32_t>(1));
+#if (QF_ALLOC_STAT_SIGS > 0)
+    (void)QF_STAT_ADD(l_sigStats[sigStatIdx(sig)].nFail,
+                      static_cast<uint32_t>(1));
+#else
+    (void)sig;
+#endif
+#ifndef QF_STAT_ATOMIC
+    QF_CRIT_EXIT_();
+#endif
+}
+
+//****************************************************************************
+// record an event recycled to the pool @p idx
+// NOTE: the event is counted for the signal it has when it is recycled
+static void statFree(uint_fast8_t const idx, enum_t const sig) {
+#ifndef QF_STAT_ATOMIC
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
+#endif
+    (void)QF_STAT_SUB(l_poolStats[idx].nUsed, static_cast<uint32_t>(1));
+#if (QF_ALLOC_STAT_SIGS > 0)
+    (void)QF_STAT_SUB(l_sigStats[sigStatIdx(sig)].nUsed,
+                      static_cast<uint32_t>(1));
+#else
+    (void)sig;
+#endif
+#ifndef QF_STAT_ATOMIC
+    QF_CRIT_EXIT_();
+#endif
+}
 
+//****************************************************************************
+// copy the statistics @p st to @p stats and optionally reset them (except
+// the events allocated right now, which also become the new peak)
+static void statRead(QFAllocStats * const st, QFAllocStats * const stats,
+                     bool const reset)
+{
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
+    *stats = *st;
+    if (reset) {
+        st->nAlloc  = static_cast<uint32_t>(0);
+        st->nFail   = static_cast<uint32_t>(0);
+        st->nPeak   = st->nUsed;
+        st->maxSize = static_cast<uint32_t>(0);
+        QF::bzero(&st->hist[0],
+                  static_cast<uint_fast16_t>(sizeof(st->hist)));
+    }
+    QF_CRIT_EXIT_();
+}
+
+//****************************************************************************
+/// @description
+/// Obtains the allocation statistics of the given event pool since the
+/// pool has been initialized (or since the last reset): the numbers of the
+/// allocated events (in total, right now and at the peak), the failed
+/// allocations and the allocation-size histogram.
+///
+/// @param[in]  poolId event pool ID in the range 1..QF_maxPool_
+/// @param[out] stats  the statistics of the pool
+/// @param[in]  reset  reset the statistics after reading them
+///
+/// @note
+/// When the QF port updates the statistics atomically (#QF_STAT_ATOMIC),
+/// the statistics obtained while events are being allocated are not
+/// a consistent snapshot, but every counter is correct by itself.
+///
+void QF::getAllocStats(uint_fast8_t const poolId,
+                       QFAllocStats * const stats, bool const reset)
+{
+    /// @pre the poolId must be in range
+    Q_REQUIRE_ID(800, (static_cast<uint_fast8_t>(1) <= poolId)
+                      && (poolId <= QF_maxPool_));
+
+    statRead(&l_poolStats[poolId - static_cast<uint_fast8_t>(1)],
+             stats, reset);
+}
+
+#if (QF_ALLOC_STAT_SIGS > 0)
+//****************************************************************************
+/// @description
+/// Obtains the allocation statistics of the given signal, see
+/// QP::QF::getAllocStats(). The signals from #QF_ALLOC_STAT_SIGS up share
+/// one set of statistics.
+///
+/// @param[in]  sig    the signal
+/// @param[out] stats  the statistics of the signal
+/// @param[in]  reset  reset the statistics after reading them
+///
+void QF::getSigAllocStats(enum_t const sig,
+                          QFAllocStats * const stats, bool const reset)
+{
+    statRead(&l_sigStats[sigStatIdx(sig)], stats, reset);
+}
+#endif // (QF_ALLOC_STAT_SIGS > 0)
+
+//****************************************************************************
+// add the demand for @p nBlocks blocks of @p size bytes to the sorted
+// arrays @p sizeArr and @p demand (with @p m items), returns the new m
+static uint_fast16_t adviseAdd(uint_fast32_t sizeArr[],
+                               uint_fast32_t demand[], uint_fast16_t m,
+                               uint_fast32_t const size,
+                               uint_fast32_t const nBlocks)
+{
+    uint_fast16_t i = m;
+    while ((i > static_cast<uint_fast16_t>(0))
+           && (sizeArr[i - static_cast<uint_fast16_t>(1)] > size))
+    {
+        --i;
+    }
+    if ((i > static_cast<uint_fast16_t>(0))
+        && (sizeArr[i - static_cast<uint_fast16_t>(1)] == size))
+    {
+        demand[i - static_cast<uint_fast16_t>(1)] += nBlocks; // same size
+    }
+    else {
+        for (uint_fast16_t j = m; j > i; --j) { // make room for the item
+            sizeArr[j] = sizeArr[j - static_cast<uint_fast16_t>(1)];
+            demand[j]  = demand[j - static_cast<uint_fast16_t>(1)];
+        }
+        sizeArr[i] = size;
+        demand[i]  = nBlocks;
+        ++m;
+    }
+    return m;
+}
+
+//****************************************************************************
+/// @description
+/// Recommends the event pools that would hold the peak numbers of the
+/// events recorded in the allocation statistics in the least memory.
+/// The demand is taken from the statistics of the signals (the largest
+/// event and the peak number of events of every signal), if available
+/// (#QF_ALLOC_STAT_SIGS), otherwise from the size histograms of the event
+/// pools, with the peak usage of every pool divided among its size classes.
+/// The recommended block sizes are rounded up to sizeof(void*) (or to
+/// #QF_MPOOL_ALIGN, if used) and the total memory of the pools (the sum of
+/// the block size times the number of blocks) is minimized by dynamic
+/// programming over the sorted block sizes.
+///
+/// @param[out] advice   the array for the recommended event pools, in the
+///                      ascending order of the block size, as required by
+///                      QP::QF::poolInit()
+/// @param[in]  maxPools the maximum number of the pools to recommend
+/// @param[in]  work     the work area of the computation
+///
+/// @returns
+/// the number of the recommended event pools (0 if no event has been
+/// allocated so far).
+///
+/// @note
+/// The peaks of different signals might have occurred at different times,
+/// so the recommended numbers of blocks are upper bounds, without any
+/// headroom. The work area is provided by the caller, so concurrent calls
+/// are safe as long as each of them uses its own work area. The function
+/// should not be called from an ISR.
+///
+uint_fast8_t QF::advisePools(QFPoolAdvice advice[],
+                             uint_fast8_t const maxPools,
+                             QFPoolAdviceWork * const work)
+{
+    /// @pre at least one pool must be requested, the work area provided
+    Q_REQUIRE_ID(810, (maxPools != static_cast<uint_fast8_t>(0))
+                      && (work != static_cast<QFPoolAdviceWork *>(0)));
+
+    // the block size unit of the event pools
+    uint_fast32_t unit = static_cast<uint_fast32_t>(sizeof(void *));
+#if (defined QF_MPOOL_ALIGN) && (QF_MPOOL_ALIGN > 0)
+    if (static_cast<uint_fast32_t>(QF_MPOOL_ALIGN) > unit) {
+        unit = static_cast<uint_fast32_t>(QF_MPOOL_ALIGN);
+    }
+#endif
+
+    uint_fast32_t * const sizeArr = &work->sizeArr[0];
+    uint_fast32_t * const demand  = &work->demand[0];
+    uint_fast16_t m = static_cast<uint_fast16_t>(0); // the number of items
+    QFAllocStats st;
+
+#if (QF_ALLOC_STAT_SIGS > 0)
+    for (uint_fast16_t i = static_cast<uint_fast16_t>(0);
+         i < static_cast<uint_fast16_t>(QFPoolAdviceWork::MAX_ITEMS);
+         ++i)
+    {
+        statRead(&l_sigStats[i], &st, false);
+        if ((st.nPeak != static_cast<uint32_t>(0))
+            && (st.maxSize != static_cast<uint32_t>(0)))
+        {
+            m = adviseAdd(sizeArr, demand, m,
+                          ((st.maxSize + unit - 1U) / unit) * unit,
+                          st.nPeak);
+        }
+    }
+#else
+    for (uint_fast8_t idx = static_cast<uint_fast8_t>(0);
+         idx < QF_maxPool_;
+         ++idx)
+    {
+        statRead(&l_poolStats[idx], &st, false);
+        if (st.nAlloc != static_cast<uint32_t>(0)) {
+            for (uint_fast16_t cls = static_cast<uint_fast16_t>(0);
+                 cls < static_cast<uint_fast16_t>(QF_ALLOC_HIST_SIZE);
+                 ++cls)
+            {
+                if (st.hist[cls] != static_cast<uint32_t>(0)) {
+                    // the largest size in the class (the last class up
+                    // to the largest event)
+                    uint_fast32_t size = (cls < static_cast<uint_fast16_t>(
+                                                 QF_ALLOC_HIST_SIZE - 1))
+                        ? ((cls + 1U) * sizeof(void *))
+                        : st.maxSize;
+                    size = ((size + unit - 1U) / unit) * unit;
+
+                    // the share of the class in the peak of the pool
+                    uint_fast32_t const nBlocks = static_cast<uint_fast32_t>(
+                        ((static_cast<uint64_t>(st.nPeak) * st.hist[cls])
+                         + st.nAlloc - 1U) / st.nAlloc);
+                    m = adviseAdd(sizeArr, demand, m, size, nBlocks);
+                }
+            }
+        }
+    }
+#endif // (QF_ALLOC_STAT_SIGS > 0)
+
+    if (m == static_cast<uint_fast16_t>(0)) { // nothing allocated?
+        return static_cast<uint_fast8_t>(0);
+    }
+
+    // the number of the pools (more pools never need more memory)
+    uint_fast16_t k = (static_cast<uint_fast16_t>(maxPools) < m)
+                      ? static_cast<uint_fast16_t>(maxPools)
+                      : m;
+    if (k > static_cast<uint_fast16_t>(QF_MAX_EPOOL)) {
+        k = static_cast<uint_fast16_t>(QF_MAX_EPOOL);
+    }
+
+    // best[j]: the least memory for the items 0..j in the pools so far,
+    // first[p][j]: the first item in the last of the p+1 pools for 0..j
+    uint64_t * const best = &work->best[0];
+    uint64_t * const prev = &work->prev[0];
+    uint16_t (* const first)[QFPoolAdviceWork::MAX_ITEMS] = &work->first[0];
+    uint_fast16_t i;
+    uint_fast16_t j;
+    uint64_t sum = static_cast<uint64_t>(0);
+    for (j = static_cast<uint_fast16_t>(0); j < m; ++j) {
+        sum += demand[j];
+        best[j] = sum * sizeArr[j]; // one pool for the items 0..j
+        first[0][j] = static_cast<uint16_t>(0);
+    }
+    for (uint_fast16_t p = static_cast<uint_fast16_t>(1); p < k; ++p) {
+        for (j = static_cast<uint_fast16_t>(0); j < m; ++j) {
+            prev[j] = best[j];
+        }
+        for (j = p; j < m; ++j) {
+            // the last pool covers the items i..j
+            sum = static_cast<uint64_t>(0);
+            best[j] = ~static_cast<uint64_t>(0);
+            for (i = j; i >= p; --i) {
+                sum += demand[i];
+                uint64_t const cost = prev[i - static_cast<uint_fast16_t>(1)]
+                                      + (sum * sizeArr[j]);
+                if (cost < best[j]) {
+                    best[j] = cost;
+                    first[p][j] = static_cast<uint16_t>(i);
+                }
+            }
+        }
+    }
+
+    // the recommended pools, from the largest one
+    j = m;
+    for (uint_fast16_t p = k; p > static_cast<uint_fast16_t>(0); --p) {
+        uint_fast16_t const last = j - static_cast<uint_fast16_t>(1);
+        uint_fast16_t const top =
+            static_cast<uint_fast16_t>(first[p - 1U][last]);
+        advice[p - 1U].blockSize = static_cast<uint_fast16_t>(sizeArr[last]);
+        advice[p - 1U].nBlocks = static_cast<uint_fast32_t>(0);
+        for (i = top; i <= last; ++i) {
+            advice[p - 1U].nBlocks += demand[i];
+        }
+        j = top;
+    }
+    return static_cast<uint_fast8_t>(k);
+}
+
+#endif // (QF_ALLOC_HIST_SIZE > 0)
+
+} // namespace QP
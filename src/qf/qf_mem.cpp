@@ -85,6 +85,8 @@ QMPool::QMPool(void)
 /// Internally, the QP::QMPool::init() function rounds up the block size
 /// @p blockSize so that it can fit an integer number of pointers.
 /// This is done to achieve proper alignment of the blocks within the pool.
+/// When #QF_MPOOL_ALIGN is defined, the function also aligns the start of
+/// the blocks and rounds up the block size to a multiple of QF_MPOOL_ALIGN.
 ///
 /// @note
 /// Due to the rounding of block size the actual capacity of the pool
@@ -111,20 +113,12 @@ void QMPool::init(void * const poolSto, uint_fast32_t poolSize,
                blockSize + static_cast<uint_fast16_t>(sizeof(QFreeBlock)))
             > blockSize));
 
-    m_free_head = poolSto;
-
-    // round up the blockSize to fit an integer number of pointers...
-    //start with one
-    m_blockSize = static_cast<QMPoolSize>(sizeof(QFreeBlock));
-
-    //# free blocks in a memory block
-    uint_fast16_t nblocks = static_cast<uint_fast16_t>(1);
-    while (m_blockSize < static_cast<QMPoolSize>(blockSize)) {
-        m_blockSize += static_cast<QMPoolSize>(sizeof(QFreeBlock));
-        ++nblocks;
-    }
-    // use rounded-up value
-    blockSize = static_cast<uint_fast16_t>(m_blockSize);
+    // align the storage and round up the blockSize to fit an integer
+    // number of pointers (or of QF_MPOOL_ALIGN bytes, if defined)...
+    void *sto = poolSto;
+    uint_fast16_t const nblocks = QF_MPOOL_LAYOUT_(sto, poolSize, blockSize);
+    m_blockSize = static_cast<QMPoolSize>(blockSize); // rounded-up value
+    m_free_head = sto;
 
     // the whole pool buffer must fit at least one rounded-up block
     Q_ASSERT_ID(110, poolSize >= static_cast<uint_fast32_t>(blockSize));
@@ -150,8 +144,10 @@ void QMPool::init(void * const poolSto, uint_fast32_t poolSize,
     fb->m_next = static_cast<QFreeBlock *>(0); // the last link points to NULL
     m_nFree    = m_nTot;  // all blocks are free
     m_nMin     = m_nTot;  // the minimum number of free blocks
-    m_start    = poolSto; // the original start this pool buffer
+    m_start    = sto;     // the (aligned) start this pool buffer
     m_end      = fb;      // the last block in this pool
+
+    QF_CRIT_OBJ_INIT_(&m_crit); // init the lock of this pool (if used)
 }
 
 //****************************************************************************
@@ -179,7 +175,7 @@ void QMPool::put(void * const b) {
                       && QF_PTR_RANGE_(b, m_start, m_end));
     QF_CRIT_STAT_
 
-    QF_CRIT_ENTRY_();
+    QF_CRIT_OBJ_ENTRY_(&m_crit);
     static_cast<QFreeBlock*>(b)->m_next =
         static_cast<QFreeBlock *>(m_free_head); // link into the free list
     m_free_head = b; // set as new head of the free list
@@ -223,7 +219,7 @@ void *QMPool::get(uint_fast16_t const margin) {
     QFreeBlock *fb;
     QF_CRIT_STAT_
 
-    QF_CRIT_ENTRY_();
+    QF_CRIT_OBJ_ENTRY_(&m_crit);
     // have the than margin?
     if (m_nFree > static_cast<QMPoolCtr>(margin)) {
         fb = static_cast<QFreeBlock *>(m_free_head);  // get a free block
@@ -282,6 +278,145 @@ void *QMPool::get(uint_fast16_t const margin) {
     return fb; // return the block or NULL pointer to the caller
 }
 
+//****************************************************************************
+/// @description
+/// The function allocates @p n memory blocks from the pool at once, in one
+/// critical section, and returns them to the caller as a chain. The blocks
+/// in the chain are linked through their first pointer-size word (as
+/// QP::QFreeBlock) and the last block in the chain links to NULL.
+///
+/// @param[in] n       the number of blocks to allocate (all or none)
+/// @param[in] margin  the minimum number of unused blocks still available
+///                    in the pool after the allocation.
+///
+/// @returns
+/// the first block of the chain or NULL pointer if the pool does not have
+/// @p n blocks above the @p margin.
+///
+/// @note
+/// The free list is walked over the @p n blocks inside the critical section,
+/// so @p n should be small (e.g., a per-thread cache of blocks).
+///
+/// @sa
+/// QP::QMPool::putN()
+///
+void *QMPool::getN(uint_fast16_t const n, uint_fast16_t const margin) {
+    /// @pre at least one block must be requested
+    Q_REQUIRE_ID(500, n != static_cast<uint_fast16_t>(0));
+
+    QFreeBlock *head;
+    QF_CRIT_STAT_
+
+    QF_CRIT_OBJ_ENTRY_(&m_crit);
+    // have more than n blocks above the margin?
+    if (static_cast<uint_fast32_t>(m_nFree)
+        >= (static_cast<uint_fast32_t>(n) + margin))
+    {
+        head = static_cast<QFreeBlock *>(m_free_head);
+        QFreeBlock *fb = head;
+        for (uint_fast16_t i = static_cast<uint_fast16_t>(1); i < n; ++i) {
+            void *fb_next = fb->m_next; // volatile to a temporary
+
+            // the next free block must be in range (see NOTE in get())
+            Q_ASSERT_CRIT_(510, QF_PTR_RANGE_(fb_next, m_start, m_end));
+            fb = static_cast<QFreeBlock *>(fb_next);
+        }
+        m_free_head = fb->m_next; // the rest of the free list
+        fb->m_next = static_cast<QFreeBlock *>(0); // terminate the chain
+
+        m_nFree -= static_cast<QMPoolCtr>(n); // n free blocks less
+        if (m_nFree == static_cast<QMPoolCtr>(0)) {
+            // pool is becoming empty, so the next free block must be NULL
+            Q_ASSERT_CRIT_(520, m_free_head == static_cast<void *>(0));
+        }
+        else {
+            Q_ASSERT_CRIT_(530, QF_PTR_RANGE_(m_free_head, m_start, m_end));
+        }
+        if (m_nMin > m_nFree) {
+            m_nMin = m_nFree; // remember the minimum so far
+        }
+
+        // one trace record for the whole chain
+        QS_BEGIN_NOCRIT_(QS_QF_MPOOL_GET,
+                         QS::priv_.locFilter[QS::MP_OBJ], m_start)
+            QS_TIME_();        // timestamp
+            QS_OBJ_(m_start);  // the memory managed by this pool
+            QS_MPC_(m_nFree);  // the number of free blocks in the pool
+            QS_MPC_(m_nMin);   // the mninimum # free blocks in the pool
+        QS_END_NOCRIT_()
+    }
+    // don't have enough free blocks at this point
+    else {
+        head = static_cast<QFreeBlock *>(0);
+
+        QS_BEGIN_NOCRIT_(QS_QF_MPOOL_GET_ATTEMPT,
+                         QS::priv_.locFilter[QS::MP_OBJ], m_start)
+            QS_TIME_();        // timestamp
+            QS_OBJ_(m_start);  // the memory managed by this pool
+            QS_MPC_(m_nFree);  // the # free blocks in the pool
+            QS_MPC_(margin);   // the requested margin
+        QS_END_NOCRIT_()
+    }
+    QF_CRIT_EXIT_();
+
+    return head; // return the chain or NULL pointer to the caller
+}
+
+//****************************************************************************
+/// @description
+/// Recycle a chain of @p n memory blocks to the pool at once, in one
+/// critical section. The blocks must be linked through their first
+/// pointer-size word, as in the chains returned from QP::QMPool::getN().
+///
+/// @param[in]  chain  pointer to the first memory block of the chain
+/// @param[in]  n      the number of the blocks in the chain
+///
+/// @note
+/// The chain is walked and checked before entering the critical section,
+/// which then only links the chain in front of the free list.
+///
+/// @sa
+/// QP::QMPool::getN()
+///
+void QMPool::putN(void * const chain, uint_fast16_t const n) {
+    /// @pre the chain must have at least one block from this pool
+    Q_REQUIRE_ID(600, (n != static_cast<uint_fast16_t>(0))
+                      && QF_PTR_RANGE_(chain, m_start, m_end));
+
+    QFreeBlock *tail = static_cast<QFreeBlock *>(chain);
+    for (uint_fast16_t i = static_cast<uint_fast16_t>(1); i < n; ++i) {
+        tail = tail->m_next;
+
+        /// @pre all blocks in the chain must come from this pool
+        Q_REQUIRE_ID(610, QF_PTR_RANGE_(tail, m_start, m_end));
+    }
+    QF_CRIT_STAT_
+
+    QF_CRIT_OBJ_ENTRY_(&m_crit);
+
+    // # free blocks cannot exceed the total # blocks
+    Q_ASSERT_CRIT_(620, (static_cast<uint_fast32_t>(m_nFree) + n)
+                        <= static_cast<uint_fast32_t>(m_nTot));
+
+    tail->m_next = static_cast<QFreeBlock *>(m_free_head); // link the chain
+    m_free_head = chain; // set as new head of the free list
+    m_nFree += static_cast<QMPoolCtr>(n); // n more free blocks in this pool
+
+    // one trace record for the whole chain
+    QS_BEGIN_NOCRIT_(QS_QF_MPOOL_PUT,
+                     QS::priv_.locFilter[QS::MP_OBJ], m_start)
+        QS_TIME_();       // timestamp
+        QS_OBJ_(m_start); // the memory managed by this pool
+        QS_MPC_(m_nFree); // the number of free blocks in the pool
+    QS_END_NOCRIT_()
+
+    QF_CRIT_EXIT_();
+}
+
+// QF::getPoolMin() is implemented in the QF port when the port provides
+// its own event pool type (see the macro QF_EPOOL_PORT_).
+#ifndef QF_EPOOL_PORT_
+
 //****************************************************************************
 /// @description
 /// This function obtains the minimum number of free blocks in the given
@@ -302,7 +437,8 @@ uint_fast16_t QF::getPoolMin(uint_fast8_t const poolId) {
                        && (poolId <= QF_maxPool_));
 
     QF_CRIT_STAT_
-    QF_CRIT_ENTRY_();
+    QF_CRIT_OBJ_ENTRY_(
+        &QF_pool_[poolId - static_cast<uint_fast8_t>(1)].m_crit);
     uint_fast16_t min = static_cast<uint_fast16_t>(
         QF_pool_[poolId - static_cast<uint_fast8_t>(1)].m_nMin);
     QF_CRIT_EXIT_();
@@ -310,5 +446,7 @@ uint_fast16_t QF::getPoolMin(uint_fast8_t const poolId) {
     return min;
 }
 
+#endif // QF_EPOOL_PORT_
+
 } // namespace QP
 
@@ -97,6 +97,36 @@ void QF::psInit(QSubscrList * const subscrSto, enum_t const maxSignal) {
               * static_cast<uint_fast16_t>(sizeof(QSubscrList))));
 }
 
+//****************************************************************************
+//! posts a published event to the subscriber of a given priority
+/// (the function object for QP::QPSet::forEach() in QP::QF::publish_())
+class QFPublishPost {
+public:
+#ifndef Q_SPY
+    explicit QFPublishPost(QEvt const * const e)
+      : m_e(e)
+    {}
+#else
+    QFPublishPost(QEvt const * const e, void const * const sender)
+      : m_e(e), m_sender(sender)
+    {}
+#endif
+
+    void operator()(QPrio const p) const {
+        // the prio of the AO must be registered with the framework
+        Q_ASSERT_ID(210, QF::active_[p] != static_cast<QActive *>(0));
+
+        // POST() asserts internally if the queue overflows
+        (void)QF::active_[p]->POST(m_e, m_sender);
+    }
+
+private:
+    QEvt const *m_e;       //!< the published event
+#ifdef Q_SPY
+    void const *m_sender;  //!< the sender of the event (for QS)
+#endif
+};
+
 //****************************************************************************
 /// @description
 /// This function posts (using the FIFO policy) the event @a e to **all**
@@ -150,25 +180,16 @@ void QF::publish_(QEvt const * const e, void const * const sender) {
     QF_CRIT_EXIT_();
 
     if (subscrList.notEmpty()) { // any subscribers?
-        uint_fast8_t p = subscrList.findMax(); // the highest-prio subscriber
         QF_SCHED_STAT_
+#ifndef Q_SPY
+        QFPublishPost post(e);
+#else
+        QFPublishPost post(e, sender);
+#endif
 
-        QF_SCHED_LOCK_(p); // lock the scheduler up to prio 'p'
-        do { // loop over all subscribers */
-            // the prio of the AO must be registered with the framework
-            Q_ASSERT_ID(210, active_[p] != static_cast<QActive *>(0));
-
-            // POST() asserts internally if the queue overflows
-            (void)active_[p]->POST(e, sender);
-
-            subscrList.remove(p); // remove the handled subscriber
-            if (subscrList.notEmpty()) {  // still more subscribers?
-                p = subscrList.findMax(); // the highest-prio subscriber
-            }
-            else {
-                p = static_cast<uint_fast8_t>(0); // no more subscribers
-            }
-        } while (p != static_cast<uint_fast8_t>(0));
+        // lock the scheduler up to the prio of the highest-prio subscriber
+        QF_SCHED_LOCK_(subscrList.findMax());
+        subscrList.forEach(post); // post to all subscribers in prio order
         QF_SCHED_UNLOCK_(); // unlock the scheduler
     }
 
@@ -198,11 +219,11 @@ void QF::publish_(QEvt const * const e, void const * const sender) {
 /// QP::QActive::unsubscribeAll()
 ///
 void QActive::subscribe(enum_t const sig) const {
-    uint_fast8_t p = static_cast<uint_fast8_t>(m_prio);
+    QPrio const p = m_prio;
     Q_REQUIRE_ID(300, (Q_USER_SIG <= sig)
               && (sig < QF_maxPubSignal_)
-              && (static_cast<uint_fast8_t>(0) < p)
-              && (p <= static_cast<uint_fast8_t>(QF_MAX_ACTIVE))
+              && (static_cast<QPrio>(0) < p)
+              && (p <= static_cast<QPrio>(QF_MAX_ACTIVE))
               && (QF::active_[p] == this));
 
     QF_CRIT_STAT_
@@ -244,14 +265,14 @@ void QActive::subscribe(enum_t const sig) const {
 /// QP::QActive::unsubscribeAll()
 ///
 void QActive::unsubscribe(enum_t const sig) const {
-    uint_fast8_t p = static_cast<uint_fast8_t>(m_prio);
+    QPrio const p = m_prio;
 
     //! @pre the singal and the prioriy must be in ragne, the AO must also
     // be registered with the framework
     Q_REQUIRE_ID(400, (Q_USER_SIG <= sig)
                       && (sig < QF_maxPubSignal_)
-                      && (static_cast<uint_fast8_t>(0) < p)
-                      && (p <= static_cast<uint_fast8_t>(QF_MAX_ACTIVE))
+                      && (static_cast<QPrio>(0) < p)
+                      && (p <= static_cast<QPrio>(QF_MAX_ACTIVE))
                       && (QF::active_[p] == this));
 
     QF_CRIT_STAT_
@@ -291,10 +312,10 @@ void QActive::unsubscribe(enum_t const sig) const {
 /// QP::QActive::unsubscribe()
 ///
 void QActive::unsubscribeAll(void) const {
-    uint_fast8_t const p = static_cast<uint_fast8_t>(m_prio);
+    QPrio const p = m_prio;
 
-    Q_REQUIRE_ID(500, (static_cast<uint_fast8_t>(0) < p)
-                      && (p <= static_cast<uint_fast8_t>(QF_MAX_ACTIVE))
+    Q_REQUIRE_ID(500, (static_cast<QPrio>(0) < p)
+                      && (p <= static_cast<QPrio>(QF_MAX_ACTIVE))
                       && (QF::active_[p] == this));
 
     for (enum_t sig = Q_USER_SIG; sig < QF_maxPubSignal_; ++sig) {
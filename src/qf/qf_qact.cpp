@@ -43,7 +43,7 @@ namespace QP {
 //****************************************************************************
 QActive::QActive(QStateHandler const initial)
   : QHsm(initial),
-    m_prio(static_cast<uint8_t>(0))
+    m_prio(static_cast<QPrio>(0))
 {
     m_state.fun = Q_STATE_CAST(&QHsm::top);
 
@@ -54,6 +54,20 @@ QActive::QActive(QStateHandler const initial)
 #ifdef QF_THREAD_TYPE
     QF::bzero(&m_thread, static_cast<uint_fast16_t>(sizeof(m_thread)));
 #endif
+
+#ifdef QF_URGENT_LANE
+    m_uFront = static_cast<uint8_t>(0);
+#endif
+
+#if (QF_MAX_CONFLATE > 0)
+    m_nCfl = static_cast<uint8_t>(0);
+#endif
+
+#if (QF_QUEUE_HIST_SIZE > 0)
+    m_qTime    = static_cast<uint32_t *>(0);
+    m_qTimeLen = static_cast<uint_fast16_t>(0);
+    QF::bzero(&m_qStats, static_cast<uint_fast16_t>(sizeof(m_qStats)));
+#endif
 }
 
 } // namespace QP
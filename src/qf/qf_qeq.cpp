@@ -91,6 +91,8 @@ void QEQueue::init(QEvt const *qSto[], uint_fast16_t const qLen) {
     m_nFree    = static_cast<QEQueueCtr>(
                  qLen + static_cast<uint_fast16_t>(1)); //+1 for frontEvt
     m_nMin     = m_nFree;
+
+    QF_CRIT_OBJ_INIT_(&m_crit); // init the lock of this queue (if used)
 }
 
 //****************************************************************************
@@ -122,7 +124,7 @@ bool QEQueue::post(QEvt const * const e, uint_fast16_t const margin) {
     /// @pre event must be valid
     Q_REQUIRE_ID(200, e != static_cast<QEvt const *>(0));
 
-    QF_CRIT_ENTRY_();
+    QF_CRIT_OBJ_ENTRY_(&m_crit);
     QEQueueCtr nFree = m_nFree; // temporary to avoid UB for volatile access
 
     // margin available?
@@ -189,6 +191,111 @@ bool QEQueue::post(QEvt const * const e, uint_fast16_t const margin) {
     return status;
 }
 
+//****************************************************************************
+/// @description
+/// Post @p n events to the "raw" thread-safe event queue using the
+/// First-In-First-Out (FIFO) order, all in one critical section.
+///
+/// @param[in] evts   array of pointers to the events to be posted
+/// @param[in] n      number of events in the array
+/// @param[in] margin number of required free slots in the queue after
+///                   posting the events. The special value QP::QF_NO_MARGIN
+///                   means that all the events must be posted, or this
+///                   function asserts.
+///
+/// @returns the number of events posted, which are the first events of
+/// the array @p evts. The events that were not posted stay with the caller.
+///
+/// @note This function can be called from any task context or ISR context.
+///
+/// @sa QP::QEQueue::post(), QP::QEQueue::getBatch()
+///
+uint_fast16_t QEQueue::postN(QEvt const * const evts[],
+                             uint_fast16_t const n,
+                             uint_fast16_t const margin)
+{
+    /// @pre the event array must be valid
+    Q_REQUIRE_ID(500, evts != static_cast<QEvt const * const *>(0));
+
+    QF_CRIT_STAT_
+    QF_CRIT_OBJ_ENTRY_(&m_crit);
+    QEQueueCtr nFree = m_nFree; // temporary to avoid UB for volatile access
+
+    uint_fast16_t nPost; // the number of events that can be posted
+    if (margin == QF_NO_MARGIN) {
+        nPost = n;
+
+        /// @note assert if all the events cannot be posted and dropping
+        /// events is not acceptable
+        Q_ASSERT_CRIT_(510, static_cast<uint_fast16_t>(nFree) >= n);
+    }
+    else if (nFree > static_cast<QEQueueCtr>(margin)) {
+        nPost = static_cast<uint_fast16_t>(nFree) - margin;
+        if (nPost > n) {
+            nPost = n;
+        }
+    }
+    else {
+        nPost = static_cast<uint_fast16_t>(0);
+    }
+
+    uint_fast16_t i;
+    for (i = static_cast<uint_fast16_t>(0); i < nPost; ++i) {
+        QEvt const * const e = evts[i];
+
+        // is it a dynamic event?
+        if (e->poolId_ != static_cast<uint8_t>(0)) {
+            QF_EVT_REF_CTR_INC_(e); // increment the reference counter
+        }
+
+        QS_BEGIN_NOCRIT_(QS_QF_EQUEUE_POST_FIFO,
+                         QS::priv_.locFilter[QS::EQ_OBJ], this)
+            QS_TIME_();                      // timestamp
+            QS_SIG_(e->sig);                 // the signal of this event
+            QS_OBJ_(this);                   // this queue object
+            QS_2U8_(e->poolId_, e->refCtr_); // pool Id & refCtr of the evt
+            QS_EQC_(nFree);                  // number of free entries
+            QS_EQC_(m_nMin);                 // min number of free entries
+        QS_END_NOCRIT_()
+
+        --nFree; // one free entry just used up
+        if (m_nMin > nFree) {
+            m_nMin = nFree; // update minimum so far
+        }
+
+        // is the queue empty?
+        if (m_frontEvt == static_cast<QEvt const *>(0)) {
+            m_frontEvt = e; // deliver event directly
+        }
+        // queue is not empty, leave event in the ring-buffer
+        else {
+            QF_PTR_AT_(m_ring, m_head) = e; // insert e into buffer (FIFO)
+
+            // need to wrap?
+            if (m_head == static_cast<QEQueueCtr>(0)) {
+                m_head = m_end; // wrap around
+            }
+            --m_head;
+        }
+    }
+    m_nFree = nFree; // update the volatile
+
+    for (; i < n; ++i) { // events not posted
+        QS_BEGIN_NOCRIT_(QS_QF_EQUEUE_POST_ATTEMPT,
+                         QS::priv_.locFilter[QS::EQ_OBJ], this)
+            QS_TIME_();                      // timestamp
+            QS_SIG_(evts[i]->sig);           // the signal of this event
+            QS_OBJ_(this);                   // this queue object
+            QS_2U8_(evts[i]->poolId_, evts[i]->refCtr_); // pool Id & refCtr
+            QS_EQC_(nFree);                  // number of free entries
+            QS_EQC_(static_cast<QEQueueCtr>(margin)); // margin requested
+        QS_END_NOCRIT_()
+    }
+    QF_CRIT_EXIT_();
+
+    return nPost;
+}
+
 //****************************************************************************
 /// @description
 /// Post an event to the "raw" thread-safe event queue using the
@@ -213,7 +320,7 @@ bool QEQueue::post(QEvt const * const e, uint_fast16_t const margin) {
 void QEQueue::postLIFO(QEvt const * const e) {
     QF_CRIT_STAT_
 
-    QF_CRIT_ENTRY_();
+    QF_CRIT_OBJ_ENTRY_(&m_crit);
     QEQueueCtr nFree = m_nFree; // temporary to avoid UB for volatile access
 
     /// @pre the queue must be able to accept the event (cannot overflow)
@@ -275,7 +382,7 @@ QEvt const *QEQueue::get(void) {
     QEvt const *e;
     QF_CRIT_STAT_
 
-    QF_CRIT_ENTRY_();
+    QF_CRIT_OBJ_ENTRY_(&m_crit);
     e = m_frontEvt;  // always remove the event from the front location
 
     // is the queue not empty?
@@ -320,5 +427,109 @@ QEvt const *QEQueue::get(void) {
     return e;
 }
 
+//****************************************************************************
+/// @description
+/// Retrieves up to @p max events from the front of the "raw" thread-safe
+/// queue in one critical section and places them in the array @p evts in
+/// the order in which they would be returned by QP::QEQueue::get().
+///
+/// @param[out] evts array for the pointers to the retrieved events
+/// @param[in]  max  capacity of the array @p evts (must be at least 1)
+///
+/// @returns the number of events retrieved, which is zero if the queue
+/// is empty.
+///
+/// @sa
+/// QP::QEQueue::get(), QP::QEQueue::postN()
+///
+uint_fast16_t QEQueue::getBatch(QEvt const *evts[], uint_fast16_t const max)
+{
+    /// @pre the event array must be valid and hold at least one event
+    Q_REQUIRE_ID(600, (evts != static_cast<QEvt const **>(0))
+                      && (max > static_cast<uint_fast16_t>(0)));
+
+    uint_fast16_t n = static_cast<uint_fast16_t>(0);
+    QF_CRIT_STAT_
+    QF_CRIT_OBJ_ENTRY_(&m_crit);
+    QEvt const *e = m_frontEvt;  // always remove the event from the front
+    QEQueueCtr nFree = m_nFree;  // temporary to avoid UB for volatile access
+
+    while ((e != static_cast<QEvt const *>(0)) && (n < max)) {
+        evts[n] = e;
+        ++n;
+        ++nFree; // one more free entry
+
+        // any events in the ring buffer?
+        if (nFree <= m_end) {
+            QS_BEGIN_NOCRIT_(QS_QF_EQUEUE_GET,
+                             QS::priv_.locFilter[QS::EQ_OBJ], this)
+                QS_TIME_();              // timestamp
+                QS_SIG_(e->sig);         // the signal of this event
+                QS_OBJ_(this);           // this queue object
+                QS_2U8_(e->poolId_, e->refCtr_);// pool Id & refCtr of the evt
+                QS_EQC_(nFree);          // number of free entries
+            QS_END_NOCRIT_()
+
+            e = QF_PTR_AT_(m_ring, m_tail); // remove from the tail
+            if (m_tail == static_cast<QEQueueCtr>(0)) { // need to wrap?
+                m_tail = m_end; // wrap around
+            }
+            --m_tail;
+        }
+        else {
+            // all entries in the queue must be free (+1 for fronEvt)
+            Q_ASSERT_CRIT_(610,
+                           nFree == (m_end + static_cast<QEQueueCtr>(1)));
+
+            QS_BEGIN_NOCRIT_(QS_QF_EQUEUE_GET_LAST,
+                             QS::priv_.locFilter[QS::EQ_OBJ],
+                             this)
+                QS_TIME_();              // timestamp
+                QS_SIG_(e->sig);         // the signal of this event
+                QS_OBJ_(this);           // this queue object
+                QS_2U8_(e->poolId_, e->refCtr_);// pool Id & refCtr of the evt
+            QS_END_NOCRIT_()
+
+            e = static_cast<QEvt const *>(0); // queue becomes empty
+        }
+    }
+    m_frontEvt = e;  // the next event to remove (or NULL)
+    m_nFree = nFree; // update the volatile
+    QF_CRIT_EXIT_();
+
+    return n;
+}
+
+//****************************************************************************
+/// @description
+/// Increments the reference counter of the dynamic event @p e posted to
+/// the lock-free QP::QSpscQueue, which doesn't have a critical section of
+/// its own. With the atomic reference counters (QF_REF_CTR_ATOMIC) the
+/// critical section is not needed either.
+///
+/// @param[in] e  pointer to the dynamic event
+///
+void QF_spscRefInc_(QEvt const * const e) {
+#ifdef QF_REF_CTR_ATOMIC
+    (void)QF_EVT_REF_CTR_INC_(e); // increment the reference counter
+#else
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
+    (void)QF_EVT_REF_CTR_INC_(e); // increment the reference counter
+    QF_CRIT_EXIT_();
+#endif // QF_REF_CTR_ATOMIC
+}
+
+//****************************************************************************
+/// @description
+/// Raises the assertion of QP::QSpscQueue::post(), which cannot post an
+/// event with the margin QP::QF_NO_MARGIN (the queue is full). The
+/// assertion is out of line, so the inline queue operations do not
+/// depend on the assertion module of the application.
+///
+void QF_spscPostError_(void) {
+    Q_ERROR_ID(700); // must be able to post the event
+}
+
 } // namespace QP
 
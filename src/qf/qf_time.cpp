@@ -53,6 +53,10 @@ Q_DEFINE_THIS_MODULE("qf_time")
 // Package-scope objects *****************************************************
 QTimeEvt QF::timeEvtHead_[QF_MAX_TICK_RATE]; // heads of time event lists
 
+#ifdef QF_CRIT_OBJ_TYPE
+QF_CRIT_OBJ_TYPE QF_timeEvtCrit_[QF_MAX_TICK_RATE]; // locks of the lists
+#endif // QF_CRIT_OBJ_TYPE
+
 // The following flags and bitmasks are for the fields of the @c refCtr_
 // attribute of the QP::QTimeEvt class (inherited from QEvt). This attribute
 // is NOT used for reference counting in time events, because the @c poolId_
@@ -93,7 +97,7 @@ void QF::tickX_(uint_fast8_t const tickRate, void const * const sender)
     QTimeEvt *prev = &timeEvtHead_[tickRate];
     QF_CRIT_STAT_
 
-    QF_CRIT_ENTRY_();
+    QF_CRIT_OBJ_ENTRY_(&QF_timeEvtCrit_[tickRate]);
 
     QS_BEGIN_NOCRIT_(QS_QF_TICK, static_cast<void*>(0), static_cast<void*>(0))
         QS_TEC_(static_cast<QTimeEvtCtr>(++prev->m_ctr)); // tick ctr
@@ -183,7 +187,8 @@ void QF::tickX_(uint_fast8_t const tickRate, void const * const sender)
                 QF_CRIT_EXIT_NOP();
             }
         }
-        QF_CRIT_ENTRY_(); // re-enter crit. section to continue
+        // re-enter crit. section to continue
+        QF_CRIT_OBJ_ENTRY_(&QF_timeEvtCrit_[tickRate]);
     }
     QF_CRIT_EXIT_();
 }
@@ -227,6 +232,85 @@ bool QF::noTimeEvtsActiveX(uint_fast8_t const tickRate) {
     return inactive;
 }
 
+#ifdef QF_TICKLESS
+//****************************************************************************
+/// @description
+/// Finds the armed time event at the given clock tick rate, which expires
+/// first, both in the main list and in the list of "freshly armed" time
+/// events. A tickless QF port uses this to find out how many clock ticks it
+/// can skip.
+///
+/// @param[in]  tickRate  system clock tick rate to find out about.
+///
+/// @returns
+/// the number of clock ticks until the nearest expiration or 0 if no time
+/// events are armed at the given tick rate.
+///
+/// @note
+/// This function must be called in the critical section of the time events
+/// at the given tick rate.
+///
+QTimeEvtCtr QF::tickNearest_(uint_fast8_t const tickRate) {
+    QTimeEvtCtr nearest = static_cast<QTimeEvtCtr>(0);
+    QTimeEvt *t = timeEvtHead_[tickRate].m_next; // the main list
+    for (uint_fast8_t list = static_cast<uint_fast8_t>(0);
+         list < static_cast<uint_fast8_t>(2);
+         ++list)
+    {
+        for (; t != static_cast<QTimeEvt *>(0); t = t->m_next) {
+            QTimeEvtCtr ctr = t->m_ctr;
+            if ((ctr != static_cast<QTimeEvtCtr>(0))
+                && ((nearest == static_cast<QTimeEvtCtr>(0))
+                    || (ctr < nearest)))
+            {
+                nearest = ctr;
+            }
+        }
+        t = timeEvtHead_[tickRate].toTimeEvt(); // the "freshly armed" list
+    }
+    return nearest;
+}
+
+//****************************************************************************
+/// @description
+/// Applies the given number of clock ticks to all armed time events at the
+/// given tick rate at once, as if QP::QF::tickX_() was called @p nTicks
+/// times, but without ever expiring a time event. A time event that would
+/// expire is left with one clock tick, so it expires in the next call to
+/// QP::QF::tickX_().
+///
+/// @param[in]  tickRate  system clock tick rate to advance.
+/// @param[in]  nTicks    the number of clock ticks to apply.
+///
+/// @note
+/// This function must be called in the critical section of the time events
+/// at the given tick rate.
+///
+void QF::tickAdvance_(uint_fast8_t const tickRate, QTimeEvtCtr const nTicks)
+{
+    QTimeEvt *t = timeEvtHead_[tickRate].m_next; // the main list
+    timeEvtHead_[tickRate].m_ctr += nTicks; // the tick counter (for QS)
+    for (uint_fast8_t list = static_cast<uint_fast8_t>(0);
+         list < static_cast<uint_fast8_t>(2);
+         ++list)
+    {
+        for (; t != static_cast<QTimeEvt *>(0); t = t->m_next) {
+            QTimeEvtCtr ctr = t->m_ctr;
+            if (ctr > nTicks) {
+                t->m_ctr = static_cast<QTimeEvtCtr>(ctr - nTicks);
+            }
+            else if (ctr != static_cast<QTimeEvtCtr>(0)) {
+                t->m_ctr = static_cast<QTimeEvtCtr>(1); // expire next tick
+            }
+            else {
+                // disarmed time event, to be unlinked in QF::tickX_()
+            }
+        }
+        t = timeEvtHead_[tickRate].toTimeEvt(); // the "freshly armed" list
+    }
+}
+#endif // QF_TICKLESS
+
 //****************************************************************************
 /// @description
 /// When creating a time event, you must commit it to a specific active object
@@ -341,7 +425,8 @@ void QTimeEvt::armX(QTimeEvtCtr const nTicks, QTimeEvtCtr const interval) {
                  && (tickRate < static_cast<uint_fast8_t>(QF_MAX_TICK_RATE))
                  && (static_cast<enum_t>(sig) >= Q_USER_SIG));
 
-    QF_CRIT_ENTRY_();
+    QF_CRIT_OBJ_ENTRY_(&QF_timeEvtCrit_[tickRate]);
+    QF_TIMEEVT_ARM_(tickRate, nTicks); // tickless ports
     m_ctr = nTicks;
     m_interval = interval;
 
@@ -397,7 +482,8 @@ void QTimeEvt::armX(QTimeEvtCtr const nTicks, QTimeEvtCtr const interval) {
 ///
 bool QTimeEvt::disarm(void) {
     QF_CRIT_STAT_
-    QF_CRIT_ENTRY_();
+    QF_CRIT_OBJ_ENTRY_(&QF_timeEvtCrit_[refCtr_
+                                        & static_cast<uint8_t>(TE_TICK_RATE)]);
     bool wasArmed;
 
     // is the time event actually armed?
@@ -468,7 +554,8 @@ bool QTimeEvt::rearm(QTimeEvtCtr const nTicks) {
                  && (nTicks != static_cast<QTimeEvtCtr>(0))
                  && (static_cast<enum_t>(sig) >= Q_USER_SIG));
 
-    QF_CRIT_ENTRY_();
+    QF_CRIT_OBJ_ENTRY_(&QF_timeEvtCrit_[tickRate]);
+    QF_TIMEEVT_ARM_(tickRate, nTicks); // tickless ports
     bool wasArmed;
 
     // is the time evt not running?
@@ -561,7 +648,8 @@ bool QTimeEvt::wasDisarmed(void) {
 QTimeEvtCtr QTimeEvt::ctr(void) const {
     QF_CRIT_STAT_
 
-    QF_CRIT_ENTRY_();
+    QF_CRIT_OBJ_ENTRY_(&QF_timeEvtCrit_[refCtr_
+                                        & static_cast<uint8_t>(TE_TICK_RATE)]);
     QTimeEvtCtr ret = m_ctr;
     QF_CRIT_EXIT_();
 
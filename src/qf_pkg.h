@@ -82,6 +82,150 @@
     #define QF_CRIT_EXIT_()     QF_CRIT_EXIT(critStat_)
 #endif  // QF_CRIT_STAT_TYPE
 
+// QF-specific critical section protecting an individual QF object...
+#ifndef QF_CRIT_OBJ_TYPE
+    //! This is an internal macro for entering a critical section that
+    //! protects only the QF object associated with the lock @p obj_
+    /// @description
+    /// The QF objects that can be protected individually are the event
+    /// queues (QP::QEQueue), the memory pools (QP::QMPool) and the lists of
+    /// time events at each tick rate. If the macro #QF_CRIT_OBJ_TYPE is
+    /// defined in the QF port, each such object carries its own lock of
+    /// that type and this internal macro invokes #QF_CRIT_OBJ_ENTRY, which
+    /// must store the lock in the critical section status variable.
+    /// Otherwise the @p obj_ argument is ignored and the macro enters the
+    /// regular QF critical section. In both cases the critical section is
+    /// exited with QF_CRIT_EXIT_(), so that Q_ASSERT_CRIT_() can be used.
+    /// @sa #QF_CRIT_OBJ_TYPE
+    #define QF_CRIT_OBJ_ENTRY_(obj_)  QF_CRIT_ENTRY_()
+
+    //! This is an internal macro for initializing the lock @p obj_ of
+    //! a QF object. The macro is empty if #QF_CRIT_OBJ_TYPE is not defined.
+    #define QF_CRIT_OBJ_INIT_(obj_)   ((void)0)
+
+#else
+    #ifndef QF_CRIT_STAT_TYPE
+        #error "QF_CRIT_OBJ_TYPE requires QF_CRIT_STAT_TYPE"
+    #endif
+
+    #define QF_CRIT_OBJ_ENTRY_(obj_)  QF_CRIT_OBJ_ENTRY(critStat_, (obj_))
+    #define QF_CRIT_OBJ_INIT_(obj_)   QF_CRIT_OBJ_INIT((obj_))
+#endif // QF_CRIT_OBJ_TYPE
+
+// Reference counter updates -------------------------------------------------
+#ifdef QF_REF_CTR_ATOMIC
+    // The port defines QF_REF_CTR_ATOMIC when its QF_REF_CTR_INC/DEC are
+    // atomic read-modify-write operations returning the new value. QF then
+    // updates the reference counters outside of the critical section in
+    // QF::gc(), QF::newRef_() and QActive::recall().
+    #ifndef QF_REF_CTR_INC
+        #ifdef __GNUC__
+            // the atomic operations with the GCC/Clang builtins
+            #define QF_REF_CTR_INC(ctr_) \
+                __atomic_add_fetch(&(ctr_), 1U, __ATOMIC_RELAXED)
+            #define QF_REF_CTR_DEC(ctr_) \
+                __atomic_sub_fetch(&(ctr_), 1U, __ATOMIC_ACQ_REL)
+        #else
+            #error "QF_REF_CTR_ATOMIC requires atomic QF_REF_CTR_INC/DEC \
+(in the POSIX port define QF_POSIX_ATOMIC_REF_CTR instead)"
+        #endif
+    #endif
+#endif
+
+#ifndef QF_REF_CTR_INC
+    //! Increment the event reference counter @p ctr_ (port can override)
+    /// @description
+    /// The QF port can define this macro (and #QF_REF_CTR_DEC) to perform
+    /// the operation atomically, which is necessary when the event queues
+    /// are protected by individual locks (see #QF_CRIT_OBJ_TYPE), because
+    /// the same event can then be posted to different queues concurrently.
+    /// Otherwise the counter is simply incremented inside the critical
+    /// section of the caller.
+    #define QF_REF_CTR_INC(ctr_)    (++(ctr_))
+
+    //! Decrement the event reference counter @p ctr_ (port can override)
+    /// @sa #QF_REF_CTR_INC
+    #define QF_REF_CTR_DEC(ctr_)    (--(ctr_))
+#endif // QF_REF_CTR_INC
+
+// Batch operations on the event pools ---------------------------------------
+// The QF port can define the macros QF_EPOOL_GET_N_(p_, chain_, n_, m_) and
+// QF_EPOOL_PUT_N_(p_, chain_, n_) to get and put a chain of n_ blocks linked
+// through QP::QFreeBlock in one critical section (see QP::QMPool::getN()).
+// Otherwise QP::QF::newBatch_() and QP::QF::gcBatch() get and put the blocks
+// one by one.
+
+// Allocation statistics -----------------------------------------------------
+#if (QF_ALLOC_HIST_SIZE > 0)
+#ifndef QF_STAT_ATOMIC
+    //! Add @p n_ to the statistics counter @p ctr_ (port can override)
+    /// @description
+    /// The QF port can define the macro QF_STAT_ATOMIC together with this
+    /// macro, #QF_STAT_SUB and #QF_STAT_MAX to update the counters of the
+    /// allocation statistics (QP::QFAllocStats) with atomic operations.
+    /// Otherwise the counters are updated inside the QF critical section.
+    #define QF_STAT_ADD(ctr_, n_)   ((ctr_) += (n_))
+
+    //! Subtract @p n_ from the statistics counter @p ctr_
+    /// @sa #QF_STAT_ADD
+    #define QF_STAT_SUB(ctr_, n_)   ((ctr_) -= (n_))
+
+    //! Raise the statistics counter @p ctr_ to at least @p v_
+    /// @sa #QF_STAT_ADD
+    #define QF_STAT_MAX(ctr_, v_) \
+        ((void)(((ctr_) < (v_)) ? ((ctr_) = (v_)) : (ctr_)))
+#endif // QF_STAT_ATOMIC
+#endif // (QF_ALLOC_HIST_SIZE > 0)
+
+// Payload buffer pools ------------------------------------------------------
+#if (QF_MAX_BPOOL > 0)
+    //! flag in the poolId_ of an event with an attached payload buffer
+    #define QF_EVT_BUF_  static_cast<uint8_t>(0x80)
+
+    #ifndef QF_BPOOL_INIT_
+        //! Initialize the payload buffer pool @p p_ (port can override)
+        /// @description
+        /// The payload buffer pools are of the same #QF_EPOOL_TYPE_ as the
+        /// event pools and by default use the same operations. The QF port
+        /// can define the QF_BPOOL_INIT_(), QF_BPOOL_GET_() and
+        /// QF_BPOOL_PUT_() macros when its event pool operations apply only
+        /// to the event pools (QP::QF_pool_[]).
+        #define QF_BPOOL_INIT_(p_, poolSto_, poolSize_, bufSize_) \
+            QF_EPOOL_INIT_((p_), (poolSto_), (poolSize_), (bufSize_))
+
+        //! Get the block @p b_ (void *) from the payload buffer pool @p p_
+        #define QF_BPOOL_GET_(p_, b_, m_)  QF_EPOOL_GET_((p_), (b_), (m_))
+
+        //! Put the block @p b_ back to the payload buffer pool @p p_
+        #define QF_BPOOL_PUT_(p_, b_)      QF_EPOOL_PUT_((p_), (b_))
+    #endif // QF_BPOOL_INIT_
+#endif // (QF_MAX_BPOOL > 0)
+
+// Active object event queue signaling after the critical section -----------
+#ifndef QACTIVE_EQUEUE_WAKE_
+    //! This is an internal macro invoked right after exiting the critical
+    //! section in which an event has been posted to the active object @p me_
+    /// @description
+    /// The QF port can define this macro to perform the part of signaling
+    /// the event queue (see QACTIVE_EQUEUE_SIGNAL_()) that should not be
+    /// done inside the critical section, such as a system call waking up
+    /// the thread of the active object. By default the macro is empty.
+    #define QACTIVE_EQUEUE_WAKE_(me_) ((void)0)
+#endif
+
+// Arming of time events (tickless ports) ----------------------------------
+#ifndef QF_TIMEEVT_ARM_
+    //! This is an internal macro invoked inside the critical section of
+    //! QP::QTimeEvt::armX() and QP::QTimeEvt::rearm(), right before the
+    //! time event at @p tickRate_ is (re)armed for @p nTicks_ clock ticks.
+    /// @description
+    /// A tickless QF port (see #QF_TICKLESS) can define this macro to bring
+    /// the time events up to date with the clock ticks skipped so far, and
+    /// to wake up the ticker when the new time event expires earlier than
+    /// the next planned clock tick. By default the macro is empty.
+    #define QF_TIMEEVT_ARM_(tickRate_, nTicks_) ((void)0)
+#endif
+
 // Assertions inside the crticial section ------------------------------------
 #ifdef Q_NASSERT // Q_NASSERT defined--assertion checking disabled
 
@@ -116,6 +260,24 @@ extern uint_fast8_t QF_maxPool_;     //!< # of initialized event pools
 extern QSubscrList *QF_subscrList_;  //!< the subscriber list array
 extern enum_t QF_maxPubSignal_;      //!< the maximum published signal
 
+#if (QF_EPOOL_LUT_SIZE > 0)
+//! lookup table from the event size to the event pool ID
+extern uint8_t QF_poolLut_[QF_EPOOL_LUT_SIZE];
+#endif
+
+#if (QF_MAX_CONFLATE > 0)
+//! the position of the waiting event of a conflatable signal
+//! (QP::QActive::m_cflPos[]) is an index into the ring buffer or one of
+//! the special values QF_cflNone_ and QF_cflFront_, which no index can reach
+static QEQueueCtr const QF_cflNone_  = static_cast<QEQueueCtr>(~0U);
+static QEQueueCtr const QF_cflFront_ = static_cast<QEQueueCtr>(~1U);
+#endif
+
+#ifdef QF_CRIT_OBJ_TYPE
+//! locks of the time event lists (one for each tick rate)
+extern QF_CRIT_OBJ_TYPE QF_timeEvtCrit_[QF_MAX_TICK_RATE];
+#endif // QF_CRIT_OBJ_TYPE
+
 //............................................................................
 //! Structure representing a free block in the Native QF Memory Pool
 /// @sa QP::QMPool
@@ -132,18 +294,67 @@ inline uint8_t QF_EVT_POOL_ID_ (QEvt const * const e) {
 }
 
 //! return the Reference Conter of an event @p e
-inline uint8_t QF_EVT_REF_CTR_ (QEvt const * const e) {
+inline QEvtRefCtr QF_EVT_REF_CTR_ (QEvt const * const e) {
     return e->refCtr_;
 }
 
-//! increment the refCtr_ of an event @p e
-inline void QF_EVT_REF_CTR_INC_(QEvt const * const e) {
-    ++(QF_EVT_CONST_CAST_(e))->refCtr_;
+//! increment the refCtr_ of an event @p e, returns the new value
+inline QEvtRefCtr QF_EVT_REF_CTR_INC_(QEvt const * const e) {
+    return QF_REF_CTR_INC((QF_EVT_CONST_CAST_(e))->refCtr_);
+}
+
+//! decrement the refCtr_ of an event @p e, returns the new value
+inline QEvtRefCtr QF_EVT_REF_CTR_DEC_(QEvt const * const e) {
+    return QF_REF_CTR_DEC((QF_EVT_CONST_CAST_(e))->refCtr_);
+}
+
+//! lay out the blocks of a memory pool (see #QF_MPOOL_ALIGN)
+/// @description
+/// Aligns the start of the pool storage @p sto (if not NULL) to
+/// #QF_MPOOL_ALIGN, reducing the @p size of the storage accordingly, and
+/// rounds up the @p blockSize to a multiple of QF_MPOOL_ALIGN, but at least
+/// to a multiple of the pointer size.
+///
+/// @returns the number of QP::QFreeBlock units in the rounded-up block
+inline uint_fast16_t QF_MPOOL_LAYOUT_(void * &sto, uint_fast32_t &size,
+                                      uint_fast16_t &blockSize)
+{
+#if (QF_MPOOL_ALIGN > 0)
+    if (sto != static_cast<void *>(0)) {
+        uint_fast32_t const gap = static_cast<uint_fast32_t>(
+            (static_cast<uintptr_t>(QF_MPOOL_ALIGN)
+             - (reinterpret_cast<uintptr_t>(sto)
+                & static_cast<uintptr_t>(QF_MPOOL_ALIGN - 1U)))
+            & static_cast<uintptr_t>(QF_MPOOL_ALIGN - 1U));
+        sto  = static_cast<uint8_t *>(sto) + gap;
+        size = (size > gap) ? (size - gap) : static_cast<uint_fast32_t>(0);
+    }
+    uint_fast32_t const unit =
+        (static_cast<uint_fast32_t>(QF_MPOOL_ALIGN) > sizeof(QFreeBlock))
+        ? static_cast<uint_fast32_t>(QF_MPOOL_ALIGN)
+        : static_cast<uint_fast32_t>(sizeof(QFreeBlock));
+#else
+    (void)sto;
+    (void)size;
+    uint_fast32_t const unit = static_cast<uint_fast32_t>(sizeof(QFreeBlock));
+#endif // QF_MPOOL_ALIGN
+
+    // round up the blockSize to fit an integer number of units...
+    uint_fast32_t stride = unit;
+    while (stride < static_cast<uint_fast32_t>(blockSize)) {
+        stride += unit;
+    }
+    blockSize = static_cast<uint_fast16_t>(stride);
+    return static_cast<uint_fast16_t>(stride / sizeof(QFreeBlock));
 }
 
-//! decrement the refCtr_ of an event @p e
-inline void QF_EVT_REF_CTR_DEC_(QEvt const * const e) {
-    --(QF_EVT_CONST_CAST_(e))->refCtr_;
+//! the block size of a memory pool for blocks of @p blockSize bytes,
+//! rounded up as in QF_MPOOL_LAYOUT_()
+inline uint_fast16_t QF_poolStride_(uint_fast16_t blockSize) {
+    void *sto = static_cast<void *>(0);
+    uint_fast32_t size = static_cast<uint_fast32_t>(0);
+    (void)QF_MPOOL_LAYOUT_(sto, size, blockSize);
+    return blockSize;
 }
 
 //! macro to test that a pointer @p x_ is in range between @p min_ and @p max_
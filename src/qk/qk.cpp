@@ -79,13 +79,16 @@ void QF::init(void) {
     QF_subscrList_   = static_cast<QSubscrList *>(0);
     QF_maxPubSignal_ = static_cast<enum_t>(0);
 
+#if (QF_EPOOL_LUT_SIZE > 0)
+    bzero(&QF_poolLut_[0], static_cast<uint_fast16_t>(sizeof(QF_poolLut_)));
+#endif
     bzero(&QF::timeEvtHead_[0],
           static_cast<uint_fast16_t>(sizeof(QF::timeEvtHead_)));
     bzero(&active_[0], static_cast<uint_fast16_t>(sizeof(active_)));
     bzero(&QK_attr_,   static_cast<uint_fast16_t>(sizeof(QK_attr_)));
 
-    QK_attr_.actPrio  = static_cast<uint8_t>(0); // prio of QK idle loop
-    QK_attr_.lockPrio = static_cast<uint8_t>(QF_MAX_ACTIVE); // locked
+    QK_attr_.actPrio  = static_cast<QPrio>(0); // prio of QK idle loop
+    QK_attr_.lockPrio = static_cast<QPrio>(QF_MAX_ACTIVE); // locked
 
 #ifdef QK_INIT
     QK_INIT(); // port-specific initialization of the QK kernel
@@ -112,10 +115,10 @@ void QF::stop(void) {
 //! process all events posted during initialization */
 static void initial_events(void); // prototype
 static void initial_events(void) {
-    QK_attr_.lockPrio = static_cast<uint8_t>(0); // scheduler unlocked
+    QK_attr_.lockPrio = static_cast<QPrio>(0); // scheduler unlocked
 
     // any active objects need to be scheduled before starting event loop?
-    if (QK_sched_() != static_cast<uint_fast8_t>(0)) {
+    if (QK_sched_() != static_cast<QPrio>(0)) {
         QK_activate_(); // activate AOs to process all events posted so far
     }
 }
@@ -161,7 +164,7 @@ int_t QF::run(void) {
 // @include
 // qf_start.cpp
 //
-void QActive::start(uint_fast8_t const prio,
+void QActive::start(QPrio const prio,
                     QEvt const *qSto[], uint_fast16_t const qLen,
                     void * const stkSto, uint_fast16_t const,
                     QEvt const * const ie)
@@ -170,13 +173,13 @@ void QActive::start(uint_fast8_t const prio,
     /// and the stack storage must not be provided, because the QK kernel does
     /// not need per-AO stacks.
     Q_REQUIRE_ID(300, (!QK_ISR_CONTEXT_())
-                      && (static_cast<uint_fast8_t>(0) < prio)
-                      && (prio <= static_cast<uint_fast8_t>(QF_MAX_ACTIVE))
+                      && (static_cast<QPrio>(0) < prio)
+                      && (prio <= static_cast<QPrio>(QF_MAX_ACTIVE))
                       && (stkSto == static_cast<void *>(0)));
 
     m_eQueue.init(qSto, qLen); // initialize the built-in queue
 
-    m_prio = static_cast<uint8_t>(prio);  // set the QF priority of this AO
+    m_prio = prio;  // set the QF priority of this AO
     QF::add_(this); // make QF aware of this AO
 
     this->init(ie); // take the top-most initial tran. (virtual)
@@ -185,7 +188,7 @@ void QActive::start(uint_fast8_t const prio,
     // See if this AO needs to be scheduled in case QK is already running
     QF_CRIT_STAT_
     QF_CRIT_ENTRY_();
-    if (QK_sched_() != static_cast<uint_fast8_t>(0)) { // activation needed?
+    if (QK_sched_() != static_cast<QPrio>(0)) { // activation needed?
         QK_activate_();
     }
     QF_CRIT_EXIT_();
@@ -211,8 +214,8 @@ void QActive::stop(void) {
 
     QF_CRIT_STAT_
     QF_CRIT_ENTRY_();
-    QK_attr_.readySet.remove(static_cast<uint_fast8_t>(m_prio));
-    if (QK_sched_() != static_cast<uint_fast8_t>(0)) {
+    QK_attr_.readySet.remove(m_prio);
+    if (QK_sched_() != static_cast<QPrio>(0)) {
         QK_activate_();
     }
     QF_CRIT_EXIT_();
@@ -241,7 +244,7 @@ void QActive::stop(void) {
 /// The following example shows how to lock and unlock the QK scheduler:
 /// @include qk_lock.cpp
 ///
-QSchedStatus QK::schedLock(uint_fast8_t const ceiling) {
+QSchedStatus QK::schedLock(QPrio const ceiling) {
     QSchedStatus stat;
     QF_CRIT_STAT_
     QF_CRIT_ENTRY_();
@@ -251,15 +254,16 @@ QSchedStatus QK::schedLock(uint_fast8_t const ceiling) {
     Q_REQUIRE_ID(600, !QK_ISR_CONTEXT_());
 
     // first store the previous lock prio if it is below the ceiling
-    if (static_cast<uint_fast8_t>(QK_attr_.lockPrio) < ceiling) {
-        stat = (static_cast<QSchedStatus>(QK_attr_.lockPrio) << 8);
-        QK_attr_.lockPrio = static_cast<uint8_t>(ceiling);
+    if (static_cast<QPrio>(QK_attr_.lockPrio) < ceiling) {
+        stat = (static_cast<QSchedStatus>(QK_attr_.lockPrio)
+                << QK_SCHED_SHIFT_);
+        QK_attr_.lockPrio = static_cast<QPrio>(ceiling);
 
         QS_BEGIN_NOCRIT_(QS_SCHED_LOCK,
                          static_cast<void *>(0), static_cast<void *>(0))
             QS_TIME_(); // timestamp
-            QS_2U8_(static_cast<uint8_t>(stat), /* the previous lock prio */
-                    QK_attr_.lockPrio); // new lock prio
+            QS_2PRIO_(stat >> QK_SCHED_SHIFT_, /* previous lock prio */
+                      QK_attr_.lockPrio); // new lock prio
         QS_END_NOCRIT_()
 
         // add the previous lock holder priority
@@ -268,7 +272,7 @@ QSchedStatus QK::schedLock(uint_fast8_t const ceiling) {
         QK_attr_.lockHolder = QK_attr_.actPrio;
     }
     else {
-       stat = static_cast<QSchedStatus>(0xFF);
+       stat = QK_SCHED_NOLOCK_;
     }
     QF_CRIT_EXIT_();
 
@@ -294,9 +298,9 @@ QSchedStatus QK::schedLock(uint_fast8_t const ceiling) {
 ///
 void QK::schedUnlock(QSchedStatus const stat) {
     // has the scheduler been actually locked by the last QK_schedLock()?
-    if (stat != static_cast<QSchedStatus>(0xFF)) {
-        uint_fast8_t lockPrio = static_cast<uint_fast8_t>(QK_attr_.lockPrio);
-        uint_fast8_t prevPrio = static_cast<uint_fast8_t>(stat >> 8);
+    if (stat != QK_SCHED_NOLOCK_) {
+        QPrio lockPrio = static_cast<QPrio>(QK_attr_.lockPrio);
+        QPrio prevPrio = static_cast<QPrio>(stat >> QK_SCHED_SHIFT_);
         QF_CRIT_STAT_
         QF_CRIT_ENTRY_();
 
@@ -309,17 +313,17 @@ void QK::schedUnlock(QSchedStatus const stat) {
         QS_BEGIN_NOCRIT_(QS_SCHED_UNLOCK,
                          static_cast<void *>(0), static_cast<void *>(0))
             QS_TIME_(); // timestamp
-            QS_2U8_(static_cast<uint8_t>(lockPrio),/* prio before unlocking */
-                    static_cast<uint8_t>(prevPrio));// prio after unlocking
+            QS_2PRIO_(lockPrio,/* prio before unlocking */
+                      prevPrio);// prio after unlocking
         QS_END_NOCRIT_()
 
         // restore the previous lock priority and lock holder
-        QK_attr_.lockPrio   = static_cast<uint8_t>(prevPrio);
+        QK_attr_.lockPrio   = static_cast<QPrio>(prevPrio);
         QK_attr_.lockHolder =
-            static_cast<uint8_t>(stat & static_cast<QSchedStatus>(0xFF));
+            static_cast<QPrio>(stat & QK_SCHED_NOLOCK_);
 
         // find the highest-prio thread ready to run
-        if (QK_sched_() != static_cast<uint_fast8_t>(0)) { // priority found?
+        if (QK_sched_() != static_cast<QPrio>(0)) { // priority found?
             QK_activate_(); // activate any unlocked basic threads
         }
 
@@ -345,20 +349,20 @@ extern "C" {
 /// QK_sched_() must be always called with interrupts **disabled** and
 /// returns with interrupts **disabled**.
 ///
-uint_fast8_t QK_sched_(void) {
+QP::QPrio QK_sched_(void) {
     // find the highest-prio AO with non-empty event queue
-    uint_fast8_t p = QK_attr_.readySet.findMax();
+    QP::QPrio p = QK_attr_.readySet.findMax();
 
     // is the highest-prio below the active prio?
-    if (p <= static_cast<uint_fast8_t>(QK_attr_.actPrio)) {
-        p = static_cast<uint_fast8_t>(0); // active object not eligible
+    if (p <= static_cast<QP::QPrio>(QK_attr_.actPrio)) {
+        p = static_cast<QP::QPrio>(0); // active object not eligible
     }
-    else if (p <= static_cast<uint_fast8_t>(QK_attr_.lockPrio)) {//below lock?
-        p = static_cast<uint_fast8_t>(0); // active object not eligible
+    else if (p <= static_cast<QP::QPrio>(QK_attr_.lockPrio)) {//below lock?
+        p = static_cast<QP::QPrio>(0); // active object not eligible
     }
     else {
-        Q_ASSERT_ID(610, p <= static_cast<uint_fast8_t>(QF_MAX_ACTIVE));
-        QK_attr_.nextPrio = static_cast<uint8_t>(p); // next AO to run
+        Q_ASSERT_ID(610, p <= static_cast<QP::QPrio>(QF_MAX_ACTIVE));
+        QK_attr_.nextPrio = static_cast<QP::QPrio>(p); // next AO to run
     }
     return p;
 }
@@ -373,30 +377,30 @@ uint_fast8_t QK_sched_(void) {
 /// interrupts **disabled**.
 ///
 void QK_activate_(void) {
-    uint_fast8_t pin = static_cast<uint_fast8_t>(QK_attr_.actPrio);
-    uint_fast8_t p   = static_cast<uint_fast8_t>(QK_attr_.nextPrio);
+    QP::QPrio pin = static_cast<QP::QPrio>(QK_attr_.actPrio);
+    QP::QPrio p   = static_cast<QP::QPrio>(QK_attr_.nextPrio);
     QP::QActive *a;
 
     // QK Context switch callback defined or QS tracing enabled?
 #if (defined QK_ON_CONTEXT_SW) || (defined Q_SPY)
-    uint_fast8_t pprev = pin;
+    QP::QPrio pprev = pin;
 #endif // QK_ON_CONTEXT_SW || Q_SPY
 
     // QK_attr_.nextPrio must be non-zero upon entry to QK_activate_()
-    Q_REQUIRE_ID(800, p != static_cast<uint_fast8_t>(0));
+    Q_REQUIRE_ID(800, p != static_cast<QP::QPrio>(0));
 
-    QK_attr_.nextPrio = static_cast<uint8_t>(0); // clear for next time
+    QK_attr_.nextPrio = static_cast<QP::QPrio>(0); // clear for next time
 
     // loop until no more ready-to-run AOs of higher prio than the initial
     do {
         a = QP::QF::active_[p]; // obtain the pointer to the AO
-        QK_attr_.actPrio = static_cast<uint8_t>(p); // the new active prio
+        QK_attr_.actPrio = static_cast<QP::QPrio>(p); // the new active prio
 
         QS_BEGIN_NOCRIT_(QP::QS_SCHED_NEXT,
                          QP::QS::priv_.locFilter[QP::QS::AO_OBJ], a)
             QS_TIME_();   // timestamp
-            QS_2U8_(static_cast<uint8_t>(p), // prio of the scheduled AO
-                    static_cast<uint8_t>(pprev)); // previous priority
+            QS_2PRIO_(p, // prio of the scheduled AO
+                      pprev); // previous priority
         QS_END_NOCRIT_()
 
 #if (defined QK_ON_CONTEXT_SW) || (defined Q_SPY)
@@ -404,7 +408,7 @@ void QK_activate_(void) {
 
 #ifdef QK_ON_CONTEXT_SW
             // context-switch callback
-            QK_onContextSw(((pprev != static_cast<uint_fast8_t>(0))
+            QK_onContextSw(((pprev != static_cast<QP::QPrio>(0))
                            ? QP::QF::active_[pprev]
                            : static_cast<QP::QActive *>(0)), a);
 #endif // QK_ON_CONTEXT_SW
@@ -437,28 +441,28 @@ void QK_activate_(void) {
 
         // is the new priority below the initial preemption threshold?
         if (p <= pin) {
-            p = static_cast<uint_fast8_t>(0); // active object not eligible
+            p = static_cast<QP::QPrio>(0); // active object not eligible
         }
-        else if (p <= static_cast<uint_fast8_t>(QK_attr_.lockPrio)) {
-            p = static_cast<uint_fast8_t>(0); // active object not eligible
+        else if (p <= static_cast<QP::QPrio>(QK_attr_.lockPrio)) {
+            p = static_cast<QP::QPrio>(0); // active object not eligible
         }
         else {
-            Q_ASSERT_ID(710, p <= static_cast<uint_fast8_t>(QF_MAX_ACTIVE));
+            Q_ASSERT_ID(710, p <= static_cast<QP::QPrio>(QF_MAX_ACTIVE));
         }
-    } while (p != static_cast<uint_fast8_t>(0));
+    } while (p != static_cast<QP::QPrio>(0));
 
-    QK_attr_.actPrio = static_cast<uint8_t>(pin); // restore the active prio
+    QK_attr_.actPrio = static_cast<QP::QPrio>(pin); // restore the active prio
 
 #if (defined QK_ON_CONTEXT_SW) || (defined Q_SPY)
 
-    if (pin != static_cast<uint_fast8_t>(0)) { // resuming an active object?
+    if (pin != static_cast<QP::QPrio>(0)) { // resuming an active object?
         a = QP::QF::active_[pin]; // the pointer to the preempted AO
 
         QS_BEGIN_NOCRIT_(QP::QS_SCHED_RESUME,
                          QP::QS::priv_.locFilter[QP::QS::AO_OBJ], a)
             QS_TIME_();  // timestamp
-            QS_2U8_(static_cast<uint8_t>(pin), /* prio of the resumed AO */
-                    static_cast<uint8_t>(pprev)); // previous priority
+            QS_2PRIO_(pin, /* prio of the resumed AO */
+                      pprev); // previous priority
         QS_END_NOCRIT_()
     }
     else {  // resuming priority==0 --> idle
@@ -467,7 +471,7 @@ void QK_activate_(void) {
         QS_BEGIN_NOCRIT_(QP::QS_SCHED_IDLE,
                          static_cast<void *>(0), static_cast<void *>(0))
             QS_TIME_();  // timestamp
-            QS_U8_(static_cast<uint8_t>(pprev)); // previous priority
+            QS_PRIO_(pprev); // previous priority
         QS_END_NOCRIT_()
     }
 
@@ -139,7 +139,7 @@ void QS::filterOn(uint_fast8_t const rec) {
     }
     else if (rec == static_cast<uint_fast8_t>(QS_AO_RECORDS)) {
         priv_.glbFilter[1] |= static_cast<uint8_t>(0xFC);
-        priv_.glbFilter[2] |= static_cast<uint8_t>(0x07);
+        priv_.glbFilter[2] |= static_cast<uint8_t>(0x87);
         priv_.glbFilter[5] |= static_cast<uint8_t>(0x20);
     }
     else if (rec == static_cast<uint_fast8_t>(QS_EQ_RECORDS)) {
@@ -230,7 +230,7 @@ void QS::filterOff(uint_fast8_t const rec) {
     }
     else if (rec == static_cast<uint_fast8_t>(QS_AO_RECORDS)) {
         priv_.glbFilter[1] &= static_cast<uint8_t>(~0xFCU);
-        priv_.glbFilter[2] &= static_cast<uint8_t>(~0x07U);
+        priv_.glbFilter[2] &= static_cast<uint8_t>(~0x87U);
         priv_.glbFilter[5] &= static_cast<uint8_t>(~0x20U);
     }
     else if (rec == static_cast<uint_fast8_t>(QS_EQ_RECORDS)) {
@@ -384,11 +384,18 @@ void QS_target_info_(uint8_t const isReset) {
         QS_U8_(static_cast<uint8_t>(QS_OBJ_PTR_SIZE)
                | static_cast<uint8_t>(
                      static_cast<uint8_t>(QS_FUN_PTR_SIZE) << 4));
-        QS_U8_(static_cast<uint8_t>(QS_TIME_SIZE));
+        // the high nibble is non-zero only for the 2-byte QF priorities
+        QS_U8_(static_cast<uint8_t>(QS_TIME_SIZE)
+               | static_cast<uint8_t>(
+                     static_cast<uint8_t>(
+                         (QF_PRIO_SIZE == 1) ? 0 : QF_PRIO_SIZE) << 4));
 
         // send the limits...
-        QS_U8_(static_cast<uint8_t>(QF_MAX_ACTIVE));
-        QS_U8_(static_cast<uint8_t>(QF_MAX_EPOOL)
+        // the 8-bit field saturates for more than 255 priorities
+        QS_U8_(static_cast<uint8_t>((QF_MAX_ACTIVE < 255)
+                                    ? QF_MAX_ACTIVE : 255));
+        // the 4-bit field saturates for more than 15 event pools
+        QS_U8_(static_cast<uint8_t>((QF_MAX_EPOOL < 15) ? QF_MAX_EPOOL : 15)
                | static_cast<uint8_t>(
                      static_cast<uint8_t>(QF_MAX_TICK_RATE) << 4));
 
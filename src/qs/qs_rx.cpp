@@ -70,6 +70,12 @@ QS::QSrxPriv QS::rxPriv_; // QS-RX private data
     typedef uint64_t QSFun;
 #endif
 
+//! the special targets of the QS-RX events in the three largest values
+//! of the QF priority (#QF_PRIO_SIZE bytes), which exceed #QF_MAX_ACTIVE
+#define QS_RX_PRIO_DISPATCH_ static_cast<QPrio>(~static_cast<QPrio>(0))
+#define QS_RX_PRIO_INIT_     static_cast<QPrio>(QS_RX_PRIO_DISPATCH_ - 1U)
+#define QS_RX_PRIO_POST_     static_cast<QPrio>(QS_RX_PRIO_DISPATCH_ - 2U)
+
 /// @cond
 /// Exlcude the following internals from the Doxygen documentation
 /// Extended-state variables used for parsing various QS-RX Records
@@ -120,7 +126,8 @@ struct TPVar {  // Test-Probe
 };
 
 struct AFltVar {
-    uint8_t prio;
+    QPrio   prio;
+    uint8_t idx;
 };
 
 struct EvtVar {
@@ -128,7 +135,7 @@ struct EvtVar {
     uint8_t *p;
     QSignal  sig;
     uint16_t len;
-    uint8_t  prio;
+    QPrio    prio;
     uint8_t  idx;
 };
 
@@ -407,6 +414,8 @@ static void rxParseData_(uint8_t const b) {
                     tran_(WAIT4_OBJ_KIND);
                     break;
                 case QS_RX_AO_FILTER:
+                    l_rx.var.aFlt.prio = static_cast<QPrio>(0);
+                    l_rx.var.aFlt.idx  = static_cast<uint8_t>(0);
                     tran_(WAIT4_AO_FILTER_PRIO);
                     break;
                 case QS_RX_CURR_OBJ:
@@ -414,6 +423,8 @@ static void rxParseData_(uint8_t const b) {
                     tran_(WAIT4_OBJ_KIND);
                     break;
                 case QS_RX_EVENT:
+                    l_rx.var.evt.prio = static_cast<QPrio>(0);
+                    l_rx.var.evt.idx  = static_cast<uint8_t>(0);
                     tran_(WAIT4_EVT_PRIO);
                     break;
 
@@ -676,8 +687,12 @@ static void rxParseData_(uint8_t const b) {
             break;
         }
         case WAIT4_AO_FILTER_PRIO: {
-            l_rx.var.aFlt.prio = b;
-            tran_(WAIT4_AO_FILTER_FRAME);
+            l_rx.var.aFlt.prio |= static_cast<QPrio>(
+                               static_cast<uint32_t>(b) << l_rx.var.aFlt.idx);
+            l_rx.var.aFlt.idx += static_cast<uint8_t>(8);
+            if (l_rx.var.aFlt.idx == static_cast<uint8_t>((8*QF_PRIO_SIZE))) {
+                tran_(WAIT4_AO_FILTER_FRAME);
+            }
             break;
         }
         case WAIT4_AO_FILTER_FRAME: {
@@ -685,10 +700,14 @@ static void rxParseData_(uint8_t const b) {
             break;
         }
         case WAIT4_EVT_PRIO: {
-            l_rx.var.evt.prio = b;
-            l_rx.var.evt.sig  = static_cast<QSignal>(0);
-            l_rx.var.evt.idx  = static_cast<uint8_t>(0);
-            tran_(WAIT4_EVT_SIG);
+            l_rx.var.evt.prio |= static_cast<QPrio>(
+                                static_cast<uint32_t>(b) << l_rx.var.evt.idx);
+            l_rx.var.evt.idx += static_cast<uint8_t>(8);
+            if (l_rx.var.evt.idx == static_cast<uint8_t>((8*QF_PRIO_SIZE))) {
+                l_rx.var.evt.sig = static_cast<QSignal>(0);
+                l_rx.var.evt.idx = static_cast<uint8_t>(0);
+                tran_(WAIT4_EVT_SIG);
+            }
             break;
         }
         case WAIT4_EVT_SIG: {
@@ -965,7 +984,7 @@ static void rxHandleGoodFrame_(uint8_t state) {
         }
         case WAIT4_AO_FILTER_FRAME: {
             rxReportAck_(QS_RX_AO_FILTER);
-            if (l_rx.var.aFlt.prio <= static_cast<uint8_t>(QF_MAX_ACTIVE)) {
+            if (l_rx.var.aFlt.prio <= static_cast<QPrio>(QF_MAX_ACTIVE)) {
                 rxReportAck_(QS_RX_AO_FILTER);
                 QS::priv_.locFilter[QS::AO_OBJ] =
                     QF::active_[l_rx.var.aFlt.prio];
@@ -986,11 +1005,11 @@ static void rxHandleGoodFrame_(uint8_t state) {
             // use 'i' as status, 0 == success,no-recycle
             i = static_cast<uint8_t>(0);
 
-            if (l_rx.var.evt.prio == static_cast<uint8_t>(0)) { // publish
+            if (l_rx.var.evt.prio == static_cast<QPrio>(0)) { // publish
                 QF::PUBLISH(l_rx.var.evt.e, &QS::rxPriv_);
                 rxReportDone_(QS_RX_EVENT);
             }
-            else if (l_rx.var.evt.prio < static_cast<uint8_t>(QF_MAX_ACTIVE))
+            else if (l_rx.var.evt.prio <= static_cast<QPrio>(QF_MAX_ACTIVE))
             {
                 if (!QF::active_[l_rx.var.evt.prio]->POST_X(
                                 l_rx.var.evt.e,
@@ -1001,7 +1020,7 @@ static void rxHandleGoodFrame_(uint8_t state) {
                     i = static_cast<uint8_t>(0x80); // failure, no recycle
                 }
             }
-            else if (l_rx.var.evt.prio == static_cast<uint8_t>(255)) {
+            else if (l_rx.var.evt.prio == QS_RX_PRIO_DISPATCH_) {
                 // dispatch to the current SM object
                 if (QS::rxPriv_.currObj[QS::SM_OBJ]
                     != static_cast<void *>(0))
@@ -1020,7 +1039,7 @@ static void rxHandleGoodFrame_(uint8_t state) {
                     i = static_cast<uint8_t>(0x81);  // failure, recycle
                 }
             }
-            else if (l_rx.var.evt.prio == static_cast<uint8_t>(254)) {
+            else if (l_rx.var.evt.prio == QS_RX_PRIO_INIT_) {
                 // init the current SM object"
                 if (QS::rxPriv_.currObj[QS::SM_OBJ] != static_cast<void *>(0))
                 {
@@ -1038,7 +1057,7 @@ static void rxHandleGoodFrame_(uint8_t state) {
                     i = static_cast<uint8_t>(0x81);  // failure, recycle
                 }
             }
-            else if (l_rx.var.evt.prio == static_cast<uint8_t>(253)) {
+            else if (l_rx.var.evt.prio == QS_RX_PRIO_POST_) {
                 // post to the current AO
                 if (QS::rxPriv_.currObj[QS::AO_OBJ] != static_cast<void *>(0))
                 {
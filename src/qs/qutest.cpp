@@ -59,6 +59,9 @@ void QF::init(void) {
     QF_maxPubSignal_ = static_cast<enum_t>(0);
     QF_intNest       = static_cast<uint8_t>(0);
 
+#if (QF_EPOOL_LUT_SIZE > 0)
+    bzero(&QF_poolLut_[0], static_cast<uint_fast16_t>(sizeof(QF_poolLut_)));
+#endif
     bzero(&active_[0], static_cast<uint_fast16_t>(sizeof(active_)));
     bzero(&QS::rxPriv_.readySet,
           static_cast<uint_fast16_t>(sizeof(QS::rxPriv_.readySet)));
@@ -80,16 +83,16 @@ int_t QF::run(void) {
 }
 
 //............................................................................
-void QActive::start(uint_fast8_t const prio,
+void QActive::start(QPrio const prio,
                     QEvt const *qSto[], uint_fast16_t const qLen,
                     void * const, uint_fast16_t const,
                     QEvt const * const ie)
 {
-    Q_REQUIRE_ID(500, ((uint_fast8_t)0 < prio) /* priority must be in range */
-                 && (prio <= (uint_fast8_t)QF_MAX_ACTIVE));
+    Q_REQUIRE_ID(500, (static_cast<QPrio>(0) < prio) /* prio in range */
+                 && (prio <= static_cast<QPrio>(QF_MAX_ACTIVE)));
 
     m_eQueue.init(qSto, qLen); // initialize QEQueue of this AO
-    m_prio = static_cast<uint8_t>(prio); // set the QF prio of this AO
+    m_prio = prio; // set the QF prio of this AO
 
     QF::add_(this);            // make QF aware of this AO
 
@@ -337,7 +340,7 @@ void QS::processTestEvts_(void) {
     QS_TEST_PROBE(return;)
 
     while (rxPriv_.readySet.notEmpty()) {
-        uint_fast8_t p = rxPriv_.readySet.findMax();
+        QPrio p = rxPriv_.readySet.findMax();
         QActive *a = QF::active_[p];
 
         // perform the run-to-completion (RTC) step...
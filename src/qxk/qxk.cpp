@@ -86,18 +86,21 @@ void QF::init(void) {
     QF_subscrList_   = static_cast<QSubscrList *>(0);
     QF_maxPubSignal_ = static_cast<enum_t>(0);
 
+#if (QF_EPOOL_LUT_SIZE > 0)
+    bzero(&QF_poolLut_[0], static_cast<uint_fast16_t>(sizeof(QF_poolLut_)));
+#endif
     bzero(&timeEvtHead_[0], static_cast<uint_fast16_t>(sizeof(timeEvtHead_)));
     bzero(&active_[0],      static_cast<uint_fast16_t>(sizeof(active_)));
     bzero(&QXK_attr_,       static_cast<uint_fast16_t>(sizeof(QXK_attr_)));
     bzero(&l_idleThread,    static_cast<uint_fast16_t>(sizeof(l_idleThread)));
 
     // setup the QXK scheduler as initially locked and not running
-    QXK_attr_.lockPrio = static_cast<uint8_t>(QF_MAX_ACTIVE + 1);
+    QXK_attr_.lockPrio = static_cast<QPrio>(QF_MAX_ACTIVE + 1);
 
     // setup the QXK idle loop...
     active_[0] = &l_idleThread; // register the idle thread with QF
     QXK_attr_.idleThread = &l_idleThread; // save the idle thread ptr
-    QXK_attr_.actPrio = static_cast<uint8_t>(0); // set idle thread prio
+    QXK_attr_.actPrio = static_cast<QPrio>(0); // set idle thread prio
 
 #ifdef QXK_INIT
     QXK_INIT(); // port-specific initialization of the QXK kernel
@@ -124,10 +127,10 @@ void QF::stop(void) {
 //! process all events posted during initialization
 static void initial_events(void); // prototype
 static void initial_events(void) {
-    QXK_attr_.lockPrio = static_cast<uint8_t>(0); // unlock the scheduler
+    QXK_attr_.lockPrio = static_cast<QPrio>(0); // unlock the scheduler
 
     // any active objects need to be scheduled before starting event loop?
-    if (QXK_sched_() != static_cast<uint_fast8_t>(0)) {
+    if (QXK_sched_() != static_cast<QPrio>(0)) {
         QXK_activate_(); // process all events produced so far
     }
 }
@@ -171,7 +174,7 @@ int_t QF::run(void) {
 // @param[in] ie      pointer to the optional initialization event
 //                    (might be NULL).
 //
-void QActive::start(uint_fast8_t const prio,
+void QActive::start(QPrio const prio,
                      QEvt const *qSto[], uint_fast16_t const qLen,
                      void * const stkSto, uint_fast16_t const stkSize,
                      QEvt const * const ie)
@@ -182,15 +185,15 @@ void QActive::start(uint_fast8_t const prio,
     /// - the stack storage must NOT be provided (because the QXK kernel does
     /// not need per-AO stacks).
     Q_REQUIRE_ID(200, (!QXK_ISR_CONTEXT_())
-        && (static_cast<uint_fast8_t>(0) < prio)
-        && (prio <= static_cast<uint_fast8_t>(QF_MAX_ACTIVE))
+        && (static_cast<QPrio>(0) < prio)
+        && (prio <= static_cast<QPrio>(QF_MAX_ACTIVE))
         && (stkSto == static_cast<void *>(0))
         && (stkSize == static_cast<uint_fast16_t>(0)));
 
     m_eQueue.init(qSto, qLen); // initialize QEQueue of this AO
     m_osObject = static_cast<void *>(0); // no private stack for AO
-    m_prio = static_cast<uint8_t>(prio);      // set the QF prio of this AO
-    m_startPrio = static_cast<uint8_t>(prio); // set start QF prio of this AO
+    m_prio = prio;      // set the QF prio of this AO
+    m_startPrio = prio; // set start QF prio of this AO
     QF::add_(this);   // make QF aware of this AO
 
     this->init(ie); // take the top-most initial tran. (virtual)
@@ -199,7 +202,7 @@ void QActive::start(uint_fast8_t const prio,
     // see if this AO needs to be scheduled in case QXK is running
     QF_CRIT_STAT_
     QF_CRIT_ENTRY_();
-    if (QXK_sched_() != static_cast<uint_fast8_t>(0)) { // activation needed?
+    if (QXK_sched_() != static_cast<QPrio>(0)) { // activation needed?
         QXK_activate_();
     }
     QF_CRIT_EXIT_();
@@ -225,8 +228,8 @@ void QActive::stop(void) {
     QF_CRIT_STAT_
 
     QF_CRIT_ENTRY_();
-    QXK_attr_.readySet.remove(static_cast<uint_fast8_t>(m_prio));
-    if (QXK_sched_() != static_cast<uint_fast8_t>(0)) {
+    QXK_attr_.readySet.remove(m_prio);
+    if (QXK_sched_() != static_cast<QPrio>(0)) {
         QXK_activate_();
     }
     QF_CRIT_EXIT_();
@@ -253,7 +256,7 @@ void QActive::stop(void) {
 /// The following example shows how to lock and unlock the QXK scheduler:
 /// @include qxk_lock.cpp
 ///
-QSchedStatus QXK::schedLock(uint_fast8_t const ceiling) {
+QSchedStatus QXK::schedLock(QPrio const ceiling) {
     QSchedStatus stat;
     QF_CRIT_STAT_
     QF_CRIT_ENTRY_();
@@ -263,15 +266,16 @@ QSchedStatus QXK::schedLock(uint_fast8_t const ceiling) {
     Q_REQUIRE_ID(400, !QXK_ISR_CONTEXT_());
 
     // first store the previous lock prio if below the ceiling
-    if (static_cast<uint_fast8_t>(QXK_attr_.lockPrio) < ceiling) {
-        stat = (static_cast<QSchedStatus>(QXK_attr_.lockPrio) << 8);
-        QXK_attr_.lockPrio = static_cast<uint8_t>(ceiling);
+    if (static_cast<QPrio>(QXK_attr_.lockPrio) < ceiling) {
+        stat = (static_cast<QSchedStatus>(QXK_attr_.lockPrio)
+                << QXK_SCHED_SHIFT_);
+        QXK_attr_.lockPrio = static_cast<QPrio>(ceiling);
 
         QS_BEGIN_NOCRIT_(QS_SCHED_LOCK,
                          static_cast<void *>(0), static_cast<void *>(0))
             QS_TIME_(); // timestamp
-            QS_2U8_(static_cast<uint8_t>(stat), /* the previous lock prio */
-                    QXK_attr_.lockPrio); // new lock prio
+            QS_2PRIO_(stat >> QXK_SCHED_SHIFT_, /* previous lock prio */
+                      QXK_attr_.lockPrio); // new lock prio
         QS_END_NOCRIT_()
 
         // add the previous lock holder priority
@@ -279,10 +283,10 @@ QSchedStatus QXK::schedLock(uint_fast8_t const ceiling) {
         QXK_attr_.lockHolder =
             (QXK_attr_.curr != static_cast<QActive *>(0))
             ? QXK_attr_.curr->m_prio
-            : static_cast<uint8_t>(0);
+            : static_cast<QPrio>(0);
     }
     else {
-       stat = static_cast<QSchedStatus>(0xFF);
+       stat = QXK_SCHED_NOLOCK_;
     }
     QF_CRIT_EXIT_();
 
@@ -308,9 +312,9 @@ QSchedStatus QXK::schedLock(uint_fast8_t const ceiling) {
 ///
 void QXK::schedUnlock(QSchedStatus const stat) {
     // has the scheduler been actually locked by the last QXK_schedLock()?
-    if (stat != static_cast<QSchedStatus>(0xFF)) {
-        uint_fast8_t lockPrio = static_cast<uint_fast8_t>(QXK_attr_.lockPrio);
-        uint_fast8_t prevPrio = static_cast<uint_fast8_t>(stat >> 8);
+    if (stat != QXK_SCHED_NOLOCK_) {
+        QPrio lockPrio = static_cast<QPrio>(QXK_attr_.lockPrio);
+        QPrio prevPrio = static_cast<QPrio>(stat >> QXK_SCHED_SHIFT_);
         QF_CRIT_STAT_
         QF_CRIT_ENTRY_();
 
@@ -323,17 +327,17 @@ void QXK::schedUnlock(QSchedStatus const stat) {
         QS_BEGIN_NOCRIT_(QS_SCHED_UNLOCK,
                          static_cast<void *>(0), static_cast<void *>(0))
             QS_TIME_(); // timestamp
-            QS_2U8_(static_cast<uint8_t>(lockPrio),/* prio before unlocking */
-                    static_cast<uint8_t>(prevPrio));// prio after unlocking
+            QS_2PRIO_(lockPrio,/* prio before unlocking */
+                      prevPrio);// prio after unlocking
         QS_END_NOCRIT_()
 
         // restore the previous lock priority and lock holder
-        QXK_attr_.lockPrio   = static_cast<uint8_t>(prevPrio);
+        QXK_attr_.lockPrio   = static_cast<QPrio>(prevPrio);
         QXK_attr_.lockHolder =
-            static_cast<uint8_t>(stat & static_cast<QSchedStatus>(0xFF));
+            static_cast<QPrio>(stat & QXK_SCHED_NOLOCK_);
 
         // find the highest-prio thread ready to run
-        if (QXK_sched_() != static_cast<uint_fast8_t>(0)) { // priority found?
+        if (QXK_sched_() != static_cast<QPrio>(0)) { // priority found?
             QXK_activate_(); // activate any unlocked basic threads
         }
 
@@ -359,13 +363,13 @@ extern "C" {
 /// QXK_sched_() must be always called with interrupts **disabled** and
 /// returns with interrupts **disabled**.
 ///
-uint_fast8_t QXK_sched_(void) {
+QP::QPrio QXK_sched_(void) {
     // find the highest-prio thread ready to run
-    uint_fast8_t p = QXK_attr_.readySet.findMax();
+    QP::QPrio p = QXK_attr_.readySet.findMax();
 
-    if (p <= static_cast<uint_fast8_t>(QXK_attr_.lockPrio)) { // below lock?
-        p = static_cast<uint_fast8_t>(QXK_attr_.lockHolder);
-        Q_ASSERT_ID(610, (p == static_cast<uint_fast8_t>(0))
+    if (p <= static_cast<QP::QPrio>(QXK_attr_.lockPrio)) { // below lock?
+        p = static_cast<QP::QPrio>(QXK_attr_.lockHolder);
+        Q_ASSERT_ID(610, (p == static_cast<QP::QPrio>(0))
                          || QXK_attr_.readySet.hasElement(p));
     }
 
@@ -379,12 +383,12 @@ uint_fast8_t QXK_sched_(void) {
 
         // is next a basic-thread?
         if (next->m_osObject == static_cast<void *>(0)) {
-            if (p > static_cast<uint_fast8_t>(QXK_attr_.actPrio)) {
+            if (p > static_cast<QP::QPrio>(QXK_attr_.actPrio)) {
                 QXK_attr_.next = next; // set the next AO to activate
             }
             else {
                 QXK_attr_.next = static_cast<QP::QActive *>(0);
-                p = static_cast<uint_fast8_t>(0); // no activation needed
+                p = static_cast<QP::QPrio>(0); // no activation needed
             }
         }
         else {  // this is an extened-thread
@@ -393,12 +397,12 @@ uint_fast8_t QXK_sched_(void) {
                              QP::QS::priv_.locFilter[QP::QS::AO_OBJ],
                              next)
                 QS_TIME_();         // timestamp
-                QS_2U8_(static_cast<uint8_t>(p), /* prio of the next AO */
-                        QXK_attr_.actPrio); // prio of the curr AO
+                QS_2PRIO_(p, /* prio of the next AO */
+                          QXK_attr_.actPrio); // prio of the curr AO
             QS_END_NOCRIT_()
 
             QXK_attr_.next = next;
-            p = static_cast<uint_fast8_t>(0); // no activation needed
+            p = static_cast<QP::QPrio>(0); // no activation needed
             QXK_CONTEXT_SWITCH_();
         }
     }
@@ -411,18 +415,18 @@ uint_fast8_t QXK_sched_(void) {
                              QP::QS::priv_.locFilter[QP::QS::AO_OBJ],
                              next)
                 QS_TIME_(); // timestamp
-                QS_2U8_(static_cast<uint8_t>(p), /* next prio */
-                        QXK_attr_.curr->m_prio);
+                QS_2PRIO_(p, /* next prio */
+                          QXK_attr_.curr->m_prio);
             QS_END_NOCRIT_()
 
             QXK_attr_.next = next;
-            p = static_cast<uint_fast8_t>(0); // no activation needed
+            p = static_cast<QP::QPrio>(0); // no activation needed
             QXK_CONTEXT_SWITCH_();
         }
         else { // next is the same as current
             // no need to context-switch
             QXK_attr_.next = static_cast<QP::QActive *>(0);
-            p = static_cast<uint_fast8_t>(0); // no activation needed
+            p = static_cast<QP::QPrio>(0); // no activation needed
         }
     }
     return p;
@@ -438,31 +442,31 @@ uint_fast8_t QXK_sched_(void) {
 /// returns with interrupts **disabled**.
 ///
 void QXK_activate_(void) {
-    uint_fast8_t pin = static_cast<uint_fast8_t>(QXK_attr_.actPrio);
+    QP::QPrio pin = static_cast<QP::QPrio>(QXK_attr_.actPrio);
     QP::QActive *a = QXK_attr_.next; // the next AO (basic-thread) to execute
 
     // QXK Context switch callback defined or QS tracing enabled?
 #if (defined QXK_ON_CONTEXT_SW) || (defined Q_SPY)
-    uint_fast8_t pprev = pin;
+    QP::QPrio pprev = pin;
 #endif // QXK_ON_CONTEXT_SW || Q_SPY
 
     // QXK_attr_.next must be valid
     Q_REQUIRE_ID(700, a != static_cast<QP::QActive *>(0));
 
-    uint_fast8_t p = static_cast<uint_fast8_t>(a->m_prio); // the next AO
+    QP::QPrio p = a->m_prio; // the next AO
 
     // loop until no more ready-to-run AOs of higher prio than the initial
     do  {
         a = QP::QF::active_[p]; // obtain the pointer to the AO
 
-        QXK_attr_.actPrio = static_cast<uint8_t>(p); // new active prio
+        QXK_attr_.actPrio = static_cast<QP::QPrio>(p); // new active prio
         QXK_attr_.next = static_cast<QP::QActive *>(0); // clear the next AO
 
         QS_BEGIN_NOCRIT_(QP::QS_SCHED_NEXT,
                          QP::QS::priv_.locFilter[QP::QS::AO_OBJ], a)
             QS_TIME_();         // timestamp
-            QS_2U8_(static_cast<uint8_t>(p), /* next prio */
-                    static_cast<uint8_t>(pprev)); // prev prio
+            QS_2PRIO_(p, /* next prio */
+                      pprev); // prev prio
         QS_END_NOCRIT_()
 
 #if (defined QXK_ON_CONTEXT_SW) || (defined Q_SPY)
@@ -470,7 +474,7 @@ void QXK_activate_(void) {
 
 #ifdef QXK_ON_CONTEXT_SW
             // context-switch callback
-            QXK_onContextSw(((pprev != static_cast<uint_fast8_t>(0))
+            QXK_onContextSw(((pprev != static_cast<QP::QPrio>(0))
                              ? QP::QF::active_[pprev]
                              : static_cast<QP::QActive *>(0)),
                              a);
@@ -503,9 +507,9 @@ void QXK_activate_(void) {
         // current is a basic-thread path.
         p = QXK_attr_.readySet.findMax();
 
-        if (p <= static_cast<uint_fast8_t>(QXK_attr_.lockPrio)) {//below lock?
-            p = static_cast<uint_fast8_t>(QXK_attr_.lockHolder);
-            Q_ASSERT_ID(710, (p == static_cast<uint_fast8_t>(0))
+        if (p <= static_cast<QP::QPrio>(QXK_attr_.lockPrio)) {//below lock?
+            p = static_cast<QP::QPrio>(QXK_attr_.lockHolder);
+            Q_ASSERT_ID(710, (p == static_cast<QP::QPrio>(0))
                              || QXK_attr_.readySet.hasElement(p));
         }
         a = QP::QF::active_[p];
@@ -520,7 +524,7 @@ void QXK_activate_(void) {
             }
             else {
                 QXK_attr_.next = static_cast<QP::QActive *>(0);
-                p = static_cast<uint_fast8_t>(0); // no activation needed
+                p = static_cast<QP::QPrio>(0); // no activation needed
             }
         }
         else {  // next is the-extened thread
@@ -528,27 +532,27 @@ void QXK_activate_(void) {
             QS_BEGIN_NOCRIT_(QP::QS_SCHED_NEXT,
                              QP::QS::priv_.locFilter[QP::QS::AO_OBJ], a)
                 QS_TIME_(); // timestamp
-                QS_2U8_(static_cast<uint8_t>(p), /* next prio */
-                        QXK_attr_.actPrio);      // curr prio
+                QS_2PRIO_(p, /* next prio */
+                          QXK_attr_.actPrio);      // curr prio
             QS_END_NOCRIT_()
 
             QXK_attr_.next = a;
-            p = static_cast<uint_fast8_t>(0); // no activation needed
+            p = static_cast<QP::QPrio>(0); // no activation needed
             QXK_CONTEXT_SWITCH_();
         }
-    } while (p != static_cast<uint_fast8_t>(0)); // while activation needed
+    } while (p != static_cast<QP::QPrio>(0)); // while activation needed
 
-    QXK_attr_.actPrio = static_cast<uint8_t>(pin); // restore base prio
+    QXK_attr_.actPrio = static_cast<QP::QPrio>(pin); // restore base prio
 
 #if (defined QK_ON_CONTEXT_SW) || (defined Q_SPY)
-    if (pin != static_cast<uint_fast8_t>(0)) { // resuming an active object?
+    if (pin != static_cast<QP::QPrio>(0)) { // resuming an active object?
         a = QP::QF::active_[pin]; // the pointer to the preempted AO
 
         QS_BEGIN_NOCRIT_(QP::QS_SCHED_RESUME,
                          QP::QS::priv_.locFilter[QP::QS::AO_OBJ], a)
             QS_TIME_();  // timestamp
-            QS_2U8_(static_cast<uint8_t>(p),      /* resumed prio */
-                    static_cast<uint8_t>(pprev)); // previous prio
+            QS_2PRIO_(p,      /* resumed prio */
+                      pprev); // previous prio
         QS_END_NOCRIT_()
     }
     else {  // resuming priority==0 --> idle
@@ -557,7 +561,7 @@ void QXK_activate_(void) {
         QS_BEGIN_NOCRIT_(QP::QS_SCHED_IDLE,
                          static_cast<void *>(0), static_cast<void *>(0))
             QS_TIME_(); // timestamp
-            QS_U8_(static_cast<uint8_t>(pprev)); // previous prio
+            QS_PRIO_(pprev); // previous prio
         QS_END_NOCRIT_()
     }
 
@@ -578,7 +582,7 @@ QP::QActive *QXK_current(void) {
 
     /// @pre the QXK kernel must be running
     Q_REQUIRE_ID(800,
-        QXK_attr_.lockPrio <= static_cast<uint8_t>(QF_MAX_ACTIVE));
+        QXK_attr_.lockPrio <= static_cast<QP::QPrio>(QF_MAX_ACTIVE));
 
     curr = QXK_attr_.curr;
     if (curr == static_cast<QP::QActive *>(0)) { // basic thread?
@@ -81,7 +81,7 @@ Q_DEFINE_THIS_MODULE("qxk_mutex")
 /// @usage
 /// @include qxk_mux.cpp
 ///
-void QXMutex::init(uint_fast8_t const ceiling) {
+void QXMutex::init(QPrio const ceiling) {
     QF_CRIT_STAT_
 
     QF_CRIT_ENTRY_();
@@ -90,16 +90,16 @@ void QXMutex::init(uint_fast8_t const ceiling) {
     /// - the ceiling priority of the mutex must not be already in use;
     /// (QF requires priority to be **unique**).
     Q_REQUIRE_ID(100,
-        (ceiling <= static_cast<uint_fast8_t>(QF_MAX_ACTIVE))
-        && ((ceiling == static_cast<uint_fast8_t>(0))
+        (ceiling <= static_cast<QPrio>(QF_MAX_ACTIVE))
+        && ((ceiling == static_cast<QPrio>(0))
             || (QF::active_[ceiling] == static_cast<QActive *>(0))));
 
-    m_ceiling    = static_cast<uint8_t>(ceiling);
+    m_ceiling    = static_cast<QPrio>(ceiling);
     m_lockNest   = static_cast<uint8_t>(0);
-    m_holderPrio = static_cast<uint8_t>(0);
+    m_holderPrio = static_cast<QPrio>(0);
     QF::bzero(&m_waitSet, static_cast<uint_fast16_t>(sizeof(m_waitSet)));
 
-    if (ceiling != static_cast<uint_fast8_t>(0)) {
+    if (ceiling != static_cast<QPrio>(0)) {
         // reserve the ceiling priority level for this mutex
         QF::active_[ceiling] = reinterpret_cast<QActive *>(this);
     }
@@ -142,7 +142,7 @@ bool QXMutex::lock(uint_fast16_t const nTicks) {
     /// - the thread must NOT be already blocked on any object.
     Q_REQUIRE_ID(200, (!QXK_ISR_CONTEXT_()) /* don't call from an ISR! */
         && (curr != static_cast<QXThread *>(0)) /* curr must be extended */
-        && ((m_ceiling == static_cast<uint8_t>(0)) /* below ceiling */
+        && ((m_ceiling == static_cast<QPrio>(0)) /* below ceiling */
             || (curr->m_startPrio < m_ceiling))
         && (QXK_attr_.lockHolder != curr->m_prio) /* not holding a lock */
         && (curr->m_temp.obj == static_cast<QMState *>(0))); // not blocked
@@ -151,7 +151,7 @@ bool QXMutex::lock(uint_fast16_t const nTicks) {
     if (m_lockNest == static_cast<uint8_t>(0)) {
         m_lockNest = static_cast<uint8_t>(1);
 
-        if (m_ceiling != static_cast<uint8_t>(0)) {
+        if (m_ceiling != static_cast<QPrio>(0)) {
             // the priority slot must be set to this mutex */
             Q_ASSERT_ID(210,
                 QF::active_[m_ceiling] == reinterpret_cast<QActive *>(this));
@@ -161,17 +161,17 @@ bool QXMutex::lock(uint_fast16_t const nTicks) {
             QF::active_[m_ceiling] = curr;
 
             QXK_attr_.readySet.remove(
-                static_cast<uint_fast8_t>(curr->m_startPrio));
+                curr->m_startPrio);
             QXK_attr_.readySet.insert(
-                static_cast<uint_fast8_t>(curr->m_prio));
+                curr->m_prio);
         }
-        m_holderPrio = static_cast<uint8_t>(curr->m_startPrio);
+        m_holderPrio = static_cast<QPrio>(curr->m_startPrio);
 
         QS_BEGIN_NOCRIT_(QS_MUTEX_LOCK,
             static_cast<void *>(0), static_cast<void *>(0))
             QS_TIME_();  // timestamp
-            QS_2U8_(curr->m_startPrio, /* start prio */
-                    m_ceiling); // current ceiling
+            QS_2PRIO_(curr->m_startPrio, /* start prio */
+                      m_ceiling); // current ceiling
         QS_END_NOCRIT_()
     }
     // is the mutex locked by this thread already (nested locking)?
@@ -185,9 +185,9 @@ bool QXMutex::lock(uint_fast16_t const nTicks) {
     else { // the mutex is alredy locked by a different thread
 
         // the ceiling holder priority must be valid
-        Q_ASSERT_ID(230, m_holderPrio != static_cast<uint8_t>(0));
+        Q_ASSERT_ID(230, m_holderPrio != static_cast<QPrio>(0));
 
-        if (m_ceiling != static_cast<uint8_t>(0)) {
+        if (m_ceiling != static_cast<QPrio>(0)) {
             // the prio slot must be claimed by the thread holding the mutex
             Q_ASSERT_ID(240,
                         QF::active_[m_ceiling] != static_cast<QActive *>(0));
@@ -195,8 +195,8 @@ bool QXMutex::lock(uint_fast16_t const nTicks) {
 
         // remove this thr prio from the ready set (block)
         // and insert to the waiting set on this mutex
-        QXK_attr_.readySet.remove(static_cast<uint_fast8_t>(curr->m_prio));
-        m_waitSet.insert(static_cast<uint_fast8_t>(curr->m_prio));
+        QXK_attr_.readySet.remove(curr->m_prio);
+        m_waitSet.insert(curr->m_prio);
 
         // store the blocking object (this mutex)
         curr->m_temp.obj = reinterpret_cast<QMState *>(this);
@@ -256,9 +256,9 @@ bool QXMutex::tryLock(void) {
     ///   - the thread priority must be below the ceiling of the mutex;
     /// - the thread must NOT be holding a scheduler lock;
     Q_REQUIRE_ID(300, (!QXK_ISR_CONTEXT_()) /* don't call from an ISR! */
-        && (QXK_attr_.lockPrio <= static_cast<uint8_t>(QF_MAX_ACTIVE))
+        && (QXK_attr_.lockPrio <= static_cast<QPrio>(QF_MAX_ACTIVE))
         && (curr != static_cast<QActive *>(0)) /* curr thread must be valid */
-        && ((m_ceiling == static_cast<uint8_t>(0)) /* below ceiling */
+        && ((m_ceiling == static_cast<QPrio>(0)) /* below ceiling */
             || (curr->m_startPrio < m_ceiling))
         && (curr->m_prio != QXK_attr_.lockHolder)); // not holding a lock
 
@@ -266,7 +266,7 @@ bool QXMutex::tryLock(void) {
     if (m_lockNest == static_cast<uint8_t>(0)) {
         m_lockNest = static_cast<uint8_t>(1);
 
-        if (m_ceiling != static_cast<uint8_t>(0)) {
+        if (m_ceiling != static_cast<QPrio>(0)) {
             // the priority slot must be set to this mutex
             Q_ASSERT_ID(310,
                 QF::active_[m_ceiling] == reinterpret_cast<QActive *>(this));
@@ -276,18 +276,18 @@ bool QXMutex::tryLock(void) {
             QF::active_[m_ceiling] = curr;
 
             QXK_attr_.readySet.remove(
-                static_cast<uint_fast8_t>(curr->m_startPrio));
+                curr->m_startPrio);
             QXK_attr_.readySet.insert(
-                static_cast<uint_fast8_t>(curr->m_prio));
+                curr->m_prio);
         }
 
         // make curr thread the new mutex holder
-        m_holderPrio = static_cast<uint8_t>(curr->m_startPrio);
+        m_holderPrio = static_cast<QPrio>(curr->m_startPrio);
 
         QS_BEGIN_NOCRIT_(QS_MUTEX_LOCK, static_cast<void *>(0), curr)
             QS_TIME_();  // timestamp
-            QS_2U8_(static_cast<uint8_t>(curr->m_startPrio), /* start prio */
-                    m_ceiling);  // current ceiling
+            QS_2PRIO_(curr->m_startPrio, /* start prio */
+                      m_ceiling);  // current ceiling
         QS_END_NOCRIT_()
     }
     // is the mutex held by this thread already (nested locking)?
@@ -298,9 +298,9 @@ bool QXMutex::tryLock(void) {
         ++m_lockNest;
     }
     else { // the mutex is alredy locked by a different thread
-        if (m_ceiling != static_cast<uint8_t>(0)) {
+        if (m_ceiling != static_cast<QPrio>(0)) {
             // the prio slot must be claimed by the mutex holder
-            Q_ASSERT_ID(330, (m_holderPrio != static_cast<uint8_t>(0))
+            Q_ASSERT_ID(330, (m_holderPrio != static_cast<QPrio>(0))
                 && (QF::active_[m_ceiling] != QF::active_[m_holderPrio]));
         }
         curr = static_cast<QActive *>(0); // means that mutex is NOT available
@@ -346,39 +346,39 @@ void QXMutex::unlock(void) {
     /// - the mutex must be already locked at least once.
     Q_REQUIRE_ID(400, (!QXK_ISR_CONTEXT_()) /* don't call from an ISR! */
         && (curr != static_cast<QActive *>(0)) /* curr must be valid */
-        && (curr->m_startPrio == static_cast<uint8_t>(m_holderPrio))
-        && ((m_ceiling == static_cast<uint8_t>(0)) /* curr at ceiling prio */
+        && (curr->m_startPrio == static_cast<QPrio>(m_holderPrio))
+        && ((m_ceiling == static_cast<QPrio>(0)) /* curr at ceiling prio */
             || (curr->m_prio == m_ceiling))
         && (m_lockNest > static_cast<uint8_t>(0))); // locked at least once
 
     // is this the last nesting level?
     if (m_lockNest == static_cast<uint8_t>(1)) {
 
-        if (m_ceiling != static_cast<uint8_t>(0)) {
+        if (m_ceiling != static_cast<QPrio>(0)) {
             // restore the holding thread's priority to the original
             curr->m_prio = curr->m_startPrio;
 
             // remove the boosted priority and insert the original priority
             QXK_attr_.readySet.remove(
-                static_cast<uint_fast8_t>(m_ceiling));
+                static_cast<QPrio>(m_ceiling));
             QXK_attr_.readySet.insert(
-                static_cast<uint_fast8_t>(curr->m_startPrio));
+                curr->m_startPrio);
         }
 
         // the mutex no longer held by a thread
-        m_holderPrio = static_cast<uint8_t>(0);
+        m_holderPrio = static_cast<QPrio>(0);
 
         QS_BEGIN_NOCRIT_(QS_MUTEX_UNLOCK, static_cast<void *>(0), curr)
             QS_TIME_();  // timestamp
-            QS_2U8_(static_cast<uint8_t>(curr->m_startPrio), /* start prio */
-                    m_ceiling);  // the mutex ceiling
+            QS_2PRIO_(curr->m_startPrio, /* start prio */
+                      m_ceiling);  // the mutex ceiling
         QS_END_NOCRIT_()
 
         // are any other threads waiting for this mutex?
         if (m_waitSet.notEmpty()) {
 
             // find the highest-priority waiting thread
-            uint_fast8_t p = m_waitSet.findMax();
+            QPrio p = m_waitSet.findMax();
             QXThread *thr = static_cast<QXThread *>(QF::active_[p]);
 
             // the waiting thread must:
@@ -389,8 +389,8 @@ void QXMutex::unlock(void) {
             // (4) have still the start priority
             // (5) be blocked on this mutex
             Q_ASSERT_ID(410,
-                ((m_ceiling == static_cast<uint8_t>(0)) /* below ceiling */
-                   || (p < static_cast<uint_fast8_t>(m_ceiling)))
+                ((m_ceiling == static_cast<QPrio>(0)) /* below ceiling */
+                   || (p < static_cast<QPrio>(m_ceiling)))
                 && (thr != static_cast<QXThread *>(0)) /* extended thread */
                 && (!QXK_attr_.readySet.hasElement(p))
                 && (thr->m_prio == thr->m_startPrio)
@@ -402,35 +402,35 @@ void QXMutex::unlock(void) {
             // this thread is no longer waiting for the mutex
             m_waitSet.remove(p);
 
-            if (m_ceiling != static_cast<uint8_t>(0)) {
+            if (m_ceiling != static_cast<QPrio>(0)) {
                 // switch the priority of this thread to the mutex ceiling
                 thr->m_prio = m_ceiling;
                 QF::active_[m_ceiling] = thr;
             }
 
             // make thr the new mutex holder
-            m_holderPrio = static_cast<uint8_t>(thr->m_startPrio);
+            m_holderPrio = static_cast<QPrio>(thr->m_startPrio);
 
             // make the thread ready to run
-            QXK_attr_.readySet.insert(static_cast<uint_fast8_t>(thr->m_prio));
+            QXK_attr_.readySet.insert(thr->m_prio);
 
             QS_BEGIN_NOCRIT_(QS_MUTEX_LOCK, static_cast<void *>(0), thr)
                 QS_TIME_();  // timestamp
-                QS_2U8_(static_cast<uint8_t>(thr->m_startPrio),/*start prio*/
-                        m_ceiling);  // ceiling prio
+                QS_2PRIO_(thr->m_startPrio,/*start prio*/
+                          m_ceiling);  // ceiling prio
             QS_END_NOCRIT_()
         }
         else { // no threads are waiting for this mutex
             m_lockNest = static_cast<uint8_t>(0);
 
-            if (m_ceiling != static_cast<uint8_t>(0)) {
+            if (m_ceiling != static_cast<QPrio>(0)) {
                 // put the mutex at the priority ceiling slot
                 QF::active_[m_ceiling] = reinterpret_cast<QActive *>(this);
             }
         }
 
         // schedule the next thread if multitasking started
-        if (QXK_sched_() != static_cast<uint_fast8_t>(0)) {
+        if (QXK_sched_() != static_cast<QPrio>(0)) {
             QXK_activate_(); // activate a basic thread
         }
     }
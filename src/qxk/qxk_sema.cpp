@@ -128,8 +128,8 @@ bool QXSemaphore::wait(uint_fast16_t const nTicks) {
         // remember the blocking object
         curr->m_temp.obj = reinterpret_cast<QMState const *>(this);
         curr->teArm_(static_cast<enum_t>(QXK_SEMA_SIG), nTicks);
-        m_waitSet.insert(static_cast<uint_fast8_t>(curr->m_prio));
-        QXK_attr_.readySet.remove(static_cast<uint_fast8_t>(curr->m_prio));
+        m_waitSet.insert(curr->m_prio);
+        QXK_attr_.readySet.remove(curr->m_prio);
         (void)QXK_sched_();
         QF_CRIT_EXIT_();
         QF_CRIT_EXIT_NOP(); // BLOCK here
@@ -207,7 +207,7 @@ bool QXSemaphore::signal(void) {
 
     QF_CRIT_ENTRY_();
     if (m_waitSet.notEmpty()) {
-        uint_fast8_t p = m_waitSet.findMax();
+        QPrio p = m_waitSet.findMax();
         QXK_attr_.readySet.insert(p);
         m_waitSet.remove(p);
 
@@ -113,7 +113,7 @@ void QXThread::dispatch(QEvt const * const /*e*/) {
 /// The following example shows starting an extended thread:
 /// @include qxk_xstart.cpp
 ///
-void QXThread::start(uint_fast8_t const prio,
+void QXThread::start(QPrio const prio,
                      QEvt const *qSto[], uint_fast16_t const qLen,
                      void * const stkSto, uint_fast16_t const stkSize,
                      QEvt const * const /*ie*/)
@@ -124,7 +124,7 @@ void QXThread::start(uint_fast8_t const prio,
     /// - the stack storage must be provided;
     /// - the thread must be instantiated (see QP::QXThread::QXThread()).
     Q_REQUIRE_ID(200, (!QXK_ISR_CONTEXT_()) /* don't start AO's in an ISR! */
-        && (prio <= static_cast<uint_fast8_t>(QF_MAX_ACTIVE))
+        && (prio <= static_cast<QPrio>(QF_MAX_ACTIVE))
         && (stkSto != static_cast<void *>(0))
         && (stkSize != static_cast<uint_fast16_t>(0))
         && (m_state.act == static_cast<QActionHandler>(0)));
@@ -139,8 +139,8 @@ void QXThread::start(uint_fast8_t const prio,
     QXK_stackInit_(this, reinterpret_cast<QXThreadHandler>(m_temp.act),
                    stkSto, stkSize);
 
-    m_prio      = static_cast<uint8_t>(prio);
-    m_startPrio = static_cast<uint8_t>(prio);
+    m_prio      = prio;
+    m_startPrio = prio;
 
     // the new thread is not blocked on any object
     m_temp.obj = static_cast<QMState const *>(0);
@@ -150,7 +150,7 @@ void QXThread::start(uint_fast8_t const prio,
     QF_CRIT_STAT_
     QF_CRIT_ENTRY_();
     // extended-thread becomes ready immediately
-    QXK_attr_.readySet.insert(static_cast<uint_fast8_t>(m_prio));
+    QXK_attr_.readySet.insert(m_prio);
 
     // see if this thread needs to be scheduled in case QXK is running
     (void)QXK_sched_();
@@ -257,7 +257,7 @@ bool QXThread::post_(QEvt const * const e, uint_fast16_t const margin,
                 {
                     (void)teDisarm_();
                     QXK_attr_.readySet.insert(
-                        static_cast<uint_fast8_t>(m_prio));
+                        m_prio);
                     if (!QXK_ISR_CONTEXT_()) {
                         (void)QXK_sched_();
                     }
@@ -367,7 +367,7 @@ QEvt const *QXThread::queueGet(uint_fast16_t const nTicks) {
         thr->m_temp.obj = reinterpret_cast<QMState const *>(&thr->m_eQueue);
 
         thr->teArm_(static_cast<enum_t>(QXK_QUEUE_SIG), nTicks);
-        QXK_attr_.readySet.remove(static_cast<uint_fast8_t>(thr->m_prio));
+        QXK_attr_.readySet.remove(thr->m_prio);
         (void)QXK_sched_();
         QF_CRIT_EXIT_();
         QF_CRIT_EXIT_NOP(); // BLOCK here
@@ -441,7 +441,7 @@ QEvt const *QXThread::queueGet(uint_fast16_t const nTicks) {
 void QXThread::block_(void) const {
     /// @pre the thread holding the lock cannot block!
     Q_REQUIRE_ID(600, (QXK_attr_.lockHolder != m_prio));
-    QXK_attr_.readySet.remove(static_cast<uint_fast8_t>(m_prio));
+    QXK_attr_.readySet.remove(m_prio);
     (void)QXK_sched_();
 }
 
@@ -453,7 +453,7 @@ void QXThread::block_(void) const {
 /// must be called from within a critical section
 ///
 void QXThread::unblock_(void) const {
-    QXK_attr_.readySet.insert(static_cast<uint_fast8_t>(m_prio));
+    QXK_attr_.readySet.insert(m_prio);
 
     if ((!QXK_ISR_CONTEXT_()) // not inside ISR?
         && (QF::active_[0] != static_cast<QActive *>(0))) // kernel started?
@@ -615,7 +615,7 @@ void QXK_threadRet_(void) {
         && (QXK_attr_.lockHolder != thr->m_prio) /* not holding a lock */
         && (thr->getBlockingObj() == static_cast<void const *>(0)));//!blocked
 
-    uint_fast8_t p = static_cast<uint_fast8_t>(QXK_attr_.curr->m_startPrio);
+    QP::QPrio p = static_cast<QP::QPrio>(QXK_attr_.curr->m_startPrio);
 
     // remove this thread from the QF
     QP::QF::active_[p] = static_cast<QP::QActive *>(0);